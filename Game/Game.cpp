@@ -42,6 +42,7 @@ ChangeLog
 _______________________________________________
 -Added game paused variable, so that the game doesn't  update when the variable is true.
 -Hero handle events is now called in here
+-The main atlas is preloaded on a worker thread before the world is loaded, and the heads up display is preloaded in the background
 */
 
 #include "Game.h"
@@ -75,21 +76,35 @@ namespace GameDev2D
 
     float Game::LoadContent()
     {
+        //Preload the main atlas, the world's sprites are only created once it has been decoded on a worker thread
+        ServiceLocator::GetTextureManager()->PreloadTexture("MainAtlas", "Images/");
+        if (ServiceLocator::GetTextureManager()->IsTexturePreloading("MainAtlas") == true)
+        {
+            return 0.0f;
+        }
+
         //Create the World object
         if (m_World == nullptr)
         {
             m_World = new World();
         }
 
-        //Create the heads up display object
+        //Create the heads up display object, the SceneManager preloads it
         if (m_HeadsUpDisplay == nullptr)
         {
             m_HeadsUpDisplay = new HeadsUpDisplay(m_World);
             ServiceLocator::GetSceneManager()->PreloadScene(m_HeadsUpDisplay);
         }
 
+        //Load the world, the game isn't loaded until the heads up display is loaded as well
+        float percentageLoaded = m_World->LoadContent();
+        if (ServiceLocator::GetSceneManager()->IsSceneLoaded(m_HeadsUpDisplay) == false)
+        {
+            percentageLoaded = fminf(percentageLoaded, GAME_HEADS_UP_DISPLAY_LOADING_PERCENTAGE);
+        }
+
         //Return the percentage loaded
-        return m_World->LoadContent();
+        return percentageLoaded;
     }
 
     void Game::Update(double aDelta)
@@ -11,6 +11,7 @@
 ChangeLog
 _______________________________________________
 -Added game paused bool variable, and functions to set it and get it.
+-Added the percentage the game's loading stops at, until the heads up display is preloaded.
 */
 
 
@@ -24,6 +25,7 @@ namespace GameDev2D
 {
     //Local Constants
     const double GAME_INTRO_DURATION = 1.5;
+    const float GAME_HEADS_UP_DISPLAY_LOADING_PERCENTAGE = 0.99f;
 
     //Forward declarations
     class World;
@@ -151,25 +151,30 @@ namespace GameDev2D
             unsigned int columnIndex = 0;
             vec2 position = vec2(screenWidth * HUD_HEARTS_STARTING_POSITION_PCT.x, screenHeight * HUD_HEARTS_STARTING_POSITION_PCT.y);
 
-            //Cycle through the number of hearts and draw the hero's health
+            //Clear the heart draw arrays, the capacity is kept between draws
+            m_HeartPositions.clear();
+            m_HeartAngles.clear();
+            m_HeartSourceFrames.clear();
+
+            //Cycle through the number of hearts and gather the hero's health
             for(unsigned int i = 0; i < numberOfHearts; i++)
             {
+                m_HeartPositions.push_back(position);
+                m_HeartAngles.push_back(0.0f);
+                
                 if(needsHalfHeart == true && halfHealth == i)
                 {
-                    m_HealthHalf->SetLocalPosition(position);
-                    m_HealthHalf->Draw();
+                    m_HeartSourceFrames.push_back(m_HealthHalf->GetSourceFrame());
                 }
                 else
                 {
                     if(halfHealth > i)
                     {
-                        m_HealthFull->SetLocalPosition(position);
-                        m_HealthFull->Draw();
+                        m_HeartSourceFrames.push_back(m_HealthFull->GetSourceFrame());
                     }
                     else
                     {
-                        m_HealthEmpty->SetLocalPosition(position);
-                        m_HealthEmpty->Draw();
+                        m_HeartSourceFrames.push_back(m_HealthEmpty->GetSourceFrame());
                     }
                 }
                 
@@ -187,6 +192,9 @@ namespace GameDev2D
                     position.x = screenWidth * HUD_HEARTS_STARTING_POSITION_PCT.x;
                 }
             }
+            
+            //Draw all the hearts in one draw call, the hearts are all in the same texture atlas
+            m_HealthFull->DrawBatch(m_HeartPositions, m_HeartAngles, m_HeartSourceFrames);
         }
     }
 }
\ No newline at end of file
@@ -10,6 +10,7 @@
 #define __GameDev2D__HeadsUpDisplay__
 
 #include "../Source/Core/Scene.h"
+#include "../Source/Graphics/Textures/TextureFrame.h"
 
 
 using namespace glm;
@@ -54,6 +55,11 @@ namespace GameDev2D
         Sprite* m_HealthFull;
         Sprite* m_Sword;
         Label* m_RupeeLabel;
+        
+        //Scratch arrays used to draw all the hearts in one batched draw call
+        vector<vec2> m_HeartPositions;
+        vector<float> m_HeartAngles;
+        vector<SourceFrame> m_HeartSourceFrames;
     };
 }
 
@@ -0,0 +1,352 @@
+/*******************************************************************
+LevelAutosave.cpp
+
+Purpose:
+The level autosave journals the Level Editor's tile changes to an
+append-only file next to each level file, so that a crash doesn't lose
+the edits made since the last save. Every few seconds the journal is
+compacted into the level file, the level is written to a temporary file
+that then replaces it. The files are written on a background thread so
+that autosaving never blocks the editor's frame. When a level is loaded
+the edits left in its journal are recovered.
+*********************************************************************/
+
+#include "LevelAutosave.h"
+#include "../SubSection.h"
+#include "../../Source/Services/ServiceLocator.h"
+#include "../../Source/Platforms/PlatformLayer.h"
+
+namespace GameDev2D
+{
+    LevelAutosave::LevelAutosave() : BaseObject("LevelAutosave"),
+        m_IsRunning(true),
+        m_IsRunningJob(false)
+    {
+        //Start the background thread, it waits until there is a job to run
+        m_Thread = thread(&LevelAutosave::RunBackgroundThread, this);
+    }
+
+    LevelAutosave::~LevelAutosave()
+    {
+        //Compact the journals so the level files are up to date
+        Flush();
+
+        //Stop the background thread and wait for it to finish
+        {
+            lock_guard<mutex> lock(m_Mutex);
+            m_IsRunning = false;
+        }
+        m_JobCondition.notify_one();
+        m_Thread.join();
+    }
+
+    void LevelAutosave::Update(double aDelta)
+    {
+        for (unsigned int i = 0; i < m_Entries.size(); i++)
+        {
+            LevelAutosaveEntry& entry = m_Entries.at(i);
+
+            //Only compare the tiles if the SubSection has changed
+            if (entry.subSection->GetRevision() != entry.revision)
+            {
+                JournalChanges(entry);
+            }
+
+            //Compact the journal once it has been around long enough
+            if (entry.hasJournal == true)
+            {
+                entry.journalElapsed += aDelta;
+                if (entry.journalElapsed >= LEVEL_AUTOSAVE_COMPACT_INTERVAL)
+                {
+                    QueueCompact(entry);
+                }
+            }
+        }
+
+        //Report the files the background thread failed to write
+        lock_guard<mutex> lock(m_Mutex);
+        for (unsigned int i = 0; i < m_FailedFilenames.size(); i++)
+        {
+            Error(false, "Failed to autosave: %s", m_FailedFilenames.at(i).c_str());
+        }
+        m_FailedFilenames.clear();
+    }
+
+    unsigned int LevelAutosave::Recover(SubSection* aSubSection, const string& aFilename)
+    {
+        //The background thread could still be writing to the journal
+        WaitForJobs();
+
+        //Open the journal, if there isn't one there is nothing to recover
+        ifstream inputStream;
+        inputStream.open(aFilename + LEVEL_AUTOSAVE_JOURNAL_EXTENSION, ifstream::in | ifstream::binary);
+        if (inputStream.is_open() == false)
+        {
+            return 0;
+        }
+
+        //Apply the records in the order they were journaled, stop at a record that wasn't fully written
+        unsigned int recovered = 0;
+        LevelAutosaveRecord record;
+        while (inputStream.read((char*)&record, sizeof(LevelAutosaveRecord)))
+        {
+            if (record.check != (record.index ^ record.saveData ^ LEVEL_AUTOSAVE_RECORD_CHECK) || record.index >= aSubSection->GetNumberOfTiles())
+            {
+                break;
+            }
+
+            aSubSection->SetSaveDataAtIndex(record.index, record.saveData);
+            recovered++;
+        }
+        inputStream.close();
+
+        Log(VerbosityLevel_Debug, "Recovered %u tiles from the autosave journal: %s", recovered, aFilename.c_str());
+        return recovered;
+    }
+
+    void LevelAutosave::Track(SubSection* aSubSection, const string& aFilename)
+    {
+        //Is the SubSection already tracked with the filename
+        unsigned int index = GetIndexForSubSection(aSubSection);
+        if (index < m_Entries.size())
+        {
+            if (m_Entries.at(index).filename == aFilename)
+            {
+                return;
+            }
+            Untrack(aSubSection);
+        }
+
+        //What has been journaled starts as the SubSection's current tiles
+        LevelAutosaveEntry entry;
+        entry.subSection = aSubSection;
+        entry.filename = aFilename;
+        entry.revision = aSubSection->GetRevision();
+        entry.saveData.resize(aSubSection->GetNumberOfTiles());
+        for (unsigned int i = 0; i < entry.saveData.size(); i++)
+        {
+            entry.saveData.at(i) = aSubSection->GetSaveDataForIndex(i);
+        }
+
+        //A journal that is left from a crash was recovered into the SubSection, it still needs to be compacted
+        entry.hasJournal = ServiceLocator::GetPlatformLayer()->DoesFileExistAtPath(aFilename + LEVEL_AUTOSAVE_JOURNAL_EXTENSION);
+        entry.journalElapsed = 0.0;
+        m_Entries.push_back(entry);
+    }
+
+    void LevelAutosave::Untrack(SubSection* aSubSection)
+    {
+        unsigned int index = GetIndexForSubSection(aSubSection);
+        if (index < m_Entries.size())
+        {
+            //Compact the SubSection's last changes into its file
+            LevelAutosaveEntry& entry = m_Entries.at(index);
+            JournalChanges(entry);
+            if (entry.hasJournal == true)
+            {
+                QueueCompact(entry);
+            }
+
+            m_Entries.erase(m_Entries.begin() + index);
+        }
+    }
+
+    void LevelAutosave::MarkSaved(SubSection* aSubSection)
+    {
+        unsigned int index = GetIndexForSubSection(aSubSection);
+        if (index < m_Entries.size())
+        {
+            //The level file has every tile, the journal starts over from the saved tiles
+            LevelAutosaveEntry& entry = m_Entries.at(index);
+            entry.revision = aSubSection->GetRevision();
+            for (unsigned int i = 0; i < entry.saveData.size(); i++)
+            {
+                entry.saveData.at(i) = aSubSection->GetSaveDataForIndex(i);
+            }
+            entry.hasJournal = false;
+            entry.journalElapsed = 0.0;
+
+            //Delete the journal, after any of its appends that are still queued
+            LevelAutosaveJob job;
+            job.type = LevelAutosaveJobClearJournal;
+            job.filename = entry.filename;
+            QueueJob(job);
+        }
+    }
+
+    void LevelAutosave::Flush()
+    {
+        for (unsigned int i = 0; i < m_Entries.size(); i++)
+        {
+            JournalChanges(m_Entries.at(i));
+            if (m_Entries.at(i).hasJournal == true)
+            {
+                QueueCompact(m_Entries.at(i));
+            }
+        }
+
+        WaitForJobs();
+    }
+
+    void LevelAutosave::JournalChanges(LevelAutosaveEntry& aEntry)
+    {
+        //Find the tiles whose saved value has changed since the last journal
+        LevelAutosaveJob job;
+        job.type = LevelAutosaveJobAppend;
+        job.filename = aEntry.filename;
+        for (unsigned int i = 0; i < aEntry.saveData.size(); i++)
+        {
+            unsigned short saveData = aEntry.subSection->GetSaveDataForIndex(i);
+            if (saveData != aEntry.saveData.at(i))
+            {
+                aEntry.saveData.at(i) = saveData;
+
+                LevelAutosaveRecord record;
+                record.index = (unsigned short)i;
+                record.saveData = saveData;
+                record.check = record.index ^ record.saveData ^ LEVEL_AUTOSAVE_RECORD_CHECK;
+                job.records.push_back(record);
+            }
+        }
+        aEntry.revision = aEntry.subSection->GetRevision();
+
+        //The revision can change without a saved value changing (a pickup for example)
+        if (job.records.size() > 0)
+        {
+            //The compact interval starts with the journal's first record
+            if (aEntry.hasJournal == false)
+            {
+                aEntry.hasJournal = true;
+                aEntry.journalElapsed = 0.0;
+            }
+            QueueJob(job);
+        }
+    }
+
+    void LevelAutosave::QueueCompact(LevelAutosaveEntry& aEntry)
+    {
+        LevelAutosaveJob job;
+        job.type = LevelAutosaveJobCompact;
+        job.filename = aEntry.filename;
+        job.saveData = aEntry.saveData;
+        QueueJob(job);
+
+        aEntry.hasJournal = false;
+        aEntry.journalElapsed = 0.0;
+    }
+
+    void LevelAutosave::QueueJob(LevelAutosaveJob& aJob)
+    {
+        {
+            lock_guard<mutex> lock(m_Mutex);
+            m_Jobs.push_back(LevelAutosaveJob());
+            m_Jobs.back().type = aJob.type;
+            m_Jobs.back().filename.swap(aJob.filename);
+            m_Jobs.back().records.swap(aJob.records);
+            m_Jobs.back().saveData.swap(aJob.saveData);
+        }
+        m_JobCondition.notify_one();
+    }
+
+    void LevelAutosave::WaitForJobs()
+    {
+        unique_lock<mutex> lock(m_Mutex);
+        while (m_Jobs.size() > 0 || m_IsRunningJob == true)
+        {
+            m_IdleCondition.wait(lock);
+        }
+    }
+
+    void LevelAutosave::RunBackgroundThread()
+    {
+        unique_lock<mutex> lock(m_Mutex);
+        while (true)
+        {
+            //Wait for a job, or for the autosave to stop
+            while (m_Jobs.size() == 0 && m_IsRunning == true)
+            {
+                m_JobCondition.wait(lock);
+            }
+
+            //The queue is always emptied before the thread stops
+            if (m_Jobs.size() == 0)
+            {
+                break;
+            }
+
+            //Take the next job, the file operations run without the lock so the editor can keep queueing jobs
+            LevelAutosaveJob job;
+            job.type = m_Jobs.front().type;
+            job.filename.swap(m_Jobs.front().filename);
+            job.records.swap(m_Jobs.front().records);
+            job.saveData.swap(m_Jobs.front().saveData);
+            m_Jobs.pop_front();
+            m_IsRunningJob = true;
+
+            lock.unlock();
+            bool success = RunJob(job);
+            lock.lock();
+
+            //The failed filenames are reported on the editor's thread
+            if (success == false)
+            {
+                m_FailedFilenames.push_back(job.filename);
+            }
+            m_IsRunningJob = false;
+            m_IdleCondition.notify_all();
+        }
+    }
+
+    bool LevelAutosave::RunJob(LevelAutosaveJob& aJob)
+    {
+        string journalFilename = aJob.filename + LEVEL_AUTOSAVE_JOURNAL_EXTENSION;
+        switch (aJob.type)
+        {
+        case LevelAutosaveJobAppend:
+        {
+            //Add the records to the end of the journal
+            ofstream outputStream;
+            outputStream.open(journalFilename, ofstream::out | ofstream::binary | ofstream::app);
+            if (outputStream.is_open() == false)
+            {
+                return false;
+            }
+            outputStream.write((const char*)aJob.records.data(), aJob.records.size() * sizeof(LevelAutosaveRecord));
+            outputStream.close();
+            return outputStream.fail() == false;
+        }
+
+        case LevelAutosaveJobCompact:
+        {
+            //Replace the level file, the journal is only deleted once the level file has every journaled tile
+            if (SubSection::WriteSaveData(aJob.filename, aJob.saveData.data(), (unsigned int)aJob.saveData.size()) == false)
+            {
+                return false;
+            }
+            remove(journalFilename.c_str());
+            return true;
+        }
+
+        case LevelAutosaveJobClearJournal:
+            remove(journalFilename.c_str());
+            return true;
+
+        default:
+            break;
+        }
+
+        return false;
+    }
+
+    unsigned int LevelAutosave::GetIndexForSubSection(SubSection* aSubSection)
+    {
+        for (unsigned int i = 0; i < m_Entries.size(); i++)
+        {
+            if (m_Entries.at(i).subSection == aSubSection)
+            {
+                return i;
+            }
+        }
+        return (unsigned int)m_Entries.size();
+    }
+}
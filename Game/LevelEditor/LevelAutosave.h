@@ -0,0 +1,144 @@
+/*******************************************************************
+LevelAutosave.h
+
+Purpose:
+The level autosave journals the Level Editor's tile changes to an
+append-only file next to each level file, so that a crash doesn't lose
+the edits made since the last save. Every few seconds the journal is
+compacted into the level file, the level is written to a temporary file
+that then replaces it. The files are written on a background thread so
+that autosaving never blocks the editor's frame. When a level is loaded
+the edits left in its journal are recovered.
+*********************************************************************/
+
+#ifndef __GameDev2D__LevelAutosave__
+#define __GameDev2D__LevelAutosave__
+
+#include "../../Source/Core/BaseObject.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+
+namespace GameDev2D
+{
+    //Local constants
+    const string LEVEL_AUTOSAVE_JOURNAL_EXTENSION = ".journal";
+    const double LEVEL_AUTOSAVE_COMPACT_INTERVAL = 10.0;
+    const unsigned short LEVEL_AUTOSAVE_RECORD_CHECK = 0xA5A5;
+
+    //Forward declarations
+    class SubSection;
+
+    //A journaled tile, the saved value is the same 16-bit value the level file stores for the tile.
+    //The check value lets recovery stop at a record that was only partially written
+    struct LevelAutosaveRecord
+    {
+        unsigned short index;
+        unsigned short saveData;
+        unsigned short check;
+    };
+
+    //The types of file operations that the background thread runs
+    enum LevelAutosaveJobType
+    {
+        LevelAutosaveJobAppend = 0,
+        LevelAutosaveJobCompact,
+        LevelAutosaveJobClearJournal
+    };
+
+    //A file operation for the background thread, an append job has the records to add to
+    //the journal, a compact job has the saved value of every tile in the level
+    struct LevelAutosaveJob
+    {
+        LevelAutosaveJobType type;
+        string filename;
+        vector<LevelAutosaveRecord> records;
+        vector<unsigned short> saveData;
+    };
+
+    //A SubSection that is being autosaved, the saved values are what has been journaled so far
+    struct LevelAutosaveEntry
+    {
+        SubSection* subSection;
+        string filename;
+        unsigned int revision;
+        vector<unsigned short> saveData;
+        bool hasJournal;
+        double journalElapsed;
+    };
+
+    /***************************************************************
+    Class: LevelAutosave
+    A SubSection is autosaved once it is tracked with the filename it was
+    loaded from or saved to. Update() compares the tracked SubSections
+    against what has been journaled, only when their revision changes, and
+    queues the changed tiles for the background thread. The jobs run in the
+    order they are queued, so a compaction always has every edit that was
+    journaled before it. Only the file operations run on the background thread.
+    ***************************************************************/
+    class LevelAutosave : public BaseObject
+    {
+    public:
+        LevelAutosave();
+        ~LevelAutosave();
+
+        //Journals the tracked SubSections' changes and compacts the journals that are old enough, called every frame
+        void Update(double delta);
+
+        //Applies the edits in the filename's journal to the SubSection, call it right after the SubSection is loaded.
+        //Returns the number of tiles that were recovered
+        unsigned int Recover(SubSection* subSection, const string& filename);
+
+        //Starts autosaving the SubSection to the filename, if the SubSection was tracked with another filename its
+        //changes are compacted into that file first
+        void Track(SubSection* subSection, const string& filename);
+
+        //Stops autosaving the SubSection, its changes are compacted into its file first. Call it before the SubSection is deleted or reloaded
+        void Untrack(SubSection* subSection);
+
+        //Call this after the SubSection has been saved to its file, its journal is no longer needed
+        void MarkSaved(SubSection* subSection);
+
+        //Compacts every journal that has changes into its level file, and waits for the background thread to write them
+        void Flush();
+
+        //Waits for the background thread to finish every queued job. Call it before a SubSection is saved, otherwise a compaction
+        //that was queued with older tiles could replace the saved file after it has been written
+        void WaitForJobs();
+
+    private:
+        //Journals the tiles that changed since the entry's last journal
+        void JournalChanges(LevelAutosaveEntry& entry);
+
+        //Queues a compact job with the entry's saved values
+        void QueueCompact(LevelAutosaveEntry& entry);
+
+        //Adds a job to the background thread's queue
+        void QueueJob(LevelAutosaveJob& job);
+
+        //The background thread's loop, runs the queued jobs until the autosave is deleted
+        void RunBackgroundThread();
+
+        //Runs a job's file operations, returns false if a file couldn't be written
+        bool RunJob(LevelAutosaveJob& job);
+
+        //Returns the index of the SubSection's entry, returns the number of entries if it isn't tracked
+        unsigned int GetIndexForSubSection(SubSection* subSection);
+
+        //Member variables
+        vector<LevelAutosaveEntry> m_Entries;
+
+        //Background thread variables, the mutex guards the job queue, the flags and the failed filenames
+        thread m_Thread;
+        mutex m_Mutex;
+        condition_variable m_JobCondition;
+        condition_variable m_IdleCondition;
+        deque<LevelAutosaveJob> m_Jobs;
+        vector<string> m_FailedFilenames;
+        bool m_IsRunning;
+        bool m_IsRunningJob;
+    };
+}
+
+#endif /* defined(__GameDev2D__LevelAutosave__) */
@@ -12,10 +12,23 @@ _______________________________________________
 -Added  background music to LevelEditor.cpp.
 -A random song is played when the Level Editor is started.
 -When quitting level editor the game will now push a new main menu instead of just popping te previous one. Since this preventd the animations from playing.
+-The tile buttons use the tile type behaviour table for their atlas keys, instead of creating a Tile object for each tile type.
+-Added an undo and redo history (Ctrl+Z, Ctrl+Y or Ctrl+Shift+Z), a brush stroke, a spawn point change and a clear are each one undoable edit.
+-Added a World button that switches to the world editor view, the whole world can be painted at once. The view is zoomed with the
+mouse wheel and panned with the arrow keys or by dragging with the right mouse button.
+-Added fill (F), rectangle (R, press again for a filled rectangle) and line (L) tools, brush is B. The tiles a tool affects are
+calculated first and then set in one batch per sub-section as a single undoable edit.
+-Added an autosave, the tile changes are journaled in the background and compacted into the level files every few seconds.
+-The saved world is validated after every save (and with the V key), the issues found are logged.
+-The Level Editor can be preloaded in the background, the main atlas is decoded on a worker thread and the music only starts once the Level Editor transitions on.
 */
 
 #include "LevelEditor.h"
 #include "SubSectionMenu.h"
+#include "TileEditLog.h"
+#include "WorldEditorView.h"
+#include "LevelAutosave.h"
+#include "LevelValidator.h"
 #include "../SubSection.h"
 #include "../World.h"
 #include "../../Source/Services/ServiceLocator.h"
@@ -32,12 +45,23 @@ namespace GameDev2D
     LevelEditor::LevelEditor() : Scene("LevelEditor"),
         m_SubSectionMenu(nullptr),
         m_EditingSubSection(nullptr),
+        m_TileEditLog(nullptr),
+        m_Autosave(nullptr),
+        m_Validator(nullptr),
         m_SelectedTile(nullptr),
         m_TileData(nullptr),
         m_SpawnPointButton(nullptr),
         m_SaveButton(nullptr),
         m_LoadButton(nullptr),
         m_ClearButton(nullptr),
+        m_WorldButton(nullptr),
+        m_WorldEditorView(nullptr),
+        m_IsEditingWorld(false),
+        m_PreviousMousePosition(0.0f, 0.0f),
+        m_Tool(LevelEditorToolBrush),
+        m_IsToolDragging(false),
+        m_ToolStart(0, 0),
+        m_ToolEnd(0, 0),
         m_SelectedIndex(-1),
         m_SpawnPointVariant(0),
         m_PickUpVariant(0),
@@ -56,13 +80,18 @@ namespace GameDev2D
         {
             for (unsigned int i = 0; i < LEVEL_EDITOR_NUMBER_OF_TILES; i++)
             {
-                SafeDelete(m_TileData[i]->tile);
                 SafeDelete(m_TileData[i]);
             }
             SafeDeleteArray(m_TileData);
         }
 
         SafeDelete(m_SubSectionMenu);
+
+        //The world editor view and the autosave compact the last changes into the level files, before the sub-sections are deleted
+        SafeDelete(m_WorldEditorView);
+        SafeDelete(m_Autosave);
+        SafeDelete(m_Validator);
+        SafeDelete(m_TileEditLog);
         SafeDelete(m_EditingSubSection);
 
         //Delete audio variables
@@ -72,6 +101,13 @@ namespace GameDev2D
 
     float LevelEditor::LoadContent()
     {
+        //Preload the main atlas, the buttons and tiles are only created once it has been decoded on a worker thread
+        ServiceLocator::GetTextureManager()->PreloadTexture("MainAtlas", "Images/");
+        if (ServiceLocator::GetTextureManager()->IsTexturePreloading("MainAtlas") == true)
+        {
+            return 0.0f;
+        }
+
         switch (m_LoadStep)
         {
         case LevelEditorLoadRequired:
@@ -103,6 +139,13 @@ namespace GameDev2D
         {
             //Load the sub-section - by default an empty subsection is loaded
             m_EditingSubSection = new SubSection(this, "");
+
+            //Load the autosave, the sub-section is autosaved once it has been loaded from or saved to a file
+            m_Autosave = new LevelAutosave();
+            m_Validator = new LevelValidator();
+
+            //Load the edit history for the sub-section
+            m_TileEditLog = new TileEditLog(&m_EditingSubSection, 1, m_EditingSubSection->GetNumberOfTiles());
         }
         break;
 
@@ -114,21 +157,15 @@ namespace GameDev2D
             //Cycle through and load the Level Editor buttons
             for (unsigned int i = 0; i < LEVEL_EDITOR_NUMBER_OF_TILES; i++)
             {
-                //Create a tile for the tile type
-                Tile* tile = m_EditingSubSection->CreateTile(LEVEL_EDITOR_TILE_TYPES[i], 0, uvec2(0, 0));
-
-                //Get the atlas key for the button's image
-                string atlasKey = "";
-                if (tile != nullptr)
-                {
-                    tile->GetAtlasKeyForVariant(0, atlasKey);
-                }
+                //Get the atlas key of the tile type's first variant for the button's image
+                const TileTypeBehaviour& behaviour = Tile::GetBehaviourForTileType(LEVEL_EDITOR_TILE_TYPES[i]);
+                string atlasKey = behaviour.atlasKeys[0];
 
                 //Load a button with the atlas key, and the current label text
                 Button* button = LoadButton(i, LEVEL_EDITOR_TILE_BUTTON_TEXT[i], atlasKey, true);
 
-                //Create a Tile Data object, with the button and tile
-                m_TileData[i] = new TileData(button, tile);
+                //Create a Tile Data object, with the button and tile type
+                m_TileData[i] = new TileData(button, LEVEL_EDITOR_TILE_TYPES[i]);
             }
 
             //Load the 'utility' buttons
@@ -136,25 +173,30 @@ namespace GameDev2D
             m_SaveButton = LoadButton(LEVEL_EDITOR_NUMBER_OF_TILES + 1, "Save", "ButtonOutline", false);
             m_LoadButton = LoadButton(LEVEL_EDITOR_NUMBER_OF_TILES + 2, "Load", "ButtonOutline", false);
             m_ClearButton = LoadButton(LEVEL_EDITOR_NUMBER_OF_TILES + 3, "Clear", "ButtonOutline", false);
+            m_WorldButton = LoadButton(LEVEL_EDITOR_NUMBER_OF_TILES + 4, "World", "ButtonOutline", true);
         }
         break;
 
         case LevelEditorLoadSubSectionMenu:
         {
-            //Load the subsection menu and preload it
+            //Load the subsection menu, the SceneManager preloads it
             m_SubSectionMenu = new SubSectionMenu(this);
             ServiceLocator::GetSceneManager()->PreloadScene(m_SubSectionMenu);
         }
         break;
 
+        case LevelEditorLoadWorldEditorView:
+        {
+            //Load the world editor view, its subsections are only loaded once they are in view
+            m_WorldEditorView = new WorldEditorView(this);
+        }
+        break;
+
         case LevelEditorLoadMusic:
         {
-            //Create the random number generator object, for random music
+            //Create the random number generator object, for random music, the music starts playing once the level editor transitions on
             m_Random = new Random();
             m_Random->RandomizeSeed();
-
-            //Pick a random music to play
-            pickRandomMusic();
         }
         break;
 
@@ -165,10 +207,28 @@ namespace GameDev2D
         //Increment the load step
         m_LoadStep++;
 
+        //The level editor isn't loaded until the subsection menu is loaded as well
+        if (m_LoadStep >= LevelEditorLoadStepCount && ServiceLocator::GetSceneManager()->IsSceneLoaded(m_SubSectionMenu) == false)
+        {
+            return (float)(LevelEditorLoadStepCount - 1) / (float)LevelEditorLoadStepCount;
+        }
+
         //Return the percentage loaded
         return (float)m_LoadStep / (float)LevelEditorLoadStepCount;
     }
 
+    void LevelEditor::WillTransitionOn()
+    {
+        //The buttons are disabled while the level editor is preloaded behind the main menu, enable them now that it is on screen
+        EnableButtons();
+
+        //Pick a random music to play, unless the music is already playing
+        if (m_BackgroundMusic == nullptr)
+        {
+            pickRandomMusic();
+        }
+    }
+
     void LevelEditor::Update(double aDelta)
     {
         //Check if we want to change music
@@ -181,20 +241,44 @@ namespace GameDev2D
 
         }
 
-        if (m_EditingSubSection != nullptr)
+        //Advance the shared tile animation clock
+        Tile::UpdateAnimationClock(aDelta);
+
+        if (m_IsEditingWorld == true)
+        {
+            m_WorldEditorView->Update(aDelta);
+        }
+        else if (m_EditingSubSection != nullptr)
         {
             m_EditingSubSection->Update(aDelta);
         }
+
+        //Journal the changes, the files are written in the background
+        if (m_Autosave != nullptr)
+        {
+            m_Autosave->Update(aDelta);
+        }
         Scene::Update(aDelta);
     }
 
     void LevelEditor::Draw()
     {
-        if (m_EditingSubSection != nullptr)
+        //The world editor view draws through its own camera, the buttons are drawn over top of it
+        if (m_IsEditingWorld == true)
+        {
+            m_WorldEditorView->Draw();
+        }
+        else if (m_EditingSubSection != nullptr)
         {
             m_EditingSubSection->Draw();
         }
 
+        //Draw the preview of the rectangle or line being dragged, with the selection sprite
+        if (m_IsToolDragging == true && m_ToolPreviewPositions.size() > 0)
+        {
+            m_SelectedTile->DrawBatch(m_ToolPreviewPositions, m_ToolPreviewAngles);
+        }
+
         Scene::Draw();
     }
 
@@ -220,6 +304,10 @@ namespace GameDev2D
             {
                 Clear();
             }
+            else if (button == m_WorldButton)
+            {
+                SetIsEditingWorld(button->GetState() == ButtonStateSelected);
+            }
             else
             {
                 //De-select the previously selected button
@@ -263,36 +351,88 @@ namespace GameDev2D
         case MOUSE_CLICK_EVENT:
         {
             MouseClickEvent* clickEvent = (MouseClickEvent*)aEvent;
-            if (clickEvent->GetMouseClickEventType() == MouseClickDown && clickEvent->GetMouseButton() == MouseButtonLeft)
+            if (clickEvent->GetMouseClickEventType() == MouseClickUp && clickEvent->GetMouseButton() == MouseButtonLeft)
+            {
+                //The rectangle or line is done being dragged, set all of its tiles at once
+                if (m_IsToolDragging == true)
+                {
+                    m_IsToolDragging = false;
+                    RefreshToolPreview();
+                    ApplyTool(m_ToolTiles);
+                    m_ToolPreviewPositions.clear();
+                    m_ToolPreviewAngles.clear();
+                }
+
+                //The brush stroke is over, all the tiles changed during it are one undoable edit
+                if (GetActiveTileEditLog() != nullptr)
+                {
+                    GetActiveTileEditLog()->EndCommand();
+                }
+            }
+            else if (clickEvent->GetMouseClickEventType() == MouseClickDown && clickEvent->GetMouseButton() == MouseButtonLeft)
             {
-                //Change the tile type at the mouse position
-                if (m_SelectedIndex == 0)
+                //Start a new brush stroke and change the tile type at the mouse position
+                ivec2 coordinates;
+                if (m_SelectedIndex >= 0 && m_Tool == LevelEditorToolBrush)
                 {
+                    GetActiveTileEditLog()->BeginCommand();
                     ChangeTileType(LEVEL_EDITOR_TILE_TYPES[m_SelectedIndex], clickEvent->GetPosition());
                 }
+                else if (m_SelectedIndex >= 0 && GetTileCoordinatesForScreenPosition(clickEvent->GetPosition(), coordinates) == true)
+                {
+                    if (m_Tool == LevelEditorToolFill)
+                    {
+                        //Fill the tiles connected to the clicked tile
+                        GetTilesForFloodFill(coordinates, m_ToolTiles);
+                        ApplyTool(m_ToolTiles);
+                    }
+                    else
+                    {
+                        //Start dragging the rectangle or line
+                        m_IsToolDragging = true;
+                        m_ToolStart = coordinates;
+                        m_ToolEnd = coordinates;
+                        RefreshToolPreview();
+                    }
+                }
                 else if (m_SelectedIndex == LEVEL_EDITOR_SPAWN_POINT_INDEX)
                 {
-                    //Get the position of the click event
-                    vec2 position = clickEvent->GetPosition();
-
-                    //Ensure the mouse's position is within the level editor's tiles area
-                    if (position.x >= 0.0f && position.x < GetNumberOfHorizontalTiles() * GetTileSize() && position.y >= 0.0f && position.y < GetNumberOfVerticalTiles() * GetTileSize())
+                    //Get the subsection under the click event, it is null if the click is outside the level editor's tiles area
+                    vec2 position;
+                    SubSection* subSection = GetSubSectionForScreenPosition(clickEvent->GetPosition(), position);
+                    if (subSection != nullptr)
                     {
                         //Get the tile for the position
-                        Tile* tile = m_EditingSubSection->GetTileForPosition(position);
+                        Tile* tile = subSection->GetTileForPosition(position);
 
                         //Based on the current spawn point variant set the subsection spawn point at the mouse click location
                         if (tile->IsWalkable() == true)//Checks if the tile is walkable before spawning and object in it
                         {
+                            //The spawn point change is its own undoable edit, record the tile before it changes
+                            TileEditLog* tileEditLog = GetActiveTileEditLog();
+                            tileEditLog->BeginCommand();
+                            tileEditLog->TouchTile(subSection, tile->GetIndex());
+
                             if (m_SpawnPointVariant == 0)//Hero spawn
                             {
-                                m_EditingSubSection->SetHeroSpawnPointForTile(tile);
+                                //Setting the hero spawn point removes the previous one, record that tile as well
+                                for (unsigned int i = 0; i < subSection->GetNumberOfTiles(); i++)
+                                {
+                                    if (subSection->IsHeroSpawnPointAtIndex(i) == true)
+                                    {
+                                        tileEditLog->TouchTile(subSection, i);
+                                    }
+                                }
+
+                                subSection->SetHeroSpawnPointForTile(tile);
                             }
                             else if (m_SpawnPointVariant == 1)//Enemy Spawn
                             {
                                 //tile->SetIsEnemySpawnPoint(!tile->IsEnemySpawnPoint());
-                                m_EditingSubSection->SetEnemySpawnPoint(tile);
+                                subSection->SetEnemySpawnPoint(tile);
                             }
+
+                            tileEditLog->EndCommand();
                         }
                     }
                 }
@@ -305,38 +445,72 @@ namespace GameDev2D
         {
             //Get the position of the mouse cursor
             MouseMovementEvent* moveEvent = (MouseMovementEvent*)aEvent;
-            vec2 position = moveEvent->GetPosition();
+            vec2 screenPosition = moveEvent->GetPosition();
 
-            //Safety check the sub-section pointer
-            if (m_EditingSubSection != nullptr)
+            //When editing the world, dragging with the right mouse button pans the view. The delta is calculated
+            //from the previous position, not every platform sets the event's delta position
+            if (m_IsEditingWorld == true && ServiceLocator::GetInputManager()->IsMouseButtonPressed(MouseButtonRight) == true)
             {
-                //Safety check that the mouse is on screen
-                if (position.x >= 0.0f && position.x < GetTileSize() * GetNumberOfHorizontalTiles() && position.y >= 0.0f && position.y < GetTileSize() * GetNumberOfVerticalTiles())
-                {
-                    //Get the Tile for the mouse cursor position and get the center of the Tile
-                    Tile* tile = m_EditingSubSection->GetTileForPosition(position);
-                    vec2 center = tile->GetCenter(true);
+                m_WorldEditorView->Pan(screenPosition - m_PreviousMousePosition);
+            }
+            m_PreviousMousePosition = screenPosition;
 
-                    //Set the position of the selection tile sprite
+            //Get the sub-section under the mouse cursor, it is null if the mouse is off the tile area
+            vec2 position;
+            SubSection* subSection = GetSubSectionForScreenPosition(screenPosition, position);
+            if (subSection != nullptr)
+            {
+                //Get the Tile for the mouse cursor position and get the center of the Tile
+                Tile* tile = subSection->GetTileForPosition(position);
+                vec2 center = tile->GetCenter(true);
+
+                //Set the position of the selection tile sprite, when editing the world the sprite is scaled by the view's zoom
+                if (m_IsEditingWorld == true)
+                {
+                    m_SelectedTile->SetLocalPosition(m_WorldEditorView->GetScreenPositionForWorldPosition(center));
+                    m_SelectedTile->SetLocalScale(m_WorldEditorView->GetZoom(), m_WorldEditorView->GetZoom());
+                }
+                else
+                {
                     m_SelectedTile->SetLocalPosition(center);
-                    m_SelectedTile->SetIsEnabled(true);
+                }
+                m_SelectedTile->SetIsEnabled(true);
 
-                    //If the left mouse button is down then we can also change the tile type
-                    bool isMouseDown = ServiceLocator::GetInputManager()->IsMouseButtonPressed(MouseButtonLeft);
-                    if (isMouseDown == true)
+                //If the left mouse button is down then we can also change the tile type
+                bool isMouseDown = ServiceLocator::GetInputManager()->IsMouseButtonPressed(MouseButtonLeft);
+                if (isMouseDown == true)
+                {
+                    if (m_SelectedIndex >= 0 && m_Tool == LevelEditorToolBrush)
                     {
-                        if (m_SelectedIndex >= 0)
-                        {
-                            ChangeTileType(LEVEL_EDITOR_TILE_TYPES[m_SelectedIndex], position);
-                        }
+                        ChangeTileType(LEVEL_EDITOR_TILE_TYPES[m_SelectedIndex], screenPosition);
                     }
                 }
-                else
+
+                //Drag the end of the rectangle or line to the tile under the mouse cursor
+                ivec2 coordinates;
+                if (m_IsToolDragging == true && GetTileCoordinatesForScreenPosition(screenPosition, coordinates) == true && coordinates != m_ToolEnd)
                 {
-                    //If the mouse cursor is off-screen, disable the selected tile sprite
-                    m_SelectedTile->SetIsEnabled(false);
+                    m_ToolEnd = coordinates;
+                    RefreshToolPreview();
                 }
             }
+            else
+            {
+                //If the mouse cursor is off-screen, disable the selected tile sprite
+                m_SelectedTile->SetIsEnabled(false);
+            }
+        }
+        break;
+
+        case MOUSE_WHEEL_EVENT:
+        {
+            //When editing the world, the mouse wheel zooms the view in and out around the mouse cursor
+            if (m_IsEditingWorld == true)
+            {
+                MouseScrollWheelEvent* scrollEvent = (MouseScrollWheelEvent*)aEvent;
+                m_WorldEditorView->Zoom(scrollEvent->GetDetla(), ServiceLocator::GetInputManager()->GetMousePosition());
+                m_SelectedTile->SetIsEnabled(false);
+            }
         }
         break;
 
@@ -376,6 +550,45 @@ namespace GameDev2D
                     }
 
                 }
+                else if (keyEvent->GetKeyCode() == KEY_CODE_V)
+                {
+                    ValidateWorld();
+                }
+                else if (keyEvent->GetKeyCode() == KEY_CODE_B)
+                {
+                    SetTool(LevelEditorToolBrush);
+                }
+                else if (keyEvent->GetKeyCode() == KEY_CODE_F)
+                {
+                    SetTool(LevelEditorToolFill);
+                }
+                else if (keyEvent->GetKeyCode() == KEY_CODE_R)
+                {
+                    //Pressing R again toggles between an outlined and a filled rectangle
+                    SetTool(m_Tool == LevelEditorToolRectangle ? LevelEditorToolFilledRectangle : LevelEditorToolRectangle);
+                }
+                else if (keyEvent->GetKeyCode() == KEY_CODE_L)
+                {
+                    SetTool(LevelEditorToolLine);
+                }
+                else if (keyEvent->GetKeyCode() == KEY_CODE_Z && IsShortcutModifierPressed() == true)
+                {
+                    //Ctrl+Shift+Z is also redo
+                    InputManager* inputManager = ServiceLocator::GetInputManager();
+                    bool isShiftPressed = inputManager->IsKeyPressed(KEY_CODE_LEFT_SHIFT) == true || inputManager->IsKeyPressed(KEY_CODE_RIGHT_SHIFT) == true;
+                    if (isShiftPressed == true)
+                    {
+                        Redo();
+                    }
+                    else
+                    {
+                        Undo();
+                    }
+                }
+                else if (keyEvent->GetKeyCode() == KEY_CODE_Y && IsShortcutModifierPressed() == true)
+                {
+                    Redo();
+                }
                 else if (keyEvent->GetKeyCode() == KEY_CODE_0)
                 {
                     m_EditingSubSection->DisableDebugDrawing();
@@ -416,8 +629,38 @@ namespace GameDev2D
         return WORLD_NUMBER_OF_VERTICAL_TILES;
     }
 
+    void LevelEditor::ClearEditHistory()
+    {
+        if (m_TileEditLog != nullptr)
+        {
+            m_TileEditLog->ClearHistory();
+        }
+    }
+
+    LevelAutosave* LevelEditor::GetAutosave()
+    {
+        return m_Autosave;
+    }
+
+    unsigned int LevelEditor::ValidateWorld()
+    {
+        //Compact the autosave journals first, so the files have every change
+        m_Autosave->Flush();
+
+        unsigned int issues = m_Validator->ValidateFiles();
+        m_Validator->LogIssues();
+        return issues;
+    }
+
     void LevelEditor::Load()
     {
+        //The world editor view loads the subsections as they come into view
+        if (m_IsEditingWorld == true)
+        {
+            Log(VerbosityLevel_Debug, "Load is only available when editing a single sub-section");
+            return;
+        }
+
         if (m_SubSectionMenu != nullptr)
         {
             m_SubSectionMenu->Load(m_EditingSubSection);
@@ -426,6 +669,14 @@ namespace GameDev2D
 
     void LevelEditor::Save()
     {
+        //The world editor view knows which file each subsection belongs to
+        if (m_IsEditingWorld == true)
+        {
+            m_WorldEditorView->SaveModifiedSubSections();
+            ValidateWorld();
+            return;
+        }
+
         if (m_SubSectionMenu != nullptr)
         {
             m_SubSectionMenu->Save(m_EditingSubSection);
@@ -434,15 +685,113 @@ namespace GameDev2D
 
     void LevelEditor::Clear()
     {
+        if (m_IsEditingWorld == true)
+        {
+            Log(VerbosityLevel_Debug, "Clear is only available when editing a single sub-section");
+            return;
+        }
+
         if (m_EditingSubSection != nullptr)//Check there is a valid subsection
         {
+            //The whole clear is one undoable edit
+            m_TileEditLog->BeginCommand();
+
+            unsigned char groundTypeIndex = Tile::GetIndexForTileType(TileTypeGround);
             for (unsigned int i = 0; i < m_EditingSubSection->GetNumberOfTiles(); i++)//Go through al lthe tiles in the subsection
             {
+                //Skip the tiles that are already cleared, so that only the tiles that change are recorded and rebuilt
+                unsigned char typeIndex, variant, flags;
+                m_EditingSubSection->GetTileDataAtIndex(i, typeIndex, variant, flags);
+                if (typeIndex == groundTypeIndex && variant == 0 && (flags & (TileFlagHeroSpawnPoint | TileFlagEnemySpawnPoint)) == 0)
+                {
+                    continue;
+                }
+
+                m_TileEditLog->TouchTile(m_EditingSubSection, i);
                 m_EditingSubSection->SetTileTypeAtIndex(i, TileTypeGround, 0);//Set the tile to be the "common" ground type.
                 m_EditingSubSection->DeactivateSpawnPointsAtTileIndex(i);//Ensure that the tile doesn't have any spawn point
-                m_EditingSubSection->GetTileForIndex(i)->RemovePickup();//Remove any pick up from the tile
             }
+
+            m_TileEditLog->EndCommand();
+
+            //Remove any pick up from the tiles, pickups are not part of the edit history
+            for (unsigned int i = 0; i < m_EditingSubSection->GetNumberOfTiles(); i++)
+            {
+                SafeDelete(m_EditingSubSection->m_TilePickups[i]);
+            }
+        }
+    }
+
+    void LevelEditor::Undo()
+    {
+        if (GetActiveTileEditLog() != nullptr)
+        {
+            GetActiveTileEditLog()->Undo();
+        }
+    }
+
+    void LevelEditor::Redo()
+    {
+        if (GetActiveTileEditLog() != nullptr)
+        {
+            GetActiveTileEditLog()->Redo();
+        }
+    }
+
+    void LevelEditor::SetIsEditingWorld(bool aIsEditingWorld)
+    {
+        //Finish any open brush stroke before switching what is being edited
+        if (GetActiveTileEditLog() != nullptr)
+        {
+            GetActiveTileEditLog()->EndCommand();
+        }
+
+        m_IsEditingWorld = aIsEditingWorld && m_WorldEditorView != nullptr;
+
+        //The tile coordinates of a rectangle or line being dragged are no longer valid
+        m_IsToolDragging = false;
+        m_ToolPreviewPositions.clear();
+        m_ToolPreviewAngles.clear();
+
+        //The selection sprite is re-positioned on the next mouse movement
+        m_SelectedTile->SetIsEnabled(false);
+        m_SelectedTile->SetLocalScale(1.0f, 1.0f);
+    }
+
+    SubSection* LevelEditor::GetSubSectionForScreenPosition(vec2 aScreenPosition, vec2& aLocalPosition)
+    {
+        //Ensure the position is within the level editor's tiles area, the area above it has the buttons
+        if (aScreenPosition.x < 0.0f || aScreenPosition.x >= GetTileSize() * GetNumberOfHorizontalTiles() || aScreenPosition.y < 0.0f || aScreenPosition.y >= GetTileSize() * GetNumberOfVerticalTiles())
+        {
+            return nullptr;
+        }
+
+        //When editing the world, convert the screen position to a world position first
+        if (m_IsEditingWorld == true)
+        {
+            return m_WorldEditorView->GetSubSectionForWorldPosition(m_WorldEditorView->GetWorldPositionForScreenPosition(aScreenPosition), aLocalPosition);
         }
+
+        //The single subsection is drawn at the bottom left corner of the screen
+        aLocalPosition = aScreenPosition;
+        return m_EditingSubSection;
+    }
+
+    TileEditLog* LevelEditor::GetActiveTileEditLog()
+    {
+        if (m_IsEditingWorld == true)
+        {
+            return m_WorldEditorView->GetTileEditLog();
+        }
+        return m_TileEditLog;
+    }
+
+    bool LevelEditor::IsShortcutModifierPressed()
+    {
+        //The command key is the shortcut modifier on mac, control everywhere else
+        InputManager* inputManager = ServiceLocator::GetInputManager();
+        return inputManager->IsKeyPressed(KEY_CODE_LEFT_CTRL) == true || inputManager->IsKeyPressed(KEY_CODE_RIGHT_CTRL) == true ||
+               inputManager->IsKeyPressed(KEY_CODE_LEFT_COMMAND) == true || inputManager->IsKeyPressed(KEY_CODE_RIGHT_COMMAND) == true;
     }
 
     Button* LevelEditor::LoadButton(unsigned int aIndex, const string& aText, const string& aAtlasKey, bool aIsToggle)
@@ -455,6 +804,10 @@ namespace GameDev2D
         button->SetIsToggled(aIsToggle);
         button->AddEventListener(this, BUTTON_ACTION);
 
+        //The buttons listen for mouse clicks as soon as they are created, disable them until the level editor transitions on,
+        //otherwise a click on the main menu could select a tile or save the sub-section of a level editor that isn't on screen
+        button->SetIsEnabled(false);
+
         //Calculate the position of the button
         float screenWidth = (float)ServiceLocator::GetPlatformLayer()->GetWidth();
         float screenHeight = (float)ServiceLocator::GetPlatformLayer()->GetHeight();
@@ -469,21 +822,308 @@ namespace GameDev2D
         return (Button*)AddGameObject(button);
     }
 
+    void LevelEditor::EnableButtons()
+    {
+        //Safety check that the buttons have been loaded
+        if (m_TileData == nullptr)
+        {
+            return;
+        }
+
+        for (unsigned int i = 0; i < LEVEL_EDITOR_NUMBER_OF_TILES; i++)
+        {
+            m_TileData[i]->button->SetIsEnabled(true);
+        }
+        m_SpawnPointButton->SetIsEnabled(true);
+        m_SaveButton->SetIsEnabled(true);
+        m_LoadButton->SetIsEnabled(true);
+        m_ClearButton->SetIsEnabled(true);
+        m_WorldButton->SetIsEnabled(true);
+    }
+
     void LevelEditor::ChangeTileType(TileType aTileType, vec2 aPosition)
     {
-        //Safety check the sub-section pointer
-        if (m_EditingSubSection != nullptr)
+        //Get the sub-section under the position, safety check the sub-section pointer
+        vec2 position;
+        SubSection* subSection = GetSubSectionForScreenPosition(aPosition, position);
+        if (subSection != nullptr)
         {
             //Get the tile index for the position
-            unsigned int tileIndex = m_EditingSubSection->GetTileIndexForPosition(aPosition);
+            unsigned int tileIndex = subSection->GetTileIndexForPosition(position);
 
             //Get the tile variant
             unsigned int tileVariant = m_SelectedIndex >= 0 ? m_TileData[m_SelectedIndex]->tileVariant : 0;
 
+            //Record the tile in the brush stroke before it changes, if the stroke wasn't started by a click (the mouse
+            //was already down) start one now, it will end when the mouse button is released
+            TileEditLog* tileEditLog = GetActiveTileEditLog();
+            if (tileEditLog->IsCommandOpen() == false)
+            {
+                tileEditLog->BeginCommand();
+            }
+            tileEditLog->TouchTile(subSection, tileIndex);
+
             //Set the tile type at the tile index
-            m_EditingSubSection->SetTileTypeAtIndex(tileIndex, aTileType, tileVariant);
+            subSection->SetTileTypeAtIndex(tileIndex, aTileType, tileVariant);
         }
     }
+
+    void LevelEditor::SetTool(LevelEditorTool aTool)
+    {
+        //Cancel the rectangle or line being dragged
+        m_IsToolDragging = false;
+        m_ToolPreviewPositions.clear();
+        m_ToolPreviewAngles.clear();
+
+        m_Tool = aTool;
+        Log(VerbosityLevel_Debug, "Level editor tool: %s", LEVEL_EDITOR_TOOL_NAMES[m_Tool].c_str());
+    }
+
+    bool LevelEditor::GetTileCoordinatesForScreenPosition(vec2 aScreenPosition, ivec2& aCoordinates)
+    {
+        //Ensure the position is within the level editor's tiles area
+        if (aScreenPosition.x < 0.0f || aScreenPosition.x >= GetTileSize() * GetNumberOfHorizontalTiles() || aScreenPosition.y < 0.0f || aScreenPosition.y >= GetTileSize() * GetNumberOfVerticalTiles())
+        {
+            return false;
+        }
+
+        //When editing the world, the tile coordinates are for the world position under the mouse
+        vec2 position = aScreenPosition;
+        if (m_IsEditingWorld == true)
+        {
+            position = m_WorldEditorView->GetWorldPositionForScreenPosition(aScreenPosition);
+        }
+
+        //Ensure the tile coordinates are on an editable tile
+        aCoordinates = ivec2(floor(position / (float)GetTileSize()));
+        uvec2 numberOfTiles = GetNumberOfEditableTiles();
+        return aCoordinates.x >= 0 && aCoordinates.y >= 0 && aCoordinates.x < (int)numberOfTiles.x && aCoordinates.y < (int)numberOfTiles.y;
+    }
+
+    vec2 LevelEditor::GetScreenPositionForTileCoordinates(ivec2 aCoordinates)
+    {
+        //Get the center of the tile
+        vec2 center = (vec2(aCoordinates) + vec2(0.5f, 0.5f)) * (float)GetTileSize();
+        if (m_IsEditingWorld == true)
+        {
+            return m_WorldEditorView->GetScreenPositionForWorldPosition(center);
+        }
+        return center;
+    }
+
+    uvec2 LevelEditor::GetNumberOfEditableTiles()
+    {
+        uvec2 numberOfTiles = uvec2(GetNumberOfHorizontalTiles(), GetNumberOfVerticalTiles());
+        if (m_IsEditingWorld == true)
+        {
+            numberOfTiles *= WORLD_NUMBER_OF_SUBSECTIONS;
+        }
+        return numberOfTiles;
+    }
+
+    SubSection* LevelEditor::GetSubSectionForTileCoordinates(ivec2 aCoordinates, unsigned int& aIndex)
+    {
+        //Safety check the tile coordinates
+        uvec2 numberOfTiles = GetNumberOfEditableTiles();
+        if (aCoordinates.x < 0 || aCoordinates.y < 0 || aCoordinates.x >= (int)numberOfTiles.x || aCoordinates.y >= (int)numberOfTiles.y)
+        {
+            return nullptr;
+        }
+
+        //Get the subsection, and the tile coordinates within it
+        SubSection* subSection = m_EditingSubSection;
+        uvec2 coordinates = uvec2(aCoordinates);
+        if (m_IsEditingWorld == true)
+        {
+            uvec2 subSectionTiles = uvec2(GetNumberOfHorizontalTiles(), GetNumberOfVerticalTiles());
+            subSection = m_WorldEditorView->GetSubSectionForCoordinates(coordinates / subSectionTiles);
+            coordinates = coordinates % subSectionTiles;
+        }
+
+        if (subSection != nullptr)
+        {
+            aIndex = subSection->GetTileIndexForCoordinates(coordinates);
+        }
+        return subSection;
+    }
+
+    void LevelEditor::GetTilesForRectangle(ivec2 aStart, ivec2 aEnd, bool aIsFilled, vector<ivec2>& aTiles)
+    {
+        aTiles.clear();
+
+        //The start and end can be any two opposite corners
+        ivec2 minimum = glm::min(aStart, aEnd);
+        ivec2 maximum = glm::max(aStart, aEnd);
+        for (int y = minimum.y; y <= maximum.y; y++)
+        {
+            for (int x = minimum.x; x <= maximum.x; x++)
+            {
+                //An outlined rectangle only has the tiles on its edges
+                if (aIsFilled == true || x == minimum.x || x == maximum.x || y == minimum.y || y == maximum.y)
+                {
+                    aTiles.push_back(ivec2(x, y));
+                }
+            }
+        }
+    }
+
+    void LevelEditor::GetTilesForLine(ivec2 aStart, ivec2 aEnd, vector<ivec2>& aTiles)
+    {
+        aTiles.clear();
+
+        //Bresenham's line algorithm, works for every octant
+        ivec2 delta = ivec2(abs(aEnd.x - aStart.x), -abs(aEnd.y - aStart.y));
+        ivec2 step = ivec2(aStart.x < aEnd.x ? 1 : -1, aStart.y < aEnd.y ? 1 : -1);
+        int error = delta.x + delta.y;
+        ivec2 current = aStart;
+        while (true)
+        {
+            aTiles.push_back(current);
+            if (current == aEnd)
+            {
+                break;
+            }
+
+            int doubleError = error * 2;
+            if (doubleError >= delta.y)
+            {
+                error += delta.y;
+                current.x += step.x;
+            }
+            if (doubleError <= delta.x)
+            {
+                error += delta.x;
+                current.y += step.y;
+            }
+        }
+    }
+
+    void LevelEditor::GetTilesForFloodFill(ivec2 aStart, vector<ivec2>& aTiles)
+    {
+        aTiles.clear();
+
+        //Get the tile type that is being filled
+        unsigned int index = 0;
+        SubSection* subSection = GetSubSectionForTileCoordinates(aStart, index);
+        if (subSection == nullptr)
+        {
+            return;
+        }
+        TileType fillType = subSection->GetTileTypeForIndex(index);
+
+        //Reset the visited tiles, the vector keeps its capacity
+        uvec2 numberOfTiles = GetNumberOfEditableTiles();
+        m_ToolVisited.assign(numberOfTiles.x * numberOfTiles.y, false);
+
+        //Breadth first search from the start tile, the tiles vector is also the search's queue
+        const ivec2 neighbours[] = { ivec2(1, 0), ivec2(-1, 0), ivec2(0, 1), ivec2(0, -1) };
+        m_ToolVisited[aStart.x + aStart.y * numberOfTiles.x] = true;
+        aTiles.push_back(aStart);
+        for (unsigned int i = 0; i < aTiles.size(); i++)
+        {
+            for (unsigned int j = 0; j < 4; j++)
+            {
+                //Skip the tiles that are off the editable tiles or already visited
+                ivec2 coordinates = aTiles.at(i) + neighbours[j];
+                if (coordinates.x < 0 || coordinates.y < 0 || coordinates.x >= (int)numberOfTiles.x || coordinates.y >= (int)numberOfTiles.y)
+                {
+                    continue;
+                }
+                if (m_ToolVisited[coordinates.x + coordinates.y * numberOfTiles.x] == true)
+                {
+                    continue;
+                }
+                m_ToolVisited[coordinates.x + coordinates.y * numberOfTiles.x] = true;
+
+                //Only the connected tiles of the same tile type are filled, a subsection that isn't loaded stops the fill
+                subSection = GetSubSectionForTileCoordinates(coordinates, index);
+                if (subSection != nullptr && subSection->GetTileTypeForIndex(index) == fillType)
+                {
+                    aTiles.push_back(coordinates);
+                }
+            }
+        }
+    }
+
+    void LevelEditor::ApplyTool(const vector<ivec2>& aTiles)
+    {
+        //Safety check the selected tile
+        if (m_SelectedIndex < 0 || aTiles.size() == 0)
+        {
+            return;
+        }
+
+        //Group the tiles by subsection, the index vectors keep their capacity
+        for (unsigned int i = 0; i < m_ToolIndices.size(); i++)
+        {
+            m_ToolIndices.at(i).clear();
+        }
+        m_ToolSubSections.clear();
+
+        //The whole tool is one undoable edit, each tile is recorded before it changes
+        TileEditLog* tileEditLog = GetActiveTileEditLog();
+        tileEditLog->BeginCommand();
+
+        for (unsigned int i = 0; i < aTiles.size(); i++)
+        {
+            unsigned int index = 0;
+            SubSection* subSection = GetSubSectionForTileCoordinates(aTiles.at(i), index);
+            if (subSection == nullptr)
+            {
+                continue;
+            }
+            tileEditLog->TouchTile(subSection, index);
+
+            //Find the subsection's group, or add a new group for it
+            unsigned int group = 0;
+            while (group < m_ToolSubSections.size() && m_ToolSubSections.at(group) != subSection)
+            {
+                group++;
+            }
+            if (group == m_ToolSubSections.size())
+            {
+                m_ToolSubSections.push_back(subSection);
+                if (m_ToolIndices.size() < m_ToolSubSections.size())
+                {
+                    m_ToolIndices.push_back(vector<unsigned int>());
+                }
+            }
+            m_ToolIndices.at(group).push_back(index);
+        }
+
+        //Set the tiles, one batch for each subsection
+        TileType tileType = LEVEL_EDITOR_TILE_TYPES[m_SelectedIndex];
+        unsigned int tileVariant = m_TileData[m_SelectedIndex]->tileVariant;
+        for (unsigned int i = 0; i < m_ToolSubSections.size(); i++)
+        {
+            m_ToolSubSections.at(i)->SetTileTypeAtIndices(m_ToolIndices.at(i), tileType, tileVariant);
+        }
+
+        tileEditLog->EndCommand();
+    }
+
+    void LevelEditor::RefreshToolPreview()
+    {
+        //Calculate the tiles for the rectangle or line
+        if (m_Tool == LevelEditorToolLine)
+        {
+            GetTilesForLine(m_ToolStart, m_ToolEnd, m_ToolTiles);
+        }
+        else
+        {
+            GetTilesForRectangle(m_ToolStart, m_ToolEnd, m_Tool == LevelEditorToolFilledRectangle, m_ToolTiles);
+        }
+
+        //The preview draws the selection sprite on each tile
+        m_ToolPreviewPositions.clear();
+        m_ToolPreviewAngles.clear();
+        for (unsigned int i = 0; i < m_ToolTiles.size(); i++)
+        {
+            m_ToolPreviewPositions.push_back(GetScreenPositionForTileCoordinates(m_ToolTiles.at(i)));
+            m_ToolPreviewAngles.push_back(0.0f);
+        }
+    }
+
     void LevelEditor::pickRandomMusic()
     {
         if (m_Random != nullptr)//If we can generate random numbers
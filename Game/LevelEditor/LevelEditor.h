@@ -24,16 +24,29 @@ namespace GameDev2D
         LevelEditorLoadSubSection,
         LevelEditorLoadButtons,
         LevelEditorLoadSubSectionMenu,
+        LevelEditorLoadWorldEditorView,
         LevelEditorLoadMusic,
         LevelEditorLoadStepCount
     };
 
+    //Level editor tool enum, the tools paint the currently selected tile and variant
+    enum LevelEditorTool
+    {
+        LevelEditorToolBrush = 0,
+        LevelEditorToolFill,
+        LevelEditorToolRectangle,
+        LevelEditorToolFilledRectangle,
+        LevelEditorToolLine,
+        LevelEditorToolCount
+    };
+
     //Local constants
+    const string LEVEL_EDITOR_TOOL_NAMES[] = { "Brush", "Fill", "Rectangle", "Filled Rectangle", "Line" };
     const string LEVEL_EDITOR_TILE_BUTTON_TEXT[] = { "Ground", "Water", "Tree", "Boulder", "Rock", "Sand", "Bridge", "Fire" };
     const TileType LEVEL_EDITOR_TILE_TYPES[] = { TileTypeGround, TileTypeWater, TileTypeTree, TileTypeBoulder, TileTypeRock, TileTypeSand, TileTypeBridge, TileTypeFire };
     const unsigned int LEVEL_EDITOR_NUMBER_OF_TILES = 8;
 
-    const unsigned int LEVEL_EDITOR_TOTAL_BUTTONS = LEVEL_EDITOR_NUMBER_OF_TILES + 4;
+    const unsigned int LEVEL_EDITOR_TOTAL_BUTTONS = LEVEL_EDITOR_NUMBER_OF_TILES + 5;
     const string LEVEL_EDITOR_SPAWN_POINT_ATLAS_KEYS[] = { "Link-Spawn", "Enemy-Spawn" };
     const unsigned int LEVEL_EDITOR_SPAWN_POINT_VARIANT_COUNT = 2;
     const int LEVEL_EDITOR_SPAWN_POINT_INDEX = -2;
@@ -54,6 +67,10 @@ namespace GameDev2D
     class Sprite;
     class Random;
     class Audio;
+    class TileEditLog;
+    class WorldEditorView;
+    class LevelAutosave;
+    class LevelValidator;
     struct TileData;
 
     //The Level Editor edits one subsection at a time, it will automatically present the
@@ -78,31 +95,109 @@ namespace GameDev2D
         unsigned int GetNumberOfHorizontalTiles();
         unsigned int GetNumberOfVerticalTiles();
 
+        //Clears the undo and redo history, called when a subsection has been loaded into the level editor
+        void ClearEditHistory();
+
+        //Returns the autosave, the sub-sections that have been loaded or saved are journaled and autosaved to their files
+        LevelAutosave* GetAutosave();
+
+        //Validates the saved world and logs the issues found, called after a save and with the V key. Returns the number of issues
+        unsigned int ValidateWorld();
+
+    protected:
+        //Starts the background music, the music isn't started while the Level Editor is being preloaded
+        virtual void WillTransitionOn();
+
     private:
-        //Will present the SubSection menu and try to load subsection data
+        //Will present the SubSection menu and try to load subsection data, only when editing a single subsection
         void Load();
 
-        //Will present the SubSection menu and try to save the edited subsection data
+        //Will present the SubSection menu and try to save the edited subsection data, when
+        //editing the world the modified subsections are saved straight to their files
         void Save();
 
-        //Will clear the level editor
+        //Will clear the level editor, the clear can be undone, only when editing a single subsection
         void Clear();
 
+        //Switches between editing a single subsection and editing the whole world
+        void SetIsEditingWorld(bool isEditingWorld);
+
+        //Returns the subsection under the mouse's screen position and sets the position relative to the subsection,
+        //returns null if the position is outside the tile area or there isn't a (loaded) subsection under it
+        SubSection* GetSubSectionForScreenPosition(vec2 screenPosition, vec2& localPosition);
+
+        //Returns the edit history for the single subsection or the world, based on what is being edited
+        TileEditLog* GetActiveTileEditLog();
+
+        //Reverts or re-applies the last edit, called from the keyboard shortcuts
+        void Undo();
+        void Redo();
+
+        //Returns wether the control (or command) key is held down, used for the keyboard shortcuts
+        bool IsShortcutModifierPressed();
+
         //Conveniance method to load a button, its position is based off of the index that is passed in
         Button* LoadButton(unsigned int index, const string& text, const string& atlasKey, bool isToggle);
 
-        //Changes the tile's tile type at the position to the currently selected tile and variant
+        //Enables the buttons, they are loaded disabled so they don't handle input before the level editor is on screen
+        void EnableButtons();
+
+        //Changes the tile's tile type at the mouse's screen position to the currently selected tile and variant,
+        //the change is added to the open edit command, a new command is opened if there isn't one
         void ChangeTileType(TileType tileType, vec2 position);
 
+        //Sets the active tool, a rectangle or line that is being dragged is cancelled
+        void SetTool(LevelEditorTool tool);
+
+        //Methods to convert between the mouse's screen position and tile coordinates. The tile coordinates cover every
+        //editable tile, when editing the world they span all the subsections. Returns false if the position is outside the tile area
+        bool GetTileCoordinatesForScreenPosition(vec2 screenPosition, ivec2& coordinates);
+        vec2 GetScreenPositionForTileCoordinates(ivec2 coordinates);
+        uvec2 GetNumberOfEditableTiles();
+
+        //Returns the (loaded) subsection for the tile coordinates and sets the tile's index in it, returns null if there isn't one
+        SubSection* GetSubSectionForTileCoordinates(ivec2 coordinates, unsigned int& index);
+
+        //Methods to calculate the tiles that a tool affects, the tiles vector is cleared first
+        void GetTilesForRectangle(ivec2 start, ivec2 end, bool isFilled, vector<ivec2>& tiles);
+        void GetTilesForLine(ivec2 start, ivec2 end, vector<ivec2>& tiles);
+        void GetTilesForFloodFill(ivec2 start, vector<ivec2>& tiles);
+
+        //Sets the tiles to the selected tile and variant as a single undoable edit, the tiles are grouped by subsection
+        //so that each subsection is updated in one batch
+        void ApplyTool(const vector<ivec2>& tiles);
+
+        //Recalculates the rectangle or line being dragged and the preview of it
+        void RefreshToolPreview();
+
         //Member variables
         SubSectionMenu* m_SubSectionMenu;
         SubSection* m_EditingSubSection;
+        TileEditLog* m_TileEditLog;
+        LevelAutosave* m_Autosave;
+        LevelValidator* m_Validator;
         Sprite* m_SelectedTile;
         TileData** m_TileData;
         Button* m_SpawnPointButton;
         Button* m_SaveButton;
         Button* m_LoadButton;
         Button* m_ClearButton;
+        Button* m_WorldButton;
+        WorldEditorView* m_WorldEditorView;
+        bool m_IsEditingWorld;
+        vec2 m_PreviousMousePosition;
+
+        //Tool variables, the rectangle and line tools are dragged from the start to the end tile coordinates
+        LevelEditorTool m_Tool;
+        bool m_IsToolDragging;
+        ivec2 m_ToolStart;
+        ivec2 m_ToolEnd;
+        vector<ivec2> m_ToolTiles;
+        vector<vec2> m_ToolPreviewPositions;
+        vector<float> m_ToolPreviewAngles;
+        vector<bool> m_ToolVisited;
+        vector<SubSection*> m_ToolSubSections;
+        vector<vector<unsigned int>> m_ToolIndices;
         int m_SelectedIndex;
         unsigned int m_SpawnPointVariant;
         unsigned int m_PickUpVariant;
@@ -115,46 +210,38 @@ namespace GameDev2D
         unsigned int m_MusicIndex;//Index current sound playing
     };
 
-    //Conveniance struct to help organize the TileData (Button*, Tile* Variant)
+    //Conveniance struct to help organize the TileData (Button*, TileType, Variant)
     struct TileData
     {
         //Member variables
         Button* button;
-        Tile* tile;
+        TileType tileType;
         unsigned int tileVariant;
 
         //Constructor
-        TileData(Button* button, Tile* tile)
+        TileData(Button* button, TileType tileType)
         {
             this->button = button;
-            this->tile = tile;
-            if (this->tile) this->tile->SetIsEnabled(false);
+            this->tileType = tileType;
             this->tileVariant = 0;
         }
 
-        //Destructor
-        ~TileData()
-        {
-            //The tile object needs to be deleted, the button was added to the Scene so it doesn't need to be
-            SafeDelete(tile);
-        }
-
         //Increments the tile variant and sets the Button's background to that of the tile variant
         void IncrementVariant()
         {
             //Ensure there is at least 2 variants for the tile
-            if (tile->GetVariantCount() > 1)
+            const TileTypeBehaviour& behaviour = Tile::GetBehaviourForTileType(tileType);
+            if (behaviour.variantCount > 1)
             {
                 //Increment the tile variant, bounds check it
                 tileVariant++;
-                if (tileVariant >= tile->GetVariantCount())
+                if (tileVariant >= behaviour.variantCount)
                 {
                     tileVariant = 0;
                 }
 
                 //Get the atlas key for the tile variant
-                string atlasKey;
-                tile->GetAtlasKeyForVariant(tileVariant, atlasKey);
+                string atlasKey = behaviour.atlasKeys[tileVariant * behaviour.animationFrameCount];
 
                 //Set the button's background to that of the tile variant
                 button->SetBackground("MainAtlas", atlasKey);
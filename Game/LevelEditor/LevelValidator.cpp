@@ -0,0 +1,343 @@
+/*******************************************************************
+LevelValidator.cpp
+
+Purpose:
+The level validator checks the saved world for problems before they show
+up in game. It reads every SubSection's file straight into a tile grid for
+the whole world (no SubSections, sprites or enemies are created) and
+reports format errors, a missing or duplicated hero spawn point, spawn
+points that are walled in and walkable regions that can't be reached
+from the hero's spawn point, across the SubSection borders.
+*********************************************************************/
+
+#include "LevelValidator.h"
+#include "WorldEditorView.h"
+#include "../SubSection.h"
+#include "../World.h"
+
+namespace GameDev2D
+{
+    LevelValidator::LevelValidator() : BaseObject("LevelValidator"),
+        m_NumberOfTiles(0, 0),
+        m_SaveData(nullptr),
+        m_Flags(nullptr),
+        m_Components(nullptr),
+        m_HeroSpawnIndex(LEVEL_VALIDATOR_NO_TILE)
+    {
+        //Allocate the tile grids for the whole world
+        m_NumberOfTiles = WORLD_NUMBER_OF_SUBSECTIONS * uvec2(WORLD_NUMBER_OF_HORIZONTAL_TILES, WORLD_NUMBER_OF_VERTICAL_TILES);
+        unsigned int numberOfTiles = m_NumberOfTiles.x * m_NumberOfTiles.y;
+        m_SaveData = new unsigned short[numberOfTiles];
+        m_Flags = new unsigned char[numberOfTiles];
+        m_Components = new unsigned int[numberOfTiles];
+        m_Queue.reserve(numberOfTiles);
+    }
+
+    LevelValidator::~LevelValidator()
+    {
+        SafeDeleteArray(m_SaveData);
+        SafeDeleteArray(m_Flags);
+        SafeDeleteArray(m_Components);
+    }
+
+    unsigned int LevelValidator::ValidateFiles()
+    {
+        m_Issues.clear();
+
+        //Read every SubSection's file into the tile grid
+        for (unsigned int y = 0; y < WORLD_NUMBER_OF_SUBSECTIONS.y; y++)
+        {
+            for (unsigned int x = 0; x < WORLD_NUMBER_OF_SUBSECTIONS.x; x++)
+            {
+                LoadFile(uvec2(x, y));
+            }
+        }
+
+        ValidateTiles();
+        FindComponents();
+        ValidateReachability();
+
+        return (unsigned int)m_Issues.size();
+    }
+
+    const vector<LevelValidationIssue>& LevelValidator::GetIssues()
+    {
+        return m_Issues;
+    }
+
+    void LevelValidator::LogIssues()
+    {
+        string description;
+        for (unsigned int i = 0; i < m_Issues.size(); i++)
+        {
+            GetDescriptionForIssue(m_Issues.at(i), description);
+            Log(VerbosityLevel_Debug, "Level validation: %s", description.c_str());
+        }
+        Log(VerbosityLevel_Debug, "Level validation found %u issues", (unsigned int)m_Issues.size());
+    }
+
+    void LevelValidator::GetDescriptionForIssue(const LevelValidationIssue& aIssue, string& aDescription)
+    {
+        stringstream ss;
+
+        //Where the issue is
+        if (aIssue.type != LevelValidationMissingHeroSpawn)
+        {
+            ss << "SubSection " << aIssue.subSection.x << "-" << aIssue.subSection.y;
+            if (aIssue.tileIndex != LEVEL_VALIDATOR_NO_TILE)
+            {
+                ss << " tile " << aIssue.tileIndex;
+            }
+            ss << ": ";
+        }
+
+        //What the issue is
+        switch (aIssue.type)
+        {
+        case LevelValidationMissingFile:
+            ss << "the file is missing, it is loaded as an empty sub-section";
+            break;
+        case LevelValidationInvalidFileSize:
+            ss << "the file is " << aIssue.value << " bytes, it should be " << WORLD_NUMBER_OF_HORIZONTAL_TILES * WORLD_NUMBER_OF_VERTICAL_TILES * sizeof(unsigned short) << " bytes";
+            break;
+        case LevelValidationInvalidTile:
+            ss << "the tile type or variant is invalid (" << aIssue.value << ")";
+            break;
+        case LevelValidationConflictingSpawnPoints:
+            ss << "the tile is both a hero and an enemy spawn point";
+            break;
+        case LevelValidationMissingHeroSpawn:
+            ss << "there isn't a hero spawn point, the hero spawns at sub-section 0 tile 0";
+            break;
+        case LevelValidationMultipleHeroSpawns:
+            ss << "there is more than one hero spawn point, this one is ignored";
+            break;
+        case LevelValidationBlockedSpawnPoint:
+            ss << "the spawn point is on a tile that isn't walkable";
+            break;
+        case LevelValidationUnreachableEnemySpawn:
+            ss << "the enemy spawn point can't be reached from the hero spawn point";
+            break;
+        case LevelValidationIsolatedRegion:
+            ss << "a region of " << aIssue.value << " walkable tiles can't be reached from the hero spawn point";
+            break;
+        default:
+            break;
+        }
+
+        aDescription = ss.str();
+    }
+
+    void LevelValidator::LoadFile(uvec2 aCoordinates)
+    {
+        const unsigned int numberOfTiles = WORLD_NUMBER_OF_HORIZONTAL_TILES * WORLD_NUMBER_OF_VERTICAL_TILES;
+        unsigned short buffer[WORLD_NUMBER_OF_HORIZONTAL_TILES * WORLD_NUMBER_OF_VERTICAL_TILES];
+        bool loadEmptySubSection = true;
+
+        //Open input stream (read file)
+        string filename;
+        WorldEditorView::GetFilenameForCoordinates(aCoordinates, filename);
+        ifstream inputStream;
+        inputStream.open(filename, ifstream::in | ifstream::binary);
+
+        if (inputStream.is_open() == true)
+        {
+            //The file must have exactly one saved value for each tile
+            inputStream.seekg(0, inputStream.end);
+            unsigned int fileSize = (unsigned int)inputStream.tellg();
+            inputStream.seekg(0, inputStream.beg);
+
+            if (fileSize == numberOfTiles * sizeof(unsigned short))
+            {
+                inputStream.read((char*)buffer, fileSize);
+                loadEmptySubSection = inputStream.fail();
+            }
+            else
+            {
+                AddSubSectionIssue(LevelValidationInvalidFileSize, aCoordinates, fileSize);
+            }
+            inputStream.close();
+        }
+        else
+        {
+            AddSubSectionIssue(LevelValidationMissingFile, aCoordinates);
+        }
+
+        //Copy the tiles into the world's tile grid, an empty SubSection is all ground
+        for (unsigned int i = 0; i < numberOfTiles; i++)
+        {
+            m_SaveData[GetWorldIndex(aCoordinates, i)] = loadEmptySubSection == true ? (unsigned short)TileTypeGround : buffer[i];
+        }
+    }
+
+    void LevelValidator::ValidateTiles()
+    {
+        m_HeroSpawnIndex = LEVEL_VALIDATOR_NO_TILE;
+
+        //The tiles are checked in the order the World looks for the hero spawn point, so the first one found is the one the hero uses
+        for (unsigned int s = 0; s < WORLD_NUMBER_OF_SUBSECTIONS.x * WORLD_NUMBER_OF_SUBSECTIONS.y; s++)
+        {
+            uvec2 subSection = uvec2(s % WORLD_NUMBER_OF_SUBSECTIONS.x, s / WORLD_NUMBER_OF_SUBSECTIONS.x);
+            for (unsigned int i = 0; i < WORLD_NUMBER_OF_HORIZONTAL_TILES * WORLD_NUMBER_OF_VERTICAL_TILES; i++)
+            {
+                unsigned int index = GetWorldIndex(subSection, i);
+                unsigned short saveData = m_SaveData[index];
+
+                //An invalid tile would hit an assert when it is loaded, it is treated as a wall
+                unsigned char typeIndex = 0;
+                unsigned char variant = 0;
+                if (SubSection::DecodeSaveData(saveData, typeIndex, variant, m_Flags[index]) == false)
+                {
+                    AddIssue(LevelValidationInvalidTile, index, saveData);
+                    m_Flags[index] = TileFlagNone;
+                    continue;
+                }
+
+                if ((saveData & TILE_HERO_SPAWN_POINT) != 0 && (saveData & TILE_ENEMY_SPAWN_POINT) != 0)
+                {
+                    AddIssue(LevelValidationConflictingSpawnPoints, index);
+                }
+
+                //Check the spawn points are on walkable tiles
+                bool isSpawnPoint = (m_Flags[index] & (TileFlagHeroSpawnPoint | TileFlagEnemySpawnPoint)) != 0;
+                if (isSpawnPoint == true && (m_Flags[index] & TileFlagWalkable) == 0)
+                {
+                    AddIssue(LevelValidationBlockedSpawnPoint, index);
+                }
+
+                //Only the first hero spawn point is used
+                if ((m_Flags[index] & TileFlagHeroSpawnPoint) != 0)
+                {
+                    if (m_HeroSpawnIndex == LEVEL_VALIDATOR_NO_TILE)
+                    {
+                        m_HeroSpawnIndex = index;
+                    }
+                    else
+                    {
+                        AddIssue(LevelValidationMultipleHeroSpawns, index);
+                    }
+                }
+            }
+        }
+
+        if (m_HeroSpawnIndex == LEVEL_VALIDATOR_NO_TILE)
+        {
+            AddSubSectionIssue(LevelValidationMissingHeroSpawn, uvec2(0, 0));
+        }
+    }
+
+    void LevelValidator::FindComponents()
+    {
+        unsigned int numberOfTiles = m_NumberOfTiles.x * m_NumberOfTiles.y;
+        for (unsigned int i = 0; i < numberOfTiles; i++)
+        {
+            m_Components[i] = LEVEL_VALIDATOR_NO_COMPONENT;
+        }
+        m_ComponentSizes.clear();
+
+        //Flood each walkable tile that isn't in a component yet, the neighbours cross the SubSection borders
+        const ivec2 neighbours[] = { ivec2(1, 0), ivec2(-1, 0), ivec2(0, 1), ivec2(0, -1) };
+        for (unsigned int i = 0; i < numberOfTiles; i++)
+        {
+            if ((m_Flags[i] & TileFlagWalkable) == 0 || m_Components[i] != LEVEL_VALIDATOR_NO_COMPONENT)
+            {
+                continue;
+            }
+
+            //Breadth first search from the tile, the queue vector keeps its capacity
+            unsigned int component = (unsigned int)m_ComponentSizes.size();
+            m_Components[i] = component;
+            m_Queue.clear();
+            m_Queue.push_back(i);
+            for (unsigned int j = 0; j < m_Queue.size(); j++)
+            {
+                ivec2 coordinates = ivec2(m_Queue.at(j) % m_NumberOfTiles.x, m_Queue.at(j) / m_NumberOfTiles.x);
+                for (unsigned int k = 0; k < 4; k++)
+                {
+                    ivec2 neighbour = coordinates + neighbours[k];
+                    if (neighbour.x < 0 || neighbour.y < 0 || neighbour.x >= (int)m_NumberOfTiles.x || neighbour.y >= (int)m_NumberOfTiles.y)
+                    {
+                        continue;
+                    }
+
+                    unsigned int index = neighbour.x + neighbour.y * m_NumberOfTiles.x;
+                    if ((m_Flags[index] & TileFlagWalkable) != 0 && m_Components[index] == LEVEL_VALIDATOR_NO_COMPONENT)
+                    {
+                        m_Components[index] = component;
+                        m_Queue.push_back(index);
+                    }
+                }
+            }
+            m_ComponentSizes.push_back((unsigned int)m_Queue.size());
+        }
+    }
+
+    void LevelValidator::ValidateReachability()
+    {
+        //Reachability is only known if the hero spawns on a walkable tile
+        if (m_HeroSpawnIndex == LEVEL_VALIDATOR_NO_TILE || m_Components[m_HeroSpawnIndex] == LEVEL_VALIDATOR_NO_COMPONENT)
+        {
+            return;
+        }
+        unsigned int heroComponent = m_Components[m_HeroSpawnIndex];
+
+        //Report each region that the hero can't reach once, at its first tile, and the enemy spawn points in them
+        unsigned int numberOfTiles = m_NumberOfTiles.x * m_NumberOfTiles.y;
+        for (unsigned int i = 0; i < numberOfTiles; i++)
+        {
+            unsigned int component = m_Components[i];
+            if (component == LEVEL_VALIDATOR_NO_COMPONENT || component == heroComponent)
+            {
+                continue;
+            }
+
+            //The region's size is cleared once it has been reported
+            if (m_ComponentSizes.at(component) > 0)
+            {
+                AddIssue(LevelValidationIsolatedRegion, i, m_ComponentSizes.at(component));
+                m_ComponentSizes.at(component) = 0;
+            }
+
+            if ((m_Flags[i] & TileFlagEnemySpawnPoint) != 0)
+            {
+                AddIssue(LevelValidationUnreachableEnemySpawn, i);
+            }
+        }
+    }
+
+    unsigned int LevelValidator::GetWorldIndex(uvec2 aSubSection, unsigned int aTileIndex)
+    {
+        uvec2 coordinates = aSubSection * uvec2(WORLD_NUMBER_OF_HORIZONTAL_TILES, WORLD_NUMBER_OF_VERTICAL_TILES);
+        coordinates.x += aTileIndex % WORLD_NUMBER_OF_HORIZONTAL_TILES;
+        coordinates.y += aTileIndex / WORLD_NUMBER_OF_HORIZONTAL_TILES;
+        return coordinates.x + coordinates.y * m_NumberOfTiles.x;
+    }
+
+    void LevelValidator::GetSubSectionTile(unsigned int aWorldIndex, uvec2& aSubSection, unsigned int& aTileIndex)
+    {
+        uvec2 coordinates = uvec2(aWorldIndex % m_NumberOfTiles.x, aWorldIndex / m_NumberOfTiles.x);
+        uvec2 subSectionTiles = uvec2(WORLD_NUMBER_OF_HORIZONTAL_TILES, WORLD_NUMBER_OF_VERTICAL_TILES);
+        aSubSection = coordinates / subSectionTiles;
+        coordinates = coordinates % subSectionTiles;
+        aTileIndex = coordinates.x + coordinates.y * WORLD_NUMBER_OF_HORIZONTAL_TILES;
+    }
+
+    void LevelValidator::AddIssue(LevelValidationIssueType aType, unsigned int aWorldIndex, unsigned int aValue)
+    {
+        LevelValidationIssue issue;
+        issue.type = aType;
+        GetSubSectionTile(aWorldIndex, issue.subSection, issue.tileIndex);
+        issue.value = aValue;
+        m_Issues.push_back(issue);
+    }
+
+    void LevelValidator::AddSubSectionIssue(LevelValidationIssueType aType, uvec2 aSubSection, unsigned int aValue)
+    {
+        LevelValidationIssue issue;
+        issue.type = aType;
+        issue.subSection = aSubSection;
+        issue.tileIndex = LEVEL_VALIDATOR_NO_TILE;
+        issue.value = aValue;
+        m_Issues.push_back(issue);
+    }
+}
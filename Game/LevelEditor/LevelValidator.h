@@ -0,0 +1,107 @@
+/*******************************************************************
+LevelValidator.h
+
+Purpose:
+The level validator checks the saved world for problems before they show
+up in game. It reads every SubSection's file straight into a tile grid for
+the whole world (no SubSections, sprites or enemies are created) and
+reports format errors, a missing or duplicated hero spawn point, spawn
+points that are walled in and walkable regions that can't be reached
+from the hero's spawn point, across the SubSection borders.
+*********************************************************************/
+
+#ifndef __GameDev2D__LevelValidator__
+#define __GameDev2D__LevelValidator__
+
+#include "../../Source/Core/BaseObject.h"
+
+using namespace glm;
+
+namespace GameDev2D
+{
+    //The problems the level validator reports
+    enum LevelValidationIssueType
+    {
+        LevelValidationMissingFile = 0,
+        LevelValidationInvalidFileSize,
+        LevelValidationInvalidTile,
+        LevelValidationConflictingSpawnPoints,
+        LevelValidationMissingHeroSpawn,
+        LevelValidationMultipleHeroSpawns,
+        LevelValidationBlockedSpawnPoint,
+        LevelValidationUnreachableEnemySpawn,
+        LevelValidationIsolatedRegion,
+        LevelValidationIssueTypeCount
+    };
+
+    //Local constants
+    const unsigned int LEVEL_VALIDATOR_NO_TILE = 0xFFFFFFFF;
+    const unsigned int LEVEL_VALIDATOR_NO_COMPONENT = 0xFFFFFFFF;
+
+    //A problem found in the world, the tile index is LEVEL_VALIDATOR_NO_TILE for a problem with a whole
+    //SubSection or the whole world. The value is the file size or the number of tiles in a region
+    struct LevelValidationIssue
+    {
+        LevelValidationIssueType type;
+        uvec2 subSection;
+        unsigned int tileIndex;
+        unsigned int value;
+    };
+
+    /***************************************************************
+    Class: LevelValidator
+    The walkable tiles are grouped into connected components with a breadth
+    first search over the world's tile grid, the hero's spawn point decides
+    which component is reachable. A missing file is loaded as an empty
+    SubSection (all ground) the same way the game does, and an invalid tile
+    is treated as a wall. The grids are allocated once, so validating again
+    doesn't allocate anything but the issues.
+    ***************************************************************/
+    class LevelValidator : public BaseObject
+    {
+    public:
+        LevelValidator();
+        ~LevelValidator();
+
+        //Loads every SubSection's file and validates the world, returns the number of issues found
+        unsigned int ValidateFiles();
+
+        //Returns the issues found by the last validation
+        const vector<LevelValidationIssue>& GetIssues();
+
+        //Logs the issues found by the last validation
+        void LogIssues();
+
+        //Sets a readable description of the issue
+        static void GetDescriptionForIssue(const LevelValidationIssue& issue, string& description);
+
+    private:
+        //Reads the SubSection's file into the world's tile grid, a missing or invalid file is loaded as an empty SubSection
+        void LoadFile(uvec2 coordinates);
+
+        //Decodes the tile grid, checks the spawn points and labels the walkable tiles with their connected component
+        void ValidateTiles();
+        void FindComponents();
+        void ValidateReachability();
+
+        //Methods to convert between a world tile index, and a SubSection's coordinates and its tile index
+        unsigned int GetWorldIndex(uvec2 subSection, unsigned int tileIndex);
+        void GetSubSectionTile(unsigned int worldIndex, uvec2& subSection, unsigned int& tileIndex);
+
+        //Adds an issue for the world tile index, or for the whole SubSection
+        void AddIssue(LevelValidationIssueType type, unsigned int worldIndex, unsigned int value = 0);
+        void AddSubSectionIssue(LevelValidationIssueType type, uvec2 subSection, unsigned int value = 0);
+
+        //Member variables
+        uvec2 m_NumberOfTiles;
+        unsigned short* m_SaveData;
+        unsigned char* m_Flags;
+        unsigned int* m_Components;
+        vector<unsigned int> m_ComponentSizes;
+        vector<unsigned int> m_Queue;
+        vector<LevelValidationIssue> m_Issues;
+        unsigned int m_HeroSpawnIndex;
+    };
+}
+
+#endif /* defined(__GameDev2D__LevelValidator__) */
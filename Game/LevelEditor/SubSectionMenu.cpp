@@ -13,10 +13,16 @@ _______________________________________________
 to include the "SaveData/" path so that the files are directly saved to that
 folder.THIS REQUIRED MODIFYING THE PROJECT PROERTIES, WORKING DIRECTORY TO BE T
 HE ROOT OF THE PROJECT "../../../"
+-Loading a sub-section clears the Level Editor's undo and redo history.
+-The sub-section filenames come from WorldEditorView, so that both editors use the same files.
+-A sub-section that is saved or loaded is autosaved to its file, the edits left in its autosave journal are recovered after it is loaded.
+-The world is validated after a sub-section is saved.
 */
 
 #include "SubSectionMenu.h"
 #include "LevelEditor.h"
+#include "WorldEditorView.h"
+#include "LevelAutosave.h"
 #include "../World.h"
 #include "../SubSection.h"
 #include "../../Source/Platforms/PlatformLayer.h"
@@ -159,20 +165,39 @@ namespace GameDev2D
                 coordinates.x = (index % WORLD_NUMBER_OF_SUBSECTIONS.x);
                 coordinates.y = ((index - coordinates.x) / WORLD_NUMBER_OF_SUBSECTIONS.x);
 
-                //Set the filename, based on the button's coordinates
-                stringstream ss;
-                ss << "SaveData/SubSection" << coordinates.x << "-" << coordinates.y << ".bin";
+                //Set the filename, based on the button's coordinates, the world editor view uses the same filenames
+                string filename;
+                WorldEditorView::GetFilenameForCoordinates(coordinates, filename);
 
                 //Are we saving OR loading?
+                LevelAutosave* autosave = m_LevelEditor->GetAutosave();
                 if (m_SaveSubSection != nullptr)
                 {
-                    m_SaveSubSection->Save(ss.str());
+                    //Wait for the autosave's queued writes, a compaction of the same file can't replace the save
+                    autosave->WaitForJobs();
+                    m_SaveSubSection->Save(filename);
+
+                    //Autosave to the file that was saved, it doesn't need a journal yet
+                    autosave->Track(m_SaveSubSection, filename);
+                    autosave->MarkSaved(m_SaveSubSection);
                     m_SaveSubSection = nullptr;
+
+                    //Check the saved world for problems
+                    m_LevelEditor->ValidateWorld();
                 }
                 else if (m_LoadSubSection != nullptr)
                 {
-                    m_LoadSubSection->Load(ss.str());
+                    //Autosave the sub-section's changes to its previous file before it is replaced
+                    autosave->Untrack(m_LoadSubSection);
+                    m_LoadSubSection->Load(filename);
+
+                    //Recover the edits that weren't compacted into the file, and autosave to the file
+                    autosave->Recover(m_LoadSubSection, filename);
+                    autosave->Track(m_LoadSubSection, filename);
                     m_LoadSubSection = nullptr;
+
+                    //The loaded sub-section can't be undone, clear the level editor's edit history
+                    m_LevelEditor->ClearEditHistory();
                 }
 
                 //We the save OR load operation is done, pop the sub-section menu
@@ -0,0 +1,220 @@
+/*******************************************************************
+TileEditLog.cpp
+
+Purpose:
+The tile edit log records the Level Editor's changes to one or more
+SubSections as commands of compact tile deltas (sub-section, index, old
+and new type, variant and spawn flags). Every tile touched while a command is open is merged into
+a single delta, so a whole brush stroke is undone and redone at once.
+Undoing or redoing a command only writes the tiles that it changed.
+*********************************************************************/
+
+#include "TileEditLog.h"
+#include "../SubSection.h"
+
+namespace GameDev2D
+{
+    TileEditLog::TileEditLog(SubSection** aSubSections, unsigned int aNumberOfSubSections, unsigned int aNumberOfTiles, unsigned int aCapacity) : BaseObject("TileEditLog"),
+        m_SubSections(aSubSections),
+        m_NumberOfSubSections(aNumberOfSubSections),
+        m_NumberOfTiles(aNumberOfTiles),
+        m_Capacity(aCapacity),
+        m_OpenCommandPositions(nullptr),
+        m_IsCommandOpen(false)
+    {
+        //If this assert is hit, the sub-section or the position in the open command can't fit in a TileEdit
+        assert(m_NumberOfSubSections <= 0xFF && m_NumberOfSubSections * m_NumberOfTiles < TILE_EDIT_LOG_NOT_TOUCHED);
+
+        //Allocate the open command's positions, no tile has been touched yet
+        m_OpenCommandPositions = new unsigned short[m_NumberOfSubSections * m_NumberOfTiles];
+        for (unsigned int i = 0; i < m_NumberOfSubSections * m_NumberOfTiles; i++)
+        {
+            m_OpenCommandPositions[i] = TILE_EDIT_LOG_NOT_TOUCHED;
+        }
+    }
+
+    TileEditLog::~TileEditLog()
+    {
+        SafeDeleteArray(m_OpenCommandPositions);
+        m_SubSections = nullptr;
+    }
+
+    void TileEditLog::BeginCommand()
+    {
+        //Only one command can be open at a time
+        if (m_IsCommandOpen == true)
+        {
+            EndCommand();
+        }
+
+        m_IsCommandOpen = true;
+    }
+
+    void TileEditLog::TouchTile(SubSection* aSubSection, unsigned int aIndex)
+    {
+        //Safety check that there is an open command and that the index is on the subsection
+        if (m_IsCommandOpen == false || aIndex >= m_NumberOfTiles)
+        {
+            return;
+        }
+
+        //If this assert is hit, the sub-section isn't in the log's sub-section array
+        unsigned int subSectionIndex = GetIndexForSubSection(aSubSection);
+        assert(subSectionIndex < m_NumberOfSubSections);
+        if (subSectionIndex == m_NumberOfSubSections)
+        {
+            return;
+        }
+
+        //If the tile has already been touched in the open command, its original data is already recorded
+        unsigned int position = subSectionIndex * m_NumberOfTiles + aIndex;
+        if (m_OpenCommandPositions[position] != TILE_EDIT_LOG_NOT_TOUCHED)
+        {
+            return;
+        }
+
+        //Record the tile's data before it is changed
+        TileEdit edit;
+        edit.index = (unsigned short)aIndex;
+        edit.subSection = (unsigned char)subSectionIndex;
+        aSubSection->GetTileDataAtIndex(aIndex, edit.oldTypeIndex, edit.oldVariant, edit.oldFlags);
+        edit.newTypeIndex = edit.oldTypeIndex;
+        edit.newVariant = edit.oldVariant;
+        edit.newFlags = edit.oldFlags;
+
+        m_OpenCommandPositions[position] = (unsigned short)m_OpenCommand.size();
+        m_OpenCommand.push_back(edit);
+    }
+
+    void TileEditLog::EndCommand()
+    {
+        if (m_IsCommandOpen == false)
+        {
+            return;
+        }
+        m_IsCommandOpen = false;
+
+        //Capture the new data of the touched tiles, the tiles that ended up unchanged are dropped
+        vector<TileEdit> command;
+        command.reserve(m_OpenCommand.size());
+        for (unsigned int i = 0; i < m_OpenCommand.size(); i++)
+        {
+            TileEdit edit = m_OpenCommand.at(i);
+            m_SubSections[edit.subSection]->GetTileDataAtIndex(edit.index, edit.newTypeIndex, edit.newVariant, edit.newFlags);
+
+            if (edit.newTypeIndex != edit.oldTypeIndex || edit.newVariant != edit.oldVariant || edit.newFlags != edit.oldFlags)
+            {
+                command.push_back(edit);
+            }
+
+            //Reset the tile's position for the next command
+            m_OpenCommandPositions[edit.subSection * m_NumberOfTiles + edit.index] = TILE_EDIT_LOG_NOT_TOUCHED;
+        }
+        m_OpenCommand.clear();
+
+        //Nothing changed, there is nothing to undo
+        if (command.size() == 0)
+        {
+            return;
+        }
+
+        //Add the command to the undo history, if the history is full the oldest command is dropped
+        m_UndoCommands.push_back(command);
+        if (m_UndoCommands.size() > m_Capacity)
+        {
+            m_UndoCommands.erase(m_UndoCommands.begin());
+        }
+
+        //A new command invalidates the redo history
+        m_RedoCommands.clear();
+    }
+
+    bool TileEditLog::IsCommandOpen()
+    {
+        return m_IsCommandOpen;
+    }
+
+    bool TileEditLog::Undo()
+    {
+        //An open command is finished before it can be undone
+        EndCommand();
+
+        if (CanUndo() == false)
+        {
+            return false;
+        }
+
+        //Revert the tiles in the reverse order they were recorded
+        const vector<TileEdit>& command = m_UndoCommands.back();
+        for (int i = (int)command.size() - 1; i >= 0; i--)
+        {
+            const TileEdit& edit = command.at(i);
+            m_SubSections[edit.subSection]->SetTileDataAtIndex(edit.index, edit.oldTypeIndex, edit.oldVariant, edit.oldFlags);
+        }
+
+        //Move the command onto the redo history
+        m_RedoCommands.push_back(command);
+        m_UndoCommands.pop_back();
+        return true;
+    }
+
+    bool TileEditLog::Redo()
+    {
+        //An open command would invalidate the redo history
+        EndCommand();
+
+        if (CanRedo() == false)
+        {
+            return false;
+        }
+
+        //Re-apply the tiles in the order they were recorded
+        const vector<TileEdit>& command = m_RedoCommands.back();
+        for (unsigned int i = 0; i < command.size(); i++)
+        {
+            const TileEdit& edit = command.at(i);
+            m_SubSections[edit.subSection]->SetTileDataAtIndex(edit.index, edit.newTypeIndex, edit.newVariant, edit.newFlags);
+        }
+
+        //Move the command back onto the undo history
+        m_UndoCommands.push_back(command);
+        m_RedoCommands.pop_back();
+        return true;
+    }
+
+    bool TileEditLog::CanUndo()
+    {
+        return m_UndoCommands.size() > 0;
+    }
+
+    bool TileEditLog::CanRedo()
+    {
+        return m_RedoCommands.size() > 0;
+    }
+
+    void TileEditLog::ClearHistory()
+    {
+        //Discard the open command without recording it
+        for (unsigned int i = 0; i < m_OpenCommand.size(); i++)
+        {
+            m_OpenCommandPositions[m_OpenCommand.at(i).subSection * m_NumberOfTiles + m_OpenCommand.at(i).index] = TILE_EDIT_LOG_NOT_TOUCHED;
+        }
+        m_OpenCommand.clear();
+        m_IsCommandOpen = false;
+
+        m_UndoCommands.clear();
+        m_RedoCommands.clear();
+    }
+
+    unsigned int TileEditLog::GetIndexForSubSection(SubSection* aSubSection)
+    {
+        for (unsigned int i = 0; i < m_NumberOfSubSections; i++)
+        {
+            if (m_SubSections[i] == aSubSection)
+            {
+                return i;
+            }
+        }
+        return m_NumberOfSubSections;
+    }
+}
@@ -0,0 +1,99 @@
+/*******************************************************************
+TileEditLog.h
+
+Purpose:
+The tile edit log records the Level Editor's changes to one or more
+SubSections as commands of compact tile deltas (sub-section, index, old
+and new type, variant and spawn flags). Every tile touched while a command is open is merged into
+a single delta, so a whole brush stroke is undone and redone at once.
+Undoing or redoing a command only writes the tiles that it changed.
+*********************************************************************/
+
+#ifndef __GameDev2D__TileEditLog__
+#define __GameDev2D__TileEditLog__
+
+#include "../../Source/Core/BaseObject.h"
+
+namespace GameDev2D
+{
+    //Local constants
+    const unsigned int TILE_EDIT_LOG_DEFAULT_CAPACITY = 100;
+    const unsigned short TILE_EDIT_LOG_NOT_TOUCHED = 0xFFFF;
+
+    //The change to a single tile, the type is stored as its index in TILES_TYPES[] and
+    //the sub-section as its index in the log's sub-section array
+    struct TileEdit
+    {
+        unsigned short index;
+        unsigned char subSection;
+        unsigned char oldTypeIndex;
+        unsigned char oldVariant;
+        unsigned char oldFlags;
+        unsigned char newTypeIndex;
+        unsigned char newVariant;
+        unsigned char newFlags;
+    };
+
+    //Forward declarations
+    class SubSection;
+
+    /***************************************************************
+    Class: TileEditLog
+    Keeps the undo and redo history for an array of SubSections, the array is
+    owned by the caller and its SubSections can be loaded after the log is
+    created, a single SubSection is an array of one. A command is opened
+    with BeginCommand(), every tile must be touched with TouchTile() BEFORE
+    it is changed, and EndCommand() captures the new tile data, dropping the
+    tiles that ended up unchanged. Pickups are not part of the history.
+    ***************************************************************/
+    class TileEditLog : public BaseObject
+    {
+    public:
+        TileEditLog(SubSection** subSections, unsigned int numberOfSubSections, unsigned int numberOfTiles, unsigned int capacity = TILE_EDIT_LOG_DEFAULT_CAPACITY);
+        ~TileEditLog();
+
+        //Opens a new command, if a command is already open it is ended first
+        void BeginCommand();
+
+        //Records the tile's data before it is changed, a tile is only recorded the first time it is touched in a command
+        void TouchTile(SubSection* subSection, unsigned int index);
+
+        //Closes the open command, if any tile has changed the command is added to the undo history and the redo history is cleared
+        void EndCommand();
+
+        //Returns wether a command is currently open
+        bool IsCommandOpen();
+
+        //Reverts the last command, returns false if there was nothing to undo
+        bool Undo();
+
+        //Re-applies the last undone command, returns false if there was nothing to redo
+        bool Redo();
+
+        //Returns wether there is a command that can be undone or redone
+        bool CanUndo();
+        bool CanRedo();
+
+        //Clears the undo and redo history, call this when the SubSection is reloaded
+        void ClearHistory();
+
+    private:
+        //Returns the index of the sub-section in the sub-section array, returns the number of sub-sections if it isn't in it
+        unsigned int GetIndexForSubSection(SubSection* subSection);
+
+        //Member variables
+        SubSection** m_SubSections;
+        unsigned int m_NumberOfSubSections;
+        unsigned int m_NumberOfTiles;
+        unsigned int m_Capacity;
+        vector<vector<TileEdit>> m_UndoCommands;
+        vector<vector<TileEdit>> m_RedoCommands;
+
+        //The open command, and the position of each tile's delta in it (for every tile of every sub-section)
+        vector<TileEdit> m_OpenCommand;
+        unsigned short* m_OpenCommandPositions;
+        bool m_IsCommandOpen;
+    };
+}
+
+#endif /* defined(__GameDev2D__TileEditLog__) */
@@ -0,0 +1,422 @@
+/*******************************************************************
+WorldEditorView.cpp
+
+Purpose:
+The world editor view lets the Level Editor show and paint the whole
+world (every SubSection in WORLD_NUMBER_OF_SUBSECTIONS) at once. It has
+its own Camera that can be zoomed and panned, the SubSections are only
+loaded once they scroll into view. When zoomed out, each SubSection is
+drawn from a cached thumbnail that is re-rendered when its tiles change.
+Only the SubSections that were modified are saved.
+*********************************************************************/
+
+#include "WorldEditorView.h"
+#include "LevelEditor.h"
+#include "TileEditLog.h"
+#include "LevelAutosave.h"
+#include "../SubSection.h"
+#include "../World.h"
+#include "../../Source/Services/ServiceLocator.h"
+#include "../../Source/Platforms/PlatformLayer.h"
+#include "../../Source/Graphics/Core/RenderTarget.h"
+
+namespace GameDev2D
+{
+    WorldEditorView::WorldEditorView(LevelEditor* aLevelEditor) : BaseObject("WorldEditorView"),
+        m_LevelEditor(aLevelEditor),
+        m_Camera(nullptr),
+        m_ThumbnailCamera(nullptr),
+        m_TileEditLog(nullptr),
+        m_SubSections(nullptr),
+        m_Thumbnails(nullptr),
+        m_SavedRevisions(nullptr),
+        m_ThumbnailRevisions(nullptr)
+    {
+        //Allocate the SubSection arrays, none of the SubSections are loaded until they are in view
+        unsigned int numberOfSubSections = WORLD_NUMBER_OF_SUBSECTIONS.x * WORLD_NUMBER_OF_SUBSECTIONS.y;
+        m_SubSections = new SubSection*[numberOfSubSections];
+        m_Thumbnails = new RenderTarget*[numberOfSubSections];
+        m_SavedRevisions = new unsigned int[numberOfSubSections];
+        m_ThumbnailRevisions = new unsigned int[numberOfSubSections];
+        for (unsigned int i = 0; i < numberOfSubSections; i++)
+        {
+            m_SubSections[i] = nullptr;
+            m_Thumbnails[i] = nullptr;
+            m_SavedRevisions[i] = 0;
+            m_ThumbnailRevisions[i] = 0;
+        }
+
+        //Create the edit history for the world's SubSections
+        unsigned int numberOfTiles = m_LevelEditor->GetNumberOfHorizontalTiles() * m_LevelEditor->GetNumberOfVerticalTiles();
+        m_TileEditLog = new TileEditLog(m_SubSections, numberOfSubSections, numberOfTiles);
+
+        //Create the cameras, the thumbnail camera only renders the thumbnails
+        m_Camera = new Camera();
+        m_ThumbnailCamera = new Camera();
+        m_ThumbnailCamera->SetZoom(WORLD_EDITOR_VIEW_THUMBNAIL_SCALE);
+
+        //Start with the whole world in view
+        ShowWholeWorld();
+    }
+
+    WorldEditorView::~WorldEditorView()
+    {
+        //Delete the edit history before the SubSections it refers to
+        SafeDelete(m_TileEditLog);
+
+        //Cycle through and delete the loaded SubSections and their thumbnails, their last changes are autosaved first
+        unsigned int numberOfSubSections = WORLD_NUMBER_OF_SUBSECTIONS.x * WORLD_NUMBER_OF_SUBSECTIONS.y;
+        for (unsigned int i = 0; i < numberOfSubSections; i++)
+        {
+            if (m_SubSections[i] != nullptr)
+            {
+                m_LevelEditor->GetAutosave()->Untrack(m_SubSections[i]);
+            }
+            SafeDelete(m_SubSections[i]);
+            SafeDelete(m_Thumbnails[i]);
+        }
+
+        //Delete the SubSection arrays
+        SafeDeleteArray(m_SubSections);
+        SafeDeleteArray(m_Thumbnails);
+        SafeDeleteArray(m_SavedRevisions);
+        SafeDeleteArray(m_ThumbnailRevisions);
+
+        //Delete the cameras
+        SafeDelete(m_Camera);
+        SafeDelete(m_ThumbnailCamera);
+    }
+
+    void WorldEditorView::Update(double aDelta)
+    {
+        //Pan the camera with the arrow keys
+        InputManager* inputManager = ServiceLocator::GetInputManager();
+        vec2 direction = vec2(0.0f, 0.0f);
+        if (inputManager->IsKeyPressed(KEY_CODE_LEFT) == true)
+        {
+            direction.x -= 1.0f;
+        }
+        if (inputManager->IsKeyPressed(KEY_CODE_RIGHT) == true)
+        {
+            direction.x += 1.0f;
+        }
+        if (inputManager->IsKeyPressed(KEY_CODE_DOWN) == true)
+        {
+            direction.y -= 1.0f;
+        }
+        if (inputManager->IsKeyPressed(KEY_CODE_UP) == true)
+        {
+            direction.y += 1.0f;
+        }
+        if (direction != vec2(0.0f, 0.0f))
+        {
+            //The view moves in the direction of the arrow keys, so the world moves the opposite way
+            Pan(-direction * WORLD_EDITOR_VIEW_PAN_SPEED * (float)aDelta);
+        }
+
+        //Update the camera
+        m_Camera->Update(aDelta);
+
+        //Get the camera's view bounds
+        vec2 viewMinimum;
+        vec2 viewMaximum;
+        m_Camera->GetViewBounds(viewMinimum, viewMaximum);
+
+        //Load the SubSections that have scrolled into view, a few at a time so that a frame doesn't load the whole world
+        unsigned int loads = 0;
+        vec2 subSectionSize = GetWorldSize() / vec2(WORLD_NUMBER_OF_SUBSECTIONS);
+        for (unsigned int i = 0; i < WORLD_NUMBER_OF_SUBSECTIONS.x * WORLD_NUMBER_OF_SUBSECTIONS.y && loads < WORLD_EDITOR_VIEW_LOADS_PER_FRAME; i++)
+        {
+            if (m_SubSections[i] == nullptr)
+            {
+                //Is the SubSection in view
+                uvec2 coordinates = uvec2(i % WORLD_NUMBER_OF_SUBSECTIONS.x, i / WORLD_NUMBER_OF_SUBSECTIONS.x);
+                vec2 minimum = vec2(coordinates) * subSectionSize;
+                vec2 maximum = minimum + subSectionSize;
+                if (minimum.x < viewMaximum.x && maximum.x > viewMinimum.x && minimum.y < viewMaximum.y && maximum.y > viewMinimum.y)
+                {
+                    LoadSubSection(i);
+                    loads++;
+                }
+            }
+        }
+    }
+
+    void WorldEditorView::Draw()
+    {
+        //Draw the world through the view's camera
+        Graphics* graphics = ServiceLocator::GetGraphics();
+        Camera* previousCamera = graphics->GetActiveCamera();
+        graphics->SetActiveCamera(m_Camera);
+
+        //When zoomed out, the tiles are too small to be worth drawing one by one
+        bool drawThumbnails = m_Camera->GetZoom() < WORLD_EDITOR_VIEW_THUMBNAIL_ZOOM;
+
+        for (unsigned int i = 0; i < WORLD_NUMBER_OF_SUBSECTIONS.x * WORLD_NUMBER_OF_SUBSECTIONS.y; i++)
+        {
+            SubSection* subSection = m_SubSections[i];
+            if (subSection == nullptr)
+            {
+                continue;
+            }
+
+            if (drawThumbnails == true)
+            {
+                //Cull the thumbnail against the camera's view
+                vec2 minimum = subSection->GetWorldPosition();
+                vec2 maximum = minimum + vec2(subSection->GetSize());
+                if (graphics->IsInView(minimum, maximum) == false)
+                {
+                    graphics->AddCulledObjects(1);
+                    continue;
+                }
+
+                //Re-render the thumbnail if the SubSection has changed since it was last rendered
+                if (m_Thumbnails[i] == nullptr || m_ThumbnailRevisions[i] != subSection->GetRevision())
+                {
+                    RefreshThumbnail(i);
+                }
+
+                //Draw the thumbnail scaled up to the SubSection's size
+                mat4 matrix = translate(mat4(1.0f), vec3(minimum.x, minimum.y, 0.0f));
+                matrix = scale(matrix, vec3(1.0f / WORLD_EDITOR_VIEW_THUMBNAIL_SCALE, 1.0f / WORLD_EDITOR_VIEW_THUMBNAIL_SCALE, 1.0f));
+                m_Thumbnails[i]->GetTextureFrame()->Draw(matrix);
+                graphics->AddDrawnObjects(1);
+            }
+            else
+            {
+                //The SubSection culls its own tiles
+                subSection->Draw();
+            }
+        }
+
+        //Set the previous camera back
+        graphics->SetActiveCamera(previousCamera);
+    }
+
+    void WorldEditorView::Zoom(float aSteps, vec2 aScreenPosition)
+    {
+        //Get the world position under the screen position before zooming
+        vec2 worldPosition = GetWorldPositionForScreenPosition(aScreenPosition);
+
+        //Calculate and clamp the new zoom
+        float zoom = m_Camera->GetZoom() * pow(WORLD_EDITOR_VIEW_ZOOM_STEP, aSteps);
+        zoom = clamp(zoom, GetMinimumZoom(), WORLD_EDITOR_VIEW_MAXIMUM_ZOOM);
+        m_Camera->SetZoom(zoom);
+
+        //Move the view so that the world position is back under the screen position
+        vec2 halfScreenSize = vec2((float)ServiceLocator::GetPlatformLayer()->GetWidth(), (float)ServiceLocator::GetPlatformLayer()->GetHeight()) / 2.0f;
+        SetViewCenter(worldPosition - (aScreenPosition - halfScreenSize) / zoom);
+    }
+
+    void WorldEditorView::Pan(vec2 aScreenOffset)
+    {
+        SetViewCenter(GetViewCenter() - aScreenOffset / m_Camera->GetZoom());
+    }
+
+    void WorldEditorView::ShowWholeWorld()
+    {
+        //Zoom out until the whole world fits in the tile area
+        float zoom = GetMinimumZoom();
+        m_Camera->SetZoom(zoom);
+
+        //Center the world in the tile area, the area above it is covered by the level editor's buttons
+        vec2 screenSize = vec2((float)ServiceLocator::GetPlatformLayer()->GetWidth(), (float)ServiceLocator::GetPlatformLayer()->GetHeight());
+        vec2 tileAreaCenter = vec2(screenSize.x, (float)(m_LevelEditor->GetTileSize() * m_LevelEditor->GetNumberOfVerticalTiles())) / 2.0f;
+        SetViewCenter(GetWorldSize() / 2.0f - (tileAreaCenter - screenSize / 2.0f) / zoom);
+    }
+
+    float WorldEditorView::GetZoom()
+    {
+        return m_Camera->GetZoom();
+    }
+
+    vec2 WorldEditorView::GetWorldPositionForScreenPosition(vec2 aScreenPosition)
+    {
+        vec2 halfScreenSize = vec2((float)ServiceLocator::GetPlatformLayer()->GetWidth(), (float)ServiceLocator::GetPlatformLayer()->GetHeight()) / 2.0f;
+        return GetViewCenter() + (aScreenPosition - halfScreenSize) / m_Camera->GetZoom();
+    }
+
+    vec2 WorldEditorView::GetScreenPositionForWorldPosition(vec2 aWorldPosition)
+    {
+        vec2 halfScreenSize = vec2((float)ServiceLocator::GetPlatformLayer()->GetWidth(), (float)ServiceLocator::GetPlatformLayer()->GetHeight()) / 2.0f;
+        return halfScreenSize + (aWorldPosition - GetViewCenter()) * m_Camera->GetZoom();
+    }
+
+    SubSection* WorldEditorView::GetSubSectionForWorldPosition(vec2 aWorldPosition, vec2& aLocalPosition)
+    {
+        //Safety check that the position is in the world
+        vec2 worldSize = GetWorldSize();
+        if (aWorldPosition.x < 0.0f || aWorldPosition.y < 0.0f || aWorldPosition.x >= worldSize.x || aWorldPosition.y >= worldSize.y)
+        {
+            return nullptr;
+        }
+
+        //Get the SubSection's coordinates for the world position
+        vec2 subSectionSize = worldSize / vec2(WORLD_NUMBER_OF_SUBSECTIONS);
+        uvec2 coordinates = uvec2(aWorldPosition / subSectionSize);
+        unsigned int index = coordinates.x + coordinates.y * WORLD_NUMBER_OF_SUBSECTIONS.x;
+
+        //The SubSection could still be waiting to be loaded
+        if (m_SubSections[index] == nullptr)
+        {
+            return nullptr;
+        }
+
+        aLocalPosition = aWorldPosition - m_SubSections[index]->GetWorldPosition();
+        return m_SubSections[index];
+    }
+
+    SubSection* WorldEditorView::GetSubSectionForCoordinates(uvec2 aCoordinates)
+    {
+        //Safety check the coordinates
+        if (aCoordinates.x >= WORLD_NUMBER_OF_SUBSECTIONS.x || aCoordinates.y >= WORLD_NUMBER_OF_SUBSECTIONS.y)
+        {
+            return nullptr;
+        }
+        return m_SubSections[aCoordinates.x + aCoordinates.y * WORLD_NUMBER_OF_SUBSECTIONS.x];
+    }
+
+    unsigned int WorldEditorView::SaveModifiedSubSections()
+    {
+        //An open brush stroke is part of what gets saved
+        m_TileEditLog->EndCommand();
+
+        //Wait for the autosave's queued writes, a compaction of one of the files can't replace the save
+        m_LevelEditor->GetAutosave()->WaitForJobs();
+
+        unsigned int saved = 0;
+        for (unsigned int i = 0; i < WORLD_NUMBER_OF_SUBSECTIONS.x * WORLD_NUMBER_OF_SUBSECTIONS.y; i++)
+        {
+            //Only the SubSections that changed since they were loaded or saved need to be written
+            if (m_SubSections[i] != nullptr && m_SubSections[i]->GetRevision() != m_SavedRevisions[i])
+            {
+                string filename;
+                GetFilenameForCoordinates(uvec2(i % WORLD_NUMBER_OF_SUBSECTIONS.x, i / WORLD_NUMBER_OF_SUBSECTIONS.x), filename);
+                m_SubSections[i]->Save(filename);
+                m_SavedRevisions[i] = m_SubSections[i]->GetRevision();
+                m_LevelEditor->GetAutosave()->MarkSaved(m_SubSections[i]);
+                saved++;
+            }
+        }
+
+        Log(VerbosityLevel_Debug, "Saved %u modified sub-sections", saved);
+        return saved;
+    }
+
+    bool WorldEditorView::HasUnsavedChanges()
+    {
+        for (unsigned int i = 0; i < WORLD_NUMBER_OF_SUBSECTIONS.x * WORLD_NUMBER_OF_SUBSECTIONS.y; i++)
+        {
+            if (m_SubSections[i] != nullptr && m_SubSections[i]->GetRevision() != m_SavedRevisions[i])
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    TileEditLog* WorldEditorView::GetTileEditLog()
+    {
+        return m_TileEditLog;
+    }
+
+    void WorldEditorView::GetFilenameForCoordinates(uvec2 aCoordinates, string& aFilename)
+    {
+        stringstream ss;
+        ss << "SaveData/SubSection" << aCoordinates.x << "-" << aCoordinates.y << ".bin";
+        aFilename = ss.str();
+    }
+
+    void WorldEditorView::LoadSubSection(unsigned int aIndex)
+    {
+        //Load the SubSection from its file, an empty SubSection is loaded if the file doesn't exist
+        uvec2 coordinates = uvec2(aIndex % WORLD_NUMBER_OF_SUBSECTIONS.x, aIndex / WORLD_NUMBER_OF_SUBSECTIONS.x);
+        string filename;
+        GetFilenameForCoordinates(coordinates, filename);
+        m_SubSections[aIndex] = new SubSection(m_LevelEditor, filename);
+
+        //Position the SubSection in the world, before it is drawn for the first time
+        uvec2 size = m_SubSections[aIndex]->GetSize();
+        m_SubSections[aIndex]->SetLocalPosition((float)(coordinates.x * size.x), (float)(coordinates.y * size.y));
+
+        //The loaded SubSection hasn't been modified
+        m_SavedRevisions[aIndex] = m_SubSections[aIndex]->GetRevision();
+
+        //Recover the edits that weren't compacted into the file, they are unsaved changes, and autosave the SubSection
+        m_LevelEditor->GetAutosave()->Recover(m_SubSections[aIndex], filename);
+        m_LevelEditor->GetAutosave()->Track(m_SubSections[aIndex], filename);
+    }
+
+    void WorldEditorView::RefreshThumbnail(unsigned int aIndex)
+    {
+        SubSection* subSection = m_SubSections[aIndex];
+        vec2 size = vec2(subSection->GetSize());
+
+        //Create the thumbnail's render target the first time it is needed
+        if (m_Thumbnails[aIndex] == nullptr)
+        {
+            m_Thumbnails[aIndex] = new RenderTarget((unsigned int)(size.x * WORLD_EDITOR_VIEW_THUMBNAIL_SCALE), (unsigned int)(size.y * WORLD_EDITOR_VIEW_THUMBNAIL_SCALE));
+            m_Thumbnails[aIndex]->CreateFrameBuffer();
+            m_Thumbnails[aIndex]->GetTextureFrame()->SetShader(ServiceLocator::GetShaderManager()->GetPassthroughTextureShader());
+        }
+
+        //Cache the graphics active camera and render target
+        Graphics* graphics = ServiceLocator::GetGraphics();
+        Camera* previousCamera = graphics->GetActiveCamera();
+        RenderTarget* previousRenderTarget = graphics->GetActiveRenderTarget();
+
+        //Set the thumbnail camera and render target, setting the render target only binds it and sets the viewport to its size
+        graphics->SetActiveCamera(m_ThumbnailCamera);
+        graphics->SetActiveRenderTarget(m_Thumbnails[aIndex]);
+        graphics->Clear();
+
+        //Center the thumbnail camera on the SubSection, the thumbnail camera's zoom scales the SubSection down to the render target
+        vec2 halfThumbnailSize = vec2((float)m_Thumbnails[aIndex]->GetWidth(), (float)m_Thumbnails[aIndex]->GetHeight()) / 2.0f;
+        m_ThumbnailCamera->SetPosition(halfThumbnailSize - (subSection->GetWorldPosition() + size / 2.0f));
+
+        //Setting the position only flags the view matrix as dirty and the camera isn't updated by a scene, reset its matrices
+        //while the render target is active so the projection is built for the render target's size rather than the screen's
+        m_ThumbnailCamera->ResetProjectionMatrix();
+        m_ThumbnailCamera->ResetViewMatrix();
+
+        //Draw the SubSection into the thumbnail
+        subSection->Draw();
+        m_ThumbnailRevisions[aIndex] = subSection->GetRevision();
+
+        //Set the original render target and camera back
+        graphics->SetActiveRenderTarget(previousRenderTarget);
+        graphics->SetActiveCamera(previousCamera);
+    }
+
+    vec2 WorldEditorView::GetWorldSize()
+    {
+        float tileSize = (float)m_LevelEditor->GetTileSize();
+        return vec2(WORLD_NUMBER_OF_SUBSECTIONS) * vec2(m_LevelEditor->GetNumberOfHorizontalTiles() * tileSize, m_LevelEditor->GetNumberOfVerticalTiles() * tileSize);
+    }
+
+    vec2 WorldEditorView::GetViewCenter()
+    {
+        //The camera's position is the offset of the world from the bottom left corner of the screen
+        vec2 halfScreenSize = vec2((float)ServiceLocator::GetPlatformLayer()->GetWidth(), (float)ServiceLocator::GetPlatformLayer()->GetHeight()) / 2.0f;
+        return halfScreenSize - m_Camera->GetPosition();
+    }
+
+    void WorldEditorView::SetViewCenter(vec2 aCenter)
+    {
+        //Keep the center of the view within the world, so the world can't be panned out of view
+        vec2 center = clamp(aCenter, vec2(0.0f, 0.0f), GetWorldSize());
+
+        vec2 halfScreenSize = vec2((float)ServiceLocator::GetPlatformLayer()->GetWidth(), (float)ServiceLocator::GetPlatformLayer()->GetHeight()) / 2.0f;
+        m_Camera->SetPosition(halfScreenSize - center);
+    }
+
+    float WorldEditorView::GetMinimumZoom()
+    {
+        //The zoom that fits the whole world in the tile area
+        vec2 worldSize = GetWorldSize();
+        float width = (float)ServiceLocator::GetPlatformLayer()->GetWidth();
+        float height = (float)(m_LevelEditor->GetTileSize() * m_LevelEditor->GetNumberOfVerticalTiles());
+        return glm::min(glm::min(width / worldSize.x, height / worldSize.y), WORLD_EDITOR_VIEW_MAXIMUM_ZOOM);
+    }
+}
@@ -0,0 +1,122 @@
+/*******************************************************************
+WorldEditorView.h
+
+Purpose:
+The world editor view lets the Level Editor show and paint the whole
+world (every SubSection in WORLD_NUMBER_OF_SUBSECTIONS) at once. It has
+its own Camera that can be zoomed and panned, the SubSections are only
+loaded once they scroll into view. When zoomed out, each SubSection is
+drawn from a cached thumbnail that is re-rendered when its tiles change.
+Only the SubSections that were modified are saved.
+*********************************************************************/
+
+#ifndef __GameDev2D__WorldEditorView__
+#define __GameDev2D__WorldEditorView__
+
+#include "../../Source/Core/BaseObject.h"
+
+using namespace glm;
+
+namespace GameDev2D
+{
+    //Local constants
+    const float WORLD_EDITOR_VIEW_MAXIMUM_ZOOM = 1.0f;
+    const float WORLD_EDITOR_VIEW_ZOOM_STEP = 1.25f;
+    const float WORLD_EDITOR_VIEW_PAN_SPEED = 800.0f;
+    const float WORLD_EDITOR_VIEW_THUMBNAIL_SCALE = 0.25f;
+    const float WORLD_EDITOR_VIEW_THUMBNAIL_ZOOM = 0.5f;
+    const unsigned int WORLD_EDITOR_VIEW_LOADS_PER_FRAME = 1;
+
+    //Forward declarations
+    class LevelEditor;
+    class SubSection;
+    class Camera;
+    class RenderTarget;
+    class TileEditLog;
+
+    /***************************************************************
+    Class: WorldEditorView
+    Owns a SubSection for each coordinate in the world, a SubSection is
+    null until it has been in the camera's view. The screen positions
+    passed in are mouse positions, the world positions are relative to
+    the bottom left corner of the world.
+    ***************************************************************/
+    class WorldEditorView : public BaseObject
+    {
+    public:
+        WorldEditorView(LevelEditor* levelEditor);
+        ~WorldEditorView();
+
+        //Pans the camera with the arrow keys and loads the SubSections that have scrolled into view
+        void Update(double delta);
+
+        //Draws the loaded SubSections through the view's camera, from their thumbnails when zoomed out
+        void Draw();
+
+        //Zooms the camera in (positive steps) or out (negative steps), the world position under the screen position doesn't move
+        void Zoom(float steps, vec2 screenPosition);
+
+        //Pans the camera by an offset in screen space, the world moves along with the offset
+        void Pan(vec2 screenOffset);
+
+        //Zooms and centers the camera so that the whole world fits in the level editor's tile area
+        void ShowWholeWorld();
+
+        //Returns the camera's zoom
+        float GetZoom();
+
+        //Converts between a screen position and a world position
+        vec2 GetWorldPositionForScreenPosition(vec2 screenPosition);
+        vec2 GetScreenPositionForWorldPosition(vec2 worldPosition);
+
+        //Returns the loaded SubSection at the world position and sets the position relative to the SubSection,
+        //returns null if the position is outside the world or the SubSection hasn't been loaded yet
+        SubSection* GetSubSectionForWorldPosition(vec2 worldPosition, vec2& localPosition);
+
+        //Returns the loaded SubSection for the SubSection coordinates, returns null if it hasn't been loaded yet
+        SubSection* GetSubSectionForCoordinates(uvec2 coordinates);
+
+        //Saves the SubSections that have been modified since they were loaded or saved, returns the number of SubSections saved
+        unsigned int SaveModifiedSubSections();
+
+        //Returns wether any of the loaded SubSections has been modified since it was loaded or saved
+        bool HasUnsavedChanges();
+
+        //Returns the undo and redo history for the world's SubSections
+        TileEditLog* GetTileEditLog();
+
+        //Sets the filename a SubSection is loaded from and saved to, based on its coordinates
+        static void GetFilenameForCoordinates(uvec2 coordinates, string& filename);
+
+    private:
+        //Loads the SubSection at the index and positions it in the world
+        void LoadSubSection(unsigned int index);
+
+        //Renders the SubSection at the index into its thumbnail
+        void RefreshThumbnail(unsigned int index);
+
+        //Returns the size of the world, and the center of the camera's view in world space
+        vec2 GetWorldSize();
+        vec2 GetViewCenter();
+
+        //Sets the camera's position so that the world position is in the center of the view, the center is kept within the world
+        void SetViewCenter(vec2 center);
+
+        //Returns the minimum zoom, which fits the whole world in the level editor's tile area
+        float GetMinimumZoom();
+
+        //Member variables
+        LevelEditor* m_LevelEditor;
+        Camera* m_Camera;
+        Camera* m_ThumbnailCamera;
+        TileEditLog* m_TileEditLog;
+
+        //SubSection data, each array has one entry per SubSection
+        SubSection** m_SubSections;
+        RenderTarget** m_Thumbnails;
+        unsigned int* m_SavedRevisions;
+        unsigned int* m_ThumbnailRevisions;
+    };
+}
+
+#endif /* defined(__GameDev2D__WorldEditorView__) */
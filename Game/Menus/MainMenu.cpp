@@ -15,17 +15,29 @@
 
 namespace GameDev2D
 {
-    MainMenu::MainMenu() : Menu("MainMenu")
+    MainMenu::MainMenu() : Menu("MainMenu"),
+        m_Game(nullptr),
+        m_LevelEditor(nullptr)
     {
 
     }
 
     MainMenu::~MainMenu()
     {
+        //Delete the preloaded scenes that weren't pushed
+        SafeDelete(m_Game);
+        SafeDelete(m_LevelEditor);
     }
 
     float MainMenu::LoadContent()
     {
+        //Preload the background, the menu is created once it has been decoded on a worker thread
+        ServiceLocator::GetTextureManager()->PreloadTexture("MainMenuBackground", "Images/");
+        if (ServiceLocator::GetTextureManager()->IsTexturePreloading("MainMenuBackground") == true)
+        {
+            return 0.0f;
+        }
+
         //Set background
         SetBackground("MainMenuBackground");
 
@@ -40,6 +52,12 @@ namespace GameDev2D
         //Load music
         m_MenuTheme = new Audio("TitleTheme", "mp3", true, true);//The music will start playing when we transition to the menu
 
+        //Preload the game and the level editor in the background, so there is no loading screen once a button is selected
+        m_Game = new Game();
+        ServiceLocator::GetSceneManager()->PreloadScene(m_Game);
+        m_LevelEditor = new LevelEditor();
+        ServiceLocator::GetSceneManager()->PreloadScene(m_LevelEditor);
+
         return 1.0f;
     }
 
@@ -82,11 +100,17 @@ namespace GameDev2D
         switch (aButtonIndex)
         {
         case MainMenuStart:
-            ServiceLocator::GetSceneManager()->PushScene(new Game(), true);
+            //Push the preloaded game, the SceneManager is responsible for deleting it, the level editor isn't needed
+            ServiceLocator::GetSceneManager()->PushScene(m_Game, true);
+            m_Game = nullptr;
+            SafeDelete(m_LevelEditor);
             break;
 
         case MainMenuLevelEditor:
-            ServiceLocator::GetSceneManager()->PushScene(new LevelEditor(), true);
+            //Push the preloaded level editor, the SceneManager is responsible for deleting it, the game isn't needed
+            ServiceLocator::GetSceneManager()->PushScene(m_LevelEditor, true);
+            m_LevelEditor = nullptr;
+            SafeDelete(m_Game);
             break;
 
         case MainMenuExit:
@@ -17,6 +17,9 @@ const double MAIN_MENU_TRANSITION_OFF_DURATION = 1.5;
 
 namespace GameDev2D
 {
+    //Forward declarations
+    class Game;
+    class LevelEditor;
 
     enum MainMenuOptions
     {
@@ -38,6 +41,11 @@ namespace GameDev2D
     protected:
         virtual void WillTransitionOn();
         virtual double WillTransitionOff();
+
+    private:
+        //The game and the level editor are preloaded while the main menu is shown
+        Game* m_Game;
+        LevelEditor* m_LevelEditor;
     };
 }
 
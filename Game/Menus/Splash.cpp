@@ -18,7 +18,8 @@
 
 namespace GameDev2D
 {
-    Splash::Splash() : Scene("Splash")
+    Splash::Splash() : Scene("Splash"),
+        m_MainMenu(nullptr)
     {
 
     }
@@ -26,6 +27,9 @@ namespace GameDev2D
     Splash::~Splash()
     {
         //The base class (Scene) will delete all the GameObjects added to the Scene
+        
+        //Delete the main menu, if it wasn't pushed
+        SafeDelete(m_MainMenu);
     }
 
     float Splash::LoadContent()
@@ -50,6 +54,10 @@ namespace GameDev2D
         //Delay the TransitionToGame method 2.5 seconds
         DelaySceneMethod(&Splash::TransitionToGame, SPLASH_TRANSITION_TO_GAME_DELAY);
 
+        //Preload the main menu in the background while the splash is shown
+        m_MainMenu = new MainMenu();
+        ServiceLocator::GetSceneManager()->PreloadScene(m_MainMenu);
+
         return 1.0f;
     }
 
@@ -77,6 +85,8 @@ namespace GameDev2D
 
     void Splash::TransitionToGame()
     {
-        ServiceLocator::GetSceneManager()->PushScene(new MainMenu(), true);
+        //Push the preloaded main menu, the SceneManager is responsible for deleting it
+        ServiceLocator::GetSceneManager()->PushScene(m_MainMenu, true);
+        m_MainMenu = nullptr;
     }
 }
\ No newline at end of file
@@ -49,6 +49,7 @@ namespace GameDev2D
 
         //Member variable
         Sprite* m_Logo;
+        MainMenu* m_MainMenu;
     };
 }
 
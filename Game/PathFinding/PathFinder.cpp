@@ -10,14 +10,14 @@
 ChangeLog
 _______________________________________________
 - Implemented PathFind function in Pathfinder.cpp, according to video.
+- The path node scores are debug drawn with the DebugRenderer service, removed the debug Label and Rect.
+- The adjacent tiles are collected in a vector allocated from the frame arena, once per search.
 */
 
 #include "PathFinder.h"
 #include "PathNode.h"
 #include "../SubSection.h"
 #include "../Tiles/Tile.h"
-#include "../../Source/UI/UI.h"
-#include "../../Source/Graphics/Primitives/Primitives.h"
 
 
 namespace GameDev2D
@@ -25,23 +25,13 @@ namespace GameDev2D
     PathFinder::PathFinder(SubSection* aSubSection) : BaseObject("PathFinder"),
         m_SubSection(aSubSection),
         m_State(StateIdle),
-        m_DestinationTileIndex(-1),
-        m_DebugLabel(nullptr),
-        m_DebugRect(nullptr)
+        m_DestinationTileIndex(-1)
     {
-#if DEBUG
-        m_DebugLabel = new Label("OpenSans-CondBold", "ttf", 18);
-        m_DebugRect = new Rect();
-        m_DebugRect->SetIsFilled(false);
-        m_DebugRect->SetAnchorPoint(0.5f, 0.5f);
-#endif
+
     }
 
     PathFinder::~PathFinder()
     {
-        SafeDelete(m_DebugLabel);
-        SafeDelete(m_DebugRect);
-
         ClearPathNodes();
     }
 
@@ -49,24 +39,21 @@ namespace GameDev2D
     {
 #if DEBUG
         //Paint the open list path scoring
-        m_DebugRect->SetColor(Color::BlueColor());
         for (unsigned int i = 0; i < m_PathNodeOpen.size(); i++)
         {
-            m_PathNodeOpen.at(i)->DebugDraw(m_DebugLabel, m_DebugRect);
+            m_PathNodeOpen.at(i)->DebugDraw(Color::BlueColor());
         }
 
         //Paint the closed list path scoring
-        m_DebugRect->SetColor(Color::RedColor());
         for (unsigned int i = 0; i < m_PathNodeClosed.size(); i++)
         {
-            m_PathNodeClosed.at(i)->DebugDraw(m_DebugLabel, m_DebugRect);
+            m_PathNodeClosed.at(i)->DebugDraw(Color::RedColor());
         }
 
         //Paint the final path scoring
-        m_DebugRect->SetColor(Color::YellowColor());
         for (unsigned int i = 0; i < m_PathNodeFinal.size(); i++)
         {
-            m_PathNodeFinal.at(i)->DebugDraw(m_DebugLabel, m_DebugRect);
+            m_PathNodeFinal.at(i)->DebugDraw(Color::YellowColor());
         }
 #endif
     }
@@ -133,6 +120,10 @@ namespace GameDev2D
                 //Set the state to searching
                 m_State = StateSearchingPath;
 
+                //The adjacent tiles of the current node, there are at most four. They are allocated from the frame arena
+                FrameVector<Tile*> adjacentTiles;
+                adjacentTiles.reserve(4);
+
                 //Go through the open list until we find a path, or we check all the tiles and don't find a path
                 while (IsSearchingForPath() == true && m_DestinationTileIndex != -1)
                 {
@@ -169,7 +160,7 @@ namespace GameDev2D
 
                     //If this current node is not the destination tile, search the tiles adjacent
                     //to it.
-                    vector <Tile*> adjacentTiles;
+                    adjacentTiles.clear();
 
                     //Check the tiles adjacent to the current one, including if they are walkable and add them to the vector
                     //Up tile
@@ -258,7 +249,7 @@ namespace GameDev2D
         return nullptr;
     }
 
-    void PathFinder::AddAdjacentTile(std::vector<Tile*>& aAdjacentTiles, Tile* aCurrentTile, int aDeltaX, int aDeltaY)
+    void PathFinder::AddAdjacentTile(FrameVector<Tile*>& aAdjacentTiles, Tile* aCurrentTile, int aDeltaX, int aDeltaY)
     {
         //Get the adjacent tile's coordinates
         ivec2 adjacentCoordinate = m_SubSection->GetTileCoordinatesForPosition(aCurrentTile->GetCenter(false));
@@ -11,6 +11,7 @@
 
 #include "../../Source/Core/BaseObject.h"
 #include "PathNode.h"
+#include "../../Source/Services/FrameArena/FrameAllocator.h"
 
 
 namespace GameDev2D
@@ -27,8 +28,6 @@ namespace GameDev2D
     //Forward declaration
     class SubSection;
     class Tile;
-    class Label;
-    class Rect;
 
     //The Path finder class with search the walkable tiles in a subsection for a path based on a starting tile and a destination tile
     class PathFinder : public BaseObject
@@ -58,7 +57,7 @@ namespace GameDev2D
 
     private:
         //Adds add adjacent tile to the adjacentTiles parameter if it is walkable
-        void AddAdjacentTile(vector<Tile*>& adjacentTiles, Tile* currentTile, int deltaX, int deltaY);
+        void AddAdjacentTile(FrameVector<Tile*>& adjacentTiles, Tile* currentTile, int deltaX, int deltaY);
 
         //Checks if a tile already exists in the Open and Closed List
         bool DoesTileExistInClosedList(Tile* tile);
@@ -89,8 +88,6 @@ namespace GameDev2D
         std::vector<PathNode*> m_PathNodeOpen;
         std::vector<PathNode*> m_PathNodeClosed;
         std::vector<PathNode*> m_PathNodeFinal;
-        Label* m_DebugLabel;
-        Rect* m_DebugRect;
     };
 }
 
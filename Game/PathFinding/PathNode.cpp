@@ -8,8 +8,7 @@
 
 #include "PathNode.h"
 #include "../Tiles/Tile.h"
-#include "../../Source/UI/UI.h"
-#include "../../Source/Graphics/Primitives/Primitives.h"
+#include "../../Source/Services/ServiceLocator.h"
 
 
 namespace GameDev2D
@@ -35,37 +34,31 @@ namespace GameDev2D
 
     }
     
-    void PathNode::DebugDraw(Label* aLabel, Rect* aRect)
+    void PathNode::DebugDraw(Color aColor)
     {
 #if DEBUG
+        //Get the debug renderer and the tile's world position and size
+        DebugRenderer* debugRenderer = ServiceLocator::GetDebugRenderer();
+        vec2 position = GetTile()->GetWorldPosition();
+        float size = (float)GetTile()->GetSize();
+
         //Draw the rect, the color represent which list the path node is in
-        aRect->SetLocalPosition(GetTile()->GetCenter(false));
-        aRect->SetSize((float)GetTile()->GetSize(), (float)GetTile()->GetSize());
-        aRect->Draw();
+        debugRenderer->DrawRect(position, vec2(size, size), aColor);
 
         //Draw the F score
         stringstream ss;
         ss << GetScoreF();
-        aLabel->SetText(ss.str());
-        aLabel->SetAnchorPoint(0.0f, 1.0f);
-        aLabel->SetLocalPosition(vec2(GetTile()->GetLocalX(), GetTile()->GetLocalY() + GetTile()->GetSize()));
-        aLabel->Draw();
+        debugRenderer->DrawText(ss.str(), vec2(position.x, position.y + size), Color::WhiteColor(), PATH_NODE_DEBUG_FONT_SIZE, vec2(0.0f, 1.0f));
         
         //Draw the S score
         ss.str("");
         ss << GetScoreG();
-        aLabel->SetText(ss.str());
-        aLabel->SetAnchorPoint(0.0f, 0.0f);
-        aLabel->SetLocalPosition(vec2(GetTile()->GetLocalX(), GetTile()->GetLocalY()));
-        aLabel->Draw();
+        debugRenderer->DrawText(ss.str(), position, Color::WhiteColor(), PATH_NODE_DEBUG_FONT_SIZE, vec2(0.0f, 0.0f));
         
         //Draw the H score
         ss.str("");
         ss << GetScoreH();
-        aLabel->SetText(ss.str());
-        aLabel->SetAnchorPoint(1.0f, 0.0f);
-        aLabel->SetLocalPosition(vec2(GetTile()->GetLocalX() + GetTile()->GetSize(), GetTile()->GetLocalY()));
-        aLabel->Draw();
+        debugRenderer->DrawText(ss.str(), vec2(position.x + size, position.y), Color::WhiteColor(), PATH_NODE_DEBUG_FONT_SIZE, vec2(1.0f, 0.0f));
 #endif
     }
 
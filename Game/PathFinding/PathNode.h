@@ -10,26 +10,28 @@
 #define __GameDev2D__PathNode__
 
 #include "../../Source/Core/BaseObject.h"
+#include "../../Source/Core/MemoryTracker.h"
 #include "../../Source/Graphics/Core/Color.h"
 
 namespace GameDev2D
 {
+    //Local constants
+    const float PATH_NODE_DEBUG_FONT_SIZE = 18.0f;
+
     //Forward declarations
     class Tile;
-    class Label;
-    class Rect;
 
     //The PathNode class represents a Tile in a Subsection, it contains data like the Tile's
     //G, H, and F score as well as the parent PathNode
-    class PathNode : public BaseObject
+    class PathNode : public BaseObject, public MemoryTracked<MemoryTag_PathNodes>
     {
     public:
         PathNode(Tile* tile, unsigned int scoreH);
         PathNode(Tile* tile, PathNode* parent, unsigned int scoreH);
         ~PathNode();
         
-        //Used to draw the path node's score
-        void DebugDraw(Label* label, Rect* rect);
+        //Used to draw the path node's score with the DebugRenderer, the color represents which list the path node is in
+        void DebugDraw(Color color);
         
         //Returns the tile associated with the PathNode
         Tile* GetTile();
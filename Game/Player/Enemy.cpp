@@ -21,6 +21,12 @@ _______________________________________________
 -Overwrote function ApplyDamage in Enemy.cpp so that the damaged sound could be played.
 -Added hit and death sounds in Enemy.cpp.
 -Implemented walking state
+-Enemy projectiles are now fired through the World's projectile manager, which updates, collides and draws them
+-The enemy now notifies its SubSection when it changes tiles, so the SubSection's enemy buckets stay up to date
+-Removed the per enemy Audio objects, the hit and death sounds are fire and forget sound effects
+-The enemy can be updated on a worker thread, the damage to the hero, projectiles and debug draw refreshes are deferred
+to its SubSection. The random number generator is seeded from the World's seed and the spawn tile
+-The pathfinding debug draw is redrawn every frame by the SubSection, StartWalking no longer refreshes it
 */
 
 #include "Enemy.h"
@@ -31,8 +37,8 @@ _______________________________________________
 #include "../PathFinding/PathFinder.h"
 #include "../../Source/UI/UI.h"
 #include "../../Source/Animation/Random.h"
-#include "../../Source/Audio/Audio.h"
-#include "../Projectile.h"
+#include "../../Source/Services/ServiceLocator.h"
+#include "../ProjectileManager.h"
 #include "../Pickups/HeartPickup.h"
 #include "../Pickups/GreenRupeePickup.h"
 #include "../Pickups/BlueRupeePickup.h"
@@ -43,10 +49,7 @@ namespace GameDev2D
 		m_PathFinder(nullptr),
 		m_EnemyState(EnemyUnknown),
 		m_Random(nullptr),
-		m_PathIndex(0),
-		m_DamagedSound(nullptr),
-		m_DeadSound(nullptr),
-		m_ProjectilePool(ENEMY_DEFAULT_NUMBER_PROJECTILES)
+		m_PathIndex(0)
 	{
 		//Set the local position of the hero, based on the center of the spawn tile
 		SetLocalPosition(aSpawnTile->GetCenter(true));
@@ -55,9 +58,11 @@ namespace GameDev2D
 		SubSection* subSection = m_World->GetSubSectionForPlayer(this);
 		m_PathFinder = new PathFinder(subSection);
 
-		//Create the random number generator object
+		//Create the random number generator object, seeded from the world's seed and the spawn tile so that the
+		//enemy behaves the same with the same seed, no matter which thread it is updated on
 		m_Random = new Random();
-		m_Random->RandomizeSeed();
+		unsigned int subSectionIndex = m_World->GetSubSectionIndexForSubSection(subSection);
+		m_Random->SetSeed(m_World->GetSeed() + subSectionIndex * m_World->GetNumberOfTiles() + aSpawnTile->GetIndex());
 
 		//Cycle through and create the walking and attacking sprites for all 4 directions
 		for (unsigned int i = 0; i < PLAYER_DIRECTION_COUNT; i++)
@@ -74,9 +79,9 @@ namespace GameDev2D
 
 
 
-		//Create sounds
-		m_DamagedSound = new Audio("EnemyHit", "wav", false, false);
-		m_DeadSound = new Audio("EnemyDeath", "wav", false, false);
+		//Preload the sound effects, every enemy shares the same sounds
+		ServiceLocator::GetAudioManager()->PreloadSoundEffect("EnemyHit", "wav");
+		ServiceLocator::GetAudioManager()->PreloadSoundEffect("EnemyDeath", "wav");
 
 		//Set the enemy's state to idle
 		SetState(EnemyIdle);
@@ -95,25 +100,20 @@ namespace GameDev2D
 		{
 			SafeDelete(m_WalkingSprite[i]);
 		}
-
-		//Delete sounds
-		SafeDelete(m_DamagedSound);
-		SafeDelete(m_DeadSound);
 	}
 
 	void Enemy::Update(double aDelta)
 	{
 
-		//Get the hero and the tile the hero is on
-		Hero* hero = m_World->GetHero();
-		Tile* heroTile = hero->GetTile();
+		//Get the tile the hero was on at the start of the world's update
+		Tile* heroTile = m_World->GetHeroTile();
 
 		if (IsEnabled() == true)
 		{
-			//If the hero tile is the same tile the enemy is on, apply some damage
-			if (heroTile == GetTile())
+			//If the hero tile is the same tile the enemy is on, apply some damage once the sub-sections are updated
+			if (heroTile != nullptr && heroTile == GetTile())
 			{
-				hero->ApplyDamage(GetAttackDamage());
+				GetSubSection()->DeferHeroDamage(GetAttackDamage());
 			}
 
 			//Cache the tile before we update the player's position
@@ -130,43 +130,8 @@ namespace GameDev2D
 			}
 
 		}
-
-		//Update the enemy active projectiles, this is done even if the enemy is disabled
-		vector<Projectile*> activeProjectiles = m_ProjectilePool.GetCurrentlyActiveObjects();
-		for (unsigned int i = 0; i < activeProjectiles.size(); i++)
-		{
-			if (activeProjectiles.at(i) != nullptr)//If it is a valid object
-			{
-				activeProjectiles.at(i)->Update(aDelta);//Update it
-
-				//Collision check against hero
-				//If the hero tile is the same tile as the projectile, 
-				if (heroTile == activeProjectiles.at(i)->GetProjectileTile())
-				{
-					hero->ApplyDamage(activeProjectiles.at(i)->GetAttackDamage()); //Apply damage
-					activeProjectiles.at(i)->DeactivateProjectile(); //Deactivate the projectile
-				}
-
-			}
-		}
 	}
 
-	void Enemy::Draw()
-	{
-		Player::Draw();//Draw the parent draw function
-
-		//Draw the enemy active projectiles
-		vector<Projectile*> activeProjectiles = m_ProjectilePool.GetCurrentlyActiveObjects();
-		for (unsigned int i = 0; i < activeProjectiles.size(); i++)
-		{
-			if (activeProjectiles.at(i) != nullptr)//If it is a valid object
-			{
-				activeProjectiles.at(i)->Draw();//Draw it
-			}
-		}
-	}
-
-
 	void Enemy::DebugDraw()
 	{
 #if DEBUG
@@ -263,13 +228,14 @@ namespace GameDev2D
 		{
 			//Get the enemy's current subsection and the hero's
 			SubSection* enemySubsection = GetSubSection();//the subsection of this enemy
-			SubSection* heroSubSection = m_World->GetHero()->GetSubSection();
+			Tile* heroTile = m_World->GetHeroTile();
+			SubSection* heroSubSection = heroTile != nullptr ? heroTile->GetSubSection() : nullptr;
 
 			//Ensure the hero is on the same subsection as our enemy
 			if (enemySubsection == heroSubSection)
 			{
 				//find the path to the hero
-				Tile* destination = m_World->GetHero()->GetTile();//Set the destination to be the tile where the hero is
+				Tile* destination = heroTile;//Set the destination to be the tile where the hero is
 				bool pathFound = m_PathFinder->FindPath(GetTile(), destination);//Check for a path
 
 				//Check if a path was found
@@ -314,10 +280,7 @@ namespace GameDev2D
 	void Enemy::HasDied()
 	{
 		//Play a sound effect
-		if (m_DeadSound != nullptr)
-		{
-			m_DeadSound->Play();
-		}
+		ServiceLocator::GetAudioManager()->PlaySoundEffect("EnemyDeath", "wav");
 
 		//Set the enemy state to dead
 		SetState(EnemyDead);
@@ -379,15 +342,15 @@ namespace GameDev2D
 
 	}
 
+	void Enemy::HasChangedTiles(Tile* aNewTile, Tile* aOldTile)
+	{
+		//Enemies can't leave their subsection, move the enemy to the new tile's bucket
+		aNewTile->GetSubSection()->EnemyChangedTiles(this, aNewTile, aOldTile);
+	}
+
 	//Called when the pathfinder found a path to the destination
 	void Enemy::StartWalking()
 	{
-		//refresh the A* debug drawing if the flags are set
-		if ((GetSubSection()->GetDebugDrawFlags()&DebugDrawPathFindingScores) > 0)
-		{
-			GetSubSection()->RefreshDebugDraw();
-		}
-
 		//Reset the path index
 		m_PathIndex = 0;
 
@@ -484,11 +447,8 @@ namespace GameDev2D
 
 	void Enemy::FireProjectile()
 	{
-		Projectile* activeProjectile = m_ProjectilePool.GetActivateObject();//Get and activate a projectile
-		if (activeProjectile != nullptr)
-		{
-			activeProjectile->Fire(GetSubSection(), GetLocalPosition(), GetDirection(), ENEMY_PROJECTILE_DEFAULT_SPEED, ENEMY_PROJECTILE_DEFAULT_ATTACK_DAMAGE);//Fire the projectile
-		}
+		//Fire the projectile once the sub-sections are updated, if the projectile manager is full the projectile isn't fired
+		GetSubSection()->DeferProjectile(ProjectileOwnerEnemy, GetLocalPosition(), GetDirection(), ENEMY_PROJECTILE_DEFAULT_SPEED, ENEMY_PROJECTILE_DEFAULT_ATTACK_DAMAGE);
 
 		//Set the state back to idle
 		SetState(EnemyIdle);
@@ -500,10 +460,7 @@ namespace GameDev2D
 		Player::ApplyDamage(aAttackDamage);
 
 		//Play a sound effect
-		if (m_DamagedSound != nullptr)
-		{
-			m_DamagedSound->Play();
-		}
+		ServiceLocator::GetAudioManager()->PlaySoundEffect("EnemyHit", "wav");
 	}
 
 }
\ No newline at end of file
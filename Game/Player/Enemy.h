@@ -12,14 +12,14 @@ _______________________________________________
 -Added enemy searching and attacking states
 -Added constants for the chances of enemy dropping something upon death.
 -Added constants for flickering alpha.
+-The Enemy objects are tracked by the MemoryTracker, under the Enemies memory tag.
 */
 
 #ifndef __GameDev2D__Enemy__
 #define __GameDev2D__Enemy__
 
 #include "Player.h"
-#include "../Pool.h"
-#include "../Projectile.h"
+#include "../../Source/Core/MemoryTracker.h"
 
 namespace GameDev2D
 {
@@ -47,9 +47,8 @@ namespace GameDev2D
     const unsigned int ENEMY_MIN_IDLE_TIME = 1;//1
     const unsigned int ENEMY_MAX_IDLE_TIME = 2;//4
     const double ENEMY_PROJECTILE_DELAY = 1.5;//1.5
-    const unsigned int ENEMY_DEFAULT_NUMBER_PROJECTILES = 5;
     const float ENEMY_PROJECTILE_DEFAULT_SPEED = 100.0f;
-    const int ENEMY_PROJECTILE_DEFAULT_ATTACK_DAMAGE = 1;
+    const unsigned int ENEMY_PROJECTILE_DEFAULT_ATTACK_DAMAGE = 1;
 
     //Enemy random drop rate percentage
 
@@ -75,12 +74,11 @@ namespace GameDev2D
     class PathFinder;
     class SubSection;
     class Random;
-    class Audio;
 
     //Create an enemy object, enemies can be killed by the Hero's sword and can apply damage to the hero when they share
     //the same time. The enemy will cycle its behaviour between Idle, randomly walking, searching for the hero and
     //firing a projectile at the hero.
-    class Enemy : public Player
+    class Enemy : public Player, public MemoryTracked<MemoryTag_Enemies>
     {
     public:
         Enemy(World* world, Tile* spawnTile);
@@ -89,8 +87,6 @@ namespace GameDev2D
         //Update method, used to perform pathfinding operations
         void Update(double delta);
 
-        void Draw();
-
         //Debug Draw method, use to draw pathfinding debug data
         void DebugDraw();
 
@@ -107,6 +103,9 @@ namespace GameDev2D
         //Called when the Enemy has died
         void HasDied();
 
+        //Called when the Enemy has changed tiles, keeps the SubSection's enemy buckets up to date
+        void HasChangedTiles(Tile* newTile, Tile* oldTile);
+
         //Called when the pathfinder found a path to the destination
         void StartWalking();
 
@@ -127,12 +126,6 @@ namespace GameDev2D
         EnemyState m_EnemyState;
         Random* m_Random;
         unsigned int m_PathIndex;
-        Audio* m_DamagedSound;
-        Audio* m_DeadSound;
-
-        //Projectiles object pooling
-        Pool<Projectile> m_ProjectilePool;
-
     };
 }
 
@@ -27,6 +27,10 @@ into 2 new fucntions , HeroAttackCollision and HeroMovementCollision.
 -In the update method the alpha of the hero now flickers when he is invicible, and stays solid when he is not invincible.
 -Implemented stop music, and ensure that on dead all music is stopped.
 -A sound is played when the hero is hurt
+-The hero projectile is now fired through the World's projectile manager, which also handles its collision against the enemies
+-HeroAttackCollision now only checks the enemies in the sword tile's bucket, instead of every active enemy in the subsection
+-The sword, hurt and pickup sounds are now fire and forget sound effects played through the AudioManager
+-The movement collision points are kept in an array on the stack, instead of a vector allocated every update
 */
 
 #include "Hero.h"
@@ -36,7 +40,7 @@ into 2 new fucntions , HeroAttackCollision and HeroMovementCollision.
 #include "../Tiles/Tile.h"
 #include "../Pickups/Pickup.h"
 #include "../Pickups/HeartPickup.h"
-#include "../HeroProjectile.h"
+#include "../ProjectileManager.h"
 #include "../../Source/UI/UI.h"
 #include "../../Source/Events/Input/InputEvents.h"
 #include "../../Source/Services/ServiceLocator.h"
@@ -52,13 +56,7 @@ namespace GameDev2D
         m_Rupees(0),
         m_HasSword(HERO_HAS_SWORD_BY_DEFAULT),
         m_InvincibilityTimer(nullptr),
-        m_SwordAttackSound(nullptr),
-        m_LowHealthSound(nullptr),
-        m_HeartPickupSound(nullptr),
-        m_RupeePickupSound(nullptr),
-		m_HeroHurtSound(nullptr),
-        m_HeroProjectile(nullptr)
-
+        m_LowHealthSound(nullptr)
     {
         //Set the local position of the hero, based on the center of the spawn tile
         SetLocalPosition(aSpawnTile->GetCenter(true));
@@ -87,22 +85,14 @@ namespace GameDev2D
         //Create the invincibility timer
         m_InvincibilityTimer = new Timer(HERO_INVINCIBILITY_DURATION);
 
-        //Create the audio sound effects
-        m_SwordAttackSound = new Audio("Sword", "wav", false, false);
-
         //Create the low health sound effect
         m_LowHealthSound = new Audio("LowHealth", "wav", false, true);
 
-		//Create hero hurt sound
-		m_HeroHurtSound = new Audio("HeroHurt", "wav", false, false);
-		m_HeroHurtSound->SetVolume(1.2);
-
-        //Create pick up sound effects
-        m_HeartPickupSound = new Audio("HeartPickup", "wav", false, false);
-        m_RupeePickupSound = new Audio("RupeePickup", "wav", false, false);
-
-        //Create projectile
-        m_HeroProjectile = new HeroProjectile();
+        //Preload the sound effects, they are shared with every other player of the same sound effect
+        ServiceLocator::GetAudioManager()->PreloadSoundEffect("Sword", "wav");
+        ServiceLocator::GetAudioManager()->PreloadSoundEffect("HeroHurt", "wav");
+        ServiceLocator::GetAudioManager()->PreloadSoundEffect("HeartPickup", "wav");
+        ServiceLocator::GetAudioManager()->PreloadSoundEffect("RupeePickup", "wav");
 
         //Set the hero's initial health and health capacity
         SetHealthCapacity(HERO_INITIAL_HEALTH_CAPACITY);
@@ -127,15 +117,8 @@ namespace GameDev2D
         //Delete the timer object
         SafeDelete(m_InvincibilityTimer);
 
-        //Delete sound effect audio objects
-        SafeDelete(m_SwordAttackSound);
+        //Delete the low health audio object
         SafeDelete(m_LowHealthSound);
-        SafeDelete(m_HeartPickupSound);
-        SafeDelete(m_RupeePickupSound);
-		SafeDelete(m_HeroHurtSound);
-
-        //Delete projectile
-        SafeDelete(m_HeroProjectile);
     }
 
     void Hero::Update(double aDelta)
@@ -187,20 +170,6 @@ namespace GameDev2D
         Player::Update(aDelta);
     }
 
-    void Hero::Draw()
-    {
-        Player::Draw();
-
-        //Draw the projectile
-        if (m_HeroProjectile != nullptr)//if the projectile is valid
-        {
-            if (m_HeroProjectile->IsEnabled() == true)//if the projectile is enabled
-            {
-                m_HeroProjectile->Draw();//Draw the projectile
-            }
-        }
-    }
-
     void Hero::Reset()
     {
         //Set the hero's state to idle
@@ -253,7 +222,7 @@ namespace GameDev2D
             FireProjectile();//Fire the hero projectile
 
             //Plat the sword attacking sound effect
-            m_SwordAttackSound->Play();
+            ServiceLocator::GetAudioManager()->PlaySoundEffect("Sword", "wav", HERO_SOUND_EFFECT_PRIORITY);
 
             //Stop attacking after a delay
             DelayGameObjectMethod(&Hero::StopAttacking, HERO_ATTACK_TIME);
@@ -329,12 +298,9 @@ namespace GameDev2D
     {
         Player::ApplyDamage(aAttackDamage);
 
-		if (m_HeroHurtSound != nullptr)
+		if (IsInvincible() == false) //if the hero is not invincible
 		{
-			if (IsInvincible() == false) //if the hero is not invincible
-			{
-				m_HeroHurtSound->Play();//Play the hero hurt sound
-			}
+			ServiceLocator::GetAudioManager()->PlaySoundEffect("HeroHurt", "wav", HERO_SOUND_EFFECT_PRIORITY);//Play the hero hurt sound
 		}
 
         //If there is still health left, reset the invincibility timer
@@ -543,19 +509,19 @@ namespace GameDev2D
 
                 //Heart pick up
             case PickupTypeHeart:
-                m_HeartPickupSound->Play();//Play sound effect				
+                ServiceLocator::GetAudioManager()->PlaySoundEffect("HeartPickup", "wav", HERO_SOUND_EFFECT_PRIORITY);//Play sound effect				
                 SetHealth(GetHealth() + HERO_FULL_HEART);//Increase health by 1 heart
                 break;
 
                 //Green Rupee pick up
             case PickupTypeGreenRupee:
-                m_RupeePickupSound->Play();//Play sound effect	
+                ServiceLocator::GetAudioManager()->PlaySoundEffect("RupeePickup", "wav", HERO_SOUND_EFFECT_PRIORITY);//Play sound effect	
                 AddRupees(HERO_GREEN_RUPEE_VALUE);//Add the value of the green rupee to the hero rupee count
                 break;
 
                 //Blue Rupee pick up
             case PickupTypeBlueRupee:
-                m_RupeePickupSound->Play();//Play sound effect	
+                ServiceLocator::GetAudioManager()->PlaySoundEffect("RupeePickup", "wav", HERO_SOUND_EFFECT_PRIORITY);//Play sound effect	
                 AddRupees(HERO_BLUE_RUPEE_VALUE);//Add the value of the blue rupee to the hero rupee count
                 break;
 
@@ -607,12 +573,10 @@ namespace GameDev2D
     {
         if (GetHealth() >= GetHealthCapacity())//If the player has full health
         {
-            if (m_HeroProjectile != nullptr)//if the projectile is valid
+            ProjectileManager* projectileManager = m_World->GetProjectileManager();
+            if (projectileManager->GetNumberOfActiveProjectiles(ProjectileOwnerHero) == 0)//Only fire the projectile if there isn't one already active
             {
-                if (m_HeroProjectile->IsEnabled() == false)//Only fire the projectile if it currently inactive
-                {
-                    m_HeroProjectile->Fire(GetSubSection(), GetLocalPosition(), GetDirection(), HERO_PROJECTILE_DEFAULT_SPEED, HERO_PROJECTILE_DEFAULT_ATTACK_DAMAGE);//Fire the projectile
-                }
+                projectileManager->Fire(ProjectileOwnerHero, GetSubSection(), GetLocalPosition(), GetDirection(), HERO_PROJECTILE_DEFAULT_SPEED, HERO_PROJECTILE_DEFAULT_ATTACK_DAMAGE);//Fire the projectile
             }
         }
     }
@@ -641,11 +605,11 @@ namespace GameDev2D
         //Factor in the sub-section the player is on
         position -= subSection->GetWorldPosition();
 
-        //Create a vector for the 3 collision points to check against
-        vector<vec2> collisionPoints = { position, vec2(position + perpendicularA), vec2(position + perpendicularB) };
+        //Create an array for the 3 collision points to check against
+        const vec2 collisionPoints[HERO_NUMBER_OF_COLLISION_POINTS] = { position, vec2(position + perpendicularA), vec2(position + perpendicularB) };
 
         //Cycle through the collision points
-        for (unsigned int i = 0; i < collisionPoints.size(); i++)
+        for (unsigned int i = 0; i < HERO_NUMBER_OF_COLLISION_POINTS; i++)
         {
             //Get the current tile for the collision point
             Tile* currentTile = subSection->GetTileForPosition(collisionPoints[i]);
@@ -688,54 +652,19 @@ namespace GameDev2D
             //Factor in the sub-section the player is on
             swordTipPosition -= subSection->GetWorldPosition();
 
-            //Get the tile the sword is on
-            Tile* swordTile = subSection->GetTileForPosition(swordTipPosition);
-
-            //Get the active enemies in the subsection
-            vector<Enemy*> enemies;
-            GetSubSection()->GetActiveEnemies(enemies);
+            //Get the tile index the sword is on
+            unsigned int swordTileIndex = subSection->GetTileIndexForPosition(swordTipPosition);
 
-            //Cycle through the active enemies and see if the tip of the sword collided with any of them
+            //Only the enemies standing on the sword's tile can be hit, cycle through them and apply damage to the active ones
+            const vector<Enemy*>& enemies = subSection->GetEnemiesForTileIndex(swordTileIndex);
             for (unsigned int i = 0; i < enemies.size(); i++)
             {
-                if (enemies.at(i)->GetTile() == swordTile)
+                if (enemies.at(i)->IsEnabled() == true)
                 {
                     enemies.at(i)->ApplyDamage(GetAttackDamage());
                 }
             }
         }
-
-        HeroProjectileCollision(aDelta);//Check the collision against the projectiles
-    }
-
-    void Hero::HeroProjectileCollision(double aDelta)
-    {
-        //If the hero has a projectile
-        if (m_HeroProjectile != nullptr)
-        {
-            if (m_HeroProjectile->IsEnabled() == true)//iF the projectile is enabled, has been fired
-            {
-                m_HeroProjectile->Update(aDelta);//Update the projectile
-
-                //Get the enemyes active in the subsection
-                vector<Enemy*> activeEnemies;
-                GetSubSection()->GetActiveEnemies(activeEnemies);
-
-                //Handle the projectile collision against the enemies
-                for (unsigned int i = 0; i < activeEnemies.size(); i++)//Go through all the active enemies in the subsection
-                {
-                    if (activeEnemies.at(i) != nullptr)//If it is a valid enemy
-                    {
-                        if (activeEnemies.at(i)->GetTile() == m_HeroProjectile->GetProjectileTile())//Check if the enemy is in the same tile as the projectile 
-                        {
-                            activeEnemies.at(i)->ApplyDamage(m_HeroProjectile->GetAttackDamage());//Damage the enemy
-                            m_HeroProjectile->DeactivateProjectile();//Deactivate the enemy projectile
-                            break;//Break out of loop so that the damage is only applied to one enemy in the tile
-                        }
-                    }
-                }
-            }
-        }
     }
 
     //Function to call with delay when the user has died
@@ -747,29 +676,12 @@ namespace GameDev2D
 	//Stop all the sounds in the hero
 	void Hero::StopAllSound()
 	{
-		if (m_SwordAttackSound!=nullptr)
-		{
-			m_SwordAttackSound->Stop();
-		}
-
 		if (m_LowHealthSound != nullptr)
 		{
 			m_LowHealthSound->Stop();
 		}
 
-		if (m_HeartPickupSound != nullptr)
-		{
-			m_HeartPickupSound->Stop();
-		}
-
-		if (m_RupeePickupSound != nullptr)
-		{
-			m_RupeePickupSound->Stop();
-		}
-
-		if (m_HeroHurtSound != nullptr)
-		{
-			m_HeroHurtSound->Stop();
-		}
+		//Stop the sound effects that are still playing
+		ServiceLocator::GetAudioManager()->StopAllSoundEffects();
 	}
 }
\ No newline at end of file
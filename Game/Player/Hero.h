@@ -11,6 +11,7 @@ _______________________________________________
 -Added dead state to palyer.
 -Added different sound variables to player
 -Added projectile variable and fucntion to player
+-Removed the sound effect Audio objects, the sound effects are played through the AudioManager's voice pool
 */
 
 
@@ -47,11 +48,15 @@ namespace GameDev2D
     const vec2 HERO_SWORD_RANGE = vec2(70.0f, 68.0f);
     const double HERO_INVINCIBILITY_DURATION = 0.65;
     const float HERO_COLLISION_ZONE = 20.0f;
+    const unsigned int HERO_NUMBER_OF_COLLISION_POINTS = 3;
     const bool HERO_HAS_SWORD_BY_DEFAULT = true;
 
     const float HERO_PROJECTILE_DEFAULT_SPEED = 300.0f;
     const unsigned int HERO_PROJECTILE_DEFAULT_ATTACK_DAMAGE = 1;//Different from the hero normal damage
 
+    //The hero's sound effects are more important than the enemies', so they can steal an enemy's voice
+    const int HERO_SOUND_EFFECT_PRIORITY = 64;
+
     //Hero low health count, the number of HP the hero has before teh low health count starts
     const unsigned int HERO_LOW_HEALTH_SOUND_TRIGGER = 2;
 
@@ -76,7 +81,6 @@ namespace GameDev2D
     class Tile;
     class Audio;
     class Circle;
-    class HeroProjectile;
 
     //The Hero class is controlled by keyboard input
     class Hero : public Player, EventHandler
@@ -87,7 +91,6 @@ namespace GameDev2D
 
         //Update method, used to determine if an enemy has been attacked
         void Update(double delta);
-        void Draw();
 
         //Used to reset the hero
         void Reset();
@@ -132,7 +135,6 @@ namespace GameDev2D
         //Convenience method to separate code
         void HeroMovementCollision(double delta);
         void HeroAttackCollision(double delta);
-        void HeroProjectileCollision(double delta);
 
         //Method used to stop attacking, called from a delayed method
         void StopAttacking();
@@ -145,14 +147,9 @@ namespace GameDev2D
         unsigned short m_Rupees;
         bool m_HasSword;
         Timer* m_InvincibilityTimer;
-        HeroProjectile* m_HeroProjectile;
 
-        //Sounds
-        Audio* m_SwordAttackSound;
+        //Looped low health sound, the other sounds are fire and forget sound effects
         Audio* m_LowHealthSound;
-		Audio* m_HeroHurtSound;
-        Audio* m_HeartPickupSound;
-        Audio* m_RupeePickupSound;
     };
 }
 
@@ -0,0 +1,263 @@
+/*******************************************************************
+ProjectileManager.cpp
+
+Purpose:
+The projectile manager owns every projectile in the World. The projectile
+data is stored as parallel arrays (position, velocity, angle, damage, owner
+and subsection) so that all the projectiles can be updated and collided in a
+single pass, a projectile only checks the enemies in its subsection's
+bucket for the tile it is on. Each type of projectile is drawn with one
+shared Sprite in a single batched draw call.
+*********************************************************************/
+
+#include "ProjectileManager.h"
+#include "World.h"
+#include "SubSection.h"
+#include "Tiles/Tile.h"
+#include "Player/Hero.h"
+#include "Player/Enemy.h"
+#include "../Source/UI/Sprite/Sprite.h"
+
+namespace GameDev2D
+{
+    ProjectileManager::ProjectileManager(World* aWorld, unsigned int aCapacity) : BaseObject("ProjectileManager"),
+        m_World(aWorld),
+        m_Capacity(aCapacity),
+        m_NumberOfActiveProjectiles(0),
+        m_Positions(nullptr),
+        m_Velocities(nullptr),
+        m_Angles(nullptr),
+        m_AttackDamages(nullptr),
+        m_Owners(nullptr),
+        m_SubSections(nullptr)
+    {
+        //Allocate the projectile arrays
+        m_Positions = new vec2[m_Capacity];
+        m_Velocities = new vec2[m_Capacity];
+        m_Angles = new float[m_Capacity];
+        m_AttackDamages = new unsigned int[m_Capacity];
+        m_Owners = new ProjectileOwner[m_Capacity];
+        m_SubSections = new SubSection*[m_Capacity];
+
+        //Reserve the draw arrays up front, so that drawing never allocates
+        m_DrawPositions.reserve(m_Capacity);
+        m_DrawAngles.reserve(m_Capacity);
+
+        //Create one shared sprite for each type of projectile
+        for (unsigned int i = 0; i < ProjectileOwnerCount; i++)
+        {
+            m_Sprites[i] = new Sprite("MainAtlas", PROJECTILE_ATLAS_KEY[i]);
+            m_Sprites[i]->SetAnchorPoint(0.5f, 0.5f);
+            m_NumberOfActiveProjectilesForOwner[i] = 0;
+        }
+    }
+
+    ProjectileManager::~ProjectileManager()
+    {
+        //Delete the projectile arrays
+        SafeDeleteArray(m_Positions);
+        SafeDeleteArray(m_Velocities);
+        SafeDeleteArray(m_Angles);
+        SafeDeleteArray(m_AttackDamages);
+        SafeDeleteArray(m_Owners);
+        SafeDeleteArray(m_SubSections);
+
+        //Delete the shared sprites
+        for (unsigned int i = 0; i < ProjectileOwnerCount; i++)
+        {
+            SafeDelete(m_Sprites[i]);
+        }
+    }
+
+    bool ProjectileManager::Fire(ProjectileOwner aOwner, SubSection* aSubSection, vec2 aPosition, vec2 aDirection, float aSpeed, unsigned int aAttackDamage)
+    {
+        //If there isn't a free projectile or a valid subsection, the projectile can't be fired
+        if (m_NumberOfActiveProjectiles == m_Capacity || aSubSection == nullptr)
+        {
+            return false;
+        }
+
+        //Set the projectile data at the end of the active projectiles
+        unsigned int index = m_NumberOfActiveProjectiles;
+        m_Positions[index] = aPosition;
+        m_Velocities[index] = aDirection * aSpeed;
+        m_Angles[index] = GetAngleForDirection(aDirection);
+        m_AttackDamages[index] = aAttackDamage;
+        m_Owners[index] = aOwner;
+        m_SubSections[index] = aSubSection;
+
+        //Increment the active counts
+        m_NumberOfActiveProjectiles++;
+        m_NumberOfActiveProjectilesForOwner[aOwner]++;
+        return true;
+    }
+
+    void ProjectileManager::Update(double aDelta)
+    {
+        //Get the hero and the tile the hero is on, the tile is only needed once for every enemy projectile
+        Hero* hero = m_World->GetHero();
+        Tile* heroTile = nullptr;
+        if (hero != nullptr && hero->IsEnabled() == true)
+        {
+            heroTile = hero->GetTile();
+        }
+
+        unsigned int i = 0;
+        while (i < m_NumberOfActiveProjectiles)
+        {
+            //Move the projectile
+            m_Positions[i] += m_Velocities[i] * (float)aDelta;
+
+            //Get the position of the projectile relative to its subsection
+            SubSection* subSection = m_SubSections[i];
+            vec2 position = m_Positions[i] - subSection->GetWorldPosition();
+            vec2 size = vec2(subSection->GetSize());
+
+            //Bound check the subsection, if the projectile goes offscreen deactivate the projectile
+            if (position.x < 0.0f || position.y < 0.0f || position.x >= size.x || position.y >= size.y)
+            {
+                DeactivateProjectile(i);
+                continue;
+            }
+
+            //Check that it doesn't go through non walkable tiles
+            unsigned int tileIndex = subSection->GetTileIndexForPosition(position);
+            if (subSection->IsTileWalkableAtIndex(tileIndex) == false)
+            {
+                DeactivateProjectile(i);
+                continue;
+            }
+
+            //Collide the projectile against whoever it can damage
+            bool hasCollided = false;
+            if (m_Owners[i] == ProjectileOwnerEnemy)
+            {
+                //If the hero is on the same tile as the projectile, apply damage
+                if (heroTile != nullptr && heroTile->GetSubSection() == subSection && heroTile->GetIndex() == tileIndex)
+                {
+                    hero->ApplyDamage(m_AttackDamages[i]);
+                    hasCollided = true;
+                }
+            }
+            else
+            {
+                //Only the enemies standing on the projectile's tile need to be checked
+                const vector<Enemy*>& enemies = subSection->GetEnemiesForTileIndex(tileIndex);
+                for (unsigned int j = 0; j < enemies.size(); j++)
+                {
+                    //The enemy could be dead, or killed by another projectile earlier in this update
+                    if (enemies.at(j)->IsEnabled() == true)
+                    {
+                        //Damage is only applied to one enemy in the tile
+                        enemies.at(j)->ApplyDamage(m_AttackDamages[i]);
+                        hasCollided = true;
+                        break;
+                    }
+                }
+            }
+
+            //Deactivate the projectile if it collided, otherwise move onto the next projectile
+            if (hasCollided == true)
+            {
+                DeactivateProjectile(i);
+            }
+            else
+            {
+                i++;
+            }
+        }
+    }
+
+    void ProjectileManager::Draw()
+    {
+        for (unsigned int owner = 0; owner < ProjectileOwnerCount; owner++)
+        {
+            //Is there anything to draw for this type of projectile
+            if (m_NumberOfActiveProjectilesForOwner[owner] == 0)
+            {
+                continue;
+            }
+
+            //Gather the projectiles for the owner
+            m_DrawPositions.clear();
+            m_DrawAngles.clear();
+            for (unsigned int i = 0; i < m_NumberOfActiveProjectiles; i++)
+            {
+                if (m_Owners[i] == owner)
+                {
+                    m_DrawPositions.push_back(m_Positions[i]);
+                    m_DrawAngles.push_back(m_Angles[i]);
+                }
+            }
+
+            //Draw all the projectiles in one draw call
+            m_Sprites[owner]->DrawBatch(m_DrawPositions, m_DrawAngles);
+        }
+    }
+
+    void ProjectileManager::Reset()
+    {
+        m_NumberOfActiveProjectiles = 0;
+        for (unsigned int i = 0; i < ProjectileOwnerCount; i++)
+        {
+            m_NumberOfActiveProjectilesForOwner[i] = 0;
+        }
+    }
+
+    unsigned int ProjectileManager::GetNumberOfActiveProjectiles()
+    {
+        return m_NumberOfActiveProjectiles;
+    }
+
+    unsigned int ProjectileManager::GetNumberOfActiveProjectiles(ProjectileOwner aOwner)
+    {
+        return m_NumberOfActiveProjectilesForOwner[aOwner];
+    }
+
+    unsigned int ProjectileManager::GetCapacity()
+    {
+        return m_Capacity;
+    }
+
+    void ProjectileManager::DeactivateProjectile(unsigned int aIndex)
+    {
+        //If this assert is hit, the index is not an active projectile
+        assert(aIndex < m_NumberOfActiveProjectiles);
+
+        //Decrement the active counts
+        m_NumberOfActiveProjectilesForOwner[m_Owners[aIndex]]--;
+        m_NumberOfActiveProjectiles--;
+
+        //Move the last active projectile into the deactivated projectile's slot
+        unsigned int last = m_NumberOfActiveProjectiles;
+        if (aIndex != last)
+        {
+            m_Positions[aIndex] = m_Positions[last];
+            m_Velocities[aIndex] = m_Velocities[last];
+            m_Angles[aIndex] = m_Angles[last];
+            m_AttackDamages[aIndex] = m_AttackDamages[last];
+            m_Owners[aIndex] = m_Owners[last];
+            m_SubSections[aIndex] = m_SubSections[last];
+        }
+    }
+
+    float ProjectileManager::GetAngleForDirection(vec2 aDirection)
+    {
+        //If the projectile is going down
+        if (aDirection == vec2(0, -1))
+        {
+            return -180.0f;
+        }
+        else if (aDirection == vec2(1, 0))//If the projectile is going right
+        {
+            return -90.0f;
+        }
+        else if (aDirection == vec2(-1, 0)) //If the projectile is going left
+        {
+            return 90.0f;
+        }
+
+        //The projectile is going up
+        return 0.0f;
+    }
+}
@@ -0,0 +1,98 @@
+/*******************************************************************
+ProjectileManager.h
+
+Purpose:
+The projectile manager owns every projectile in the World. The projectile
+data is stored as parallel arrays (position, velocity, angle, damage, owner
+and subsection) so that all the projectiles can be updated and collided in a
+single pass, a projectile only checks the enemies in its subsection's
+bucket for the tile it is on. Each type of projectile is drawn with one
+shared Sprite in a single batched draw call.
+*********************************************************************/
+
+#ifndef __GameDev2D__ProjectileManager__
+#define __GameDev2D__ProjectileManager__
+
+#include "../Source/Core/BaseObject.h"
+
+using namespace glm;
+
+namespace GameDev2D
+{
+    //Enum used to identify who fired a projectile, this determines what the projectile can collide with
+    enum ProjectileOwner
+    {
+        ProjectileOwnerHero = 0,
+        ProjectileOwnerEnemy,
+        ProjectileOwnerCount
+    };
+
+    //Local constants
+    const unsigned int PROJECTILE_MANAGER_DEFAULT_CAPACITY = 64;
+    const string PROJECTILE_ATLAS_KEY[] = { "Sword-Pickup", "EnemyProjectile" };
+
+    //Forward declarations
+    class World;
+    class SubSection;
+    class Sprite;
+
+    /***************************************************************
+    Class: ProjectileManager
+    Manages a fixed capacity of projectiles for the World. Active projectiles
+    are always packed at the front of the arrays, deactivating a projectile
+    swaps the last active projectile into its slot.
+    ***************************************************************/
+    class ProjectileManager : public BaseObject
+    {
+    public:
+        ProjectileManager(World* world, unsigned int capacity = PROJECTILE_MANAGER_DEFAULT_CAPACITY);
+        ~ProjectileManager();
+
+        //Fires a projectile from a world position, returns false if there wasn't a free projectile
+        bool Fire(ProjectileOwner owner, SubSection* subSection, vec2 position, vec2 direction, float speed, unsigned int attackDamage);
+
+        //Moves all the active projectiles and handles their collision against the tiles, the hero and the enemies
+        void Update(double delta);
+
+        //Draws all the active projectiles, one batched draw call per projectile type
+        void Draw();
+
+        //Deactivates every active projectile
+        void Reset();
+
+        //Returns the number of active projectiles, in total or for an owner
+        unsigned int GetNumberOfActiveProjectiles();
+        unsigned int GetNumberOfActiveProjectiles(ProjectileOwner owner);
+
+        //Returns the maximum number of projectiles that can be active at once
+        unsigned int GetCapacity();
+
+    private:
+        //Deactivates the projectile at an index, the last active projectile is moved into its place
+        void DeactivateProjectile(unsigned int index);
+
+        //Returns the angle the projectile sprite is rotated for a direction
+        float GetAngleForDirection(vec2 direction);
+
+        //Member variables
+        World* m_World;
+        unsigned int m_Capacity;
+        unsigned int m_NumberOfActiveProjectiles;
+        unsigned int m_NumberOfActiveProjectilesForOwner[ProjectileOwnerCount];
+
+        //Projectile data, each array is the size of the capacity
+        vec2* m_Positions;
+        vec2* m_Velocities;
+        float* m_Angles;
+        unsigned int* m_AttackDamages;
+        ProjectileOwner* m_Owners;
+        SubSection** m_SubSections;
+
+        //Shared sprites and scratch arrays used to batch the draw calls
+        Sprite* m_Sprites[ProjectileOwnerCount];
+        vector<vec2> m_DrawPositions;
+        vector<float> m_DrawAngles;
+    };
+}
+
+#endif /* defined(__GameDev2D__ProjectileManager__) */
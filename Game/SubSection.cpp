@@ -15,6 +15,25 @@ _______________________________________________
 -Added convenience method "DeactivateSpawnPointsAtTileIndex" to deactivate both enemy and hero spawn points in
 a tile.
 -Added SetEnemySpawnPoint function to ensure we don't place a enemy spawn point on top of the player spawn point.
+-Added a tile bucketed index of the enemies, each tile has a bucket of the enemies standing on it. The buckets are
+updated when an enemy changes tiles, so the hero and the projectiles only check the enemies on the tiles they touch.
+-Replaced the Tile objects with flat tile arrays (type index, variant, flags and pickup). The tiles are drawn with one
+shared Sprite per atlas key, batched per Sprite, and Tile objects are only created when they are asked for.
+-The tiles are culled against the camera's view, a sub-section outside the view skips its tiles and a partially
+visible sub-section only draws the tiles that overlap the view.
+-Added GetTileDataAtIndex and SetTileDataAtIndex, the Level Editor's undo and redo history writes the raw tile data
+so that only the tiles that changed are touched.
+-Added a revision counter that is incremented whenever the tile data changes, the World editor view uses it to save
+only the modified sub-sections and to refresh their thumbnails. The spawn point sprites are drawn at the world position.
+-Added SetTileTypeAtIndices, the Level Editor's fill, rectangle and line tools change all their tiles in one batch.
+-Save writes to a temporary file that then replaces the level file. Added GetSaveDataForIndex and SetSaveDataAtIndex,
+the Level Editor's autosave journals the saved value of each changed tile.
+-Added DecodeSaveData, the Level Editor's validator checks the saved tiles without loading a SubSection.
+-Split the pickup and enemy updates into Simulate, which the World can run on a worker thread. The enemies' writes to the
+hero and the projectile manager are deferred and merged on the main thread.
+-The debug data is drawn every frame with the DebugRenderer service, instead of being drawn to a RenderTarget that was
+refreshed whenever the debug data changed.
+-The tile arrays are tracked by the MemoryTracker, under the Tiles memory tag.
 */
 
 #include "SubSection.h"
@@ -22,18 +41,13 @@ a tile.
 #include "Player/Player.h"
 #include "Player/Hero.h"
 #include "Player/Enemy.h"
-#include "Tiles/GroundTile.h"
-#include "Tiles/WaterTile.h"
-#include "Tiles/TreeTile.h"
-#include "Tiles/BoulderTile.h"
-#include "Tiles/RockTile.h"
-#include "Tiles/SandTile.h"
-#include "Tiles/BridgeTile.h"
-#include "Tiles/FireTile.h"
+#include "Tiles/Tile.h"
+#include "Pickups/Pickup.h"
 #include "LevelEditor/LevelEditor.h"
 #include "../Source/UI/UI.h"
-#include "../Source/Graphics/Core/RenderTarget.h"
 #include "../Source/Services/ServiceLocator.h"
+#include "../Source/Core/MemoryTracker.h"
+#include "../Source/Platforms/PlatformLayer.h"
 #include "../Source/Audio/Audio.h"
 
 
@@ -42,42 +56,44 @@ namespace GameDev2D
     SubSection::SubSection(World* aWorld, uvec2 aCoordinates) : GameObject("SubSection"),
         m_World(aWorld),
         m_LevelEditor(nullptr),
-        m_Tiles(nullptr),
+        m_TileEnemies(nullptr),
         m_HeroSpawnPoint(nullptr),
         m_EnemySpawnPoint(nullptr),
         m_DebugDrawingFlags(DebugDrawNothing),
-        m_DebugRenderTarget(nullptr)
+        m_TileTypeIndices(nullptr),
+        m_TileVariants(nullptr),
+        m_TileFlags(nullptr),
+        m_TilePickups(nullptr),
+        m_Tiles(nullptr),
+        m_TileSprites(nullptr),
+        m_AreTileDrawBatchesDirty(true),
+        m_Revision(0)
     {
         //Set the Sub-section's position
         SetLocalPosition((float)(aCoordinates.x * aWorld->GetSubSectionSize().x), (float)(aCoordinates.y * aWorld->GetSubSectionSize().y));
 
-        //Allocate the tiles array, the inheriting class will populate this array with Tile objects
-        m_Tiles = new Tile*[GetNumberOfTiles()];
-
-        //Initialize all the tiles to NULL
-        for (unsigned int i = 0; i < GetNumberOfTiles(); i++)
-        {
-            m_Tiles[i] = NULL;
-        }
+        //Allocate the tile arrays
+        CreateTileArrays();
     }
 
     SubSection::SubSection(LevelEditor* aLevelEditor, const string& aFilename) : GameObject("SubSection"),
         m_World(nullptr),
         m_LevelEditor(aLevelEditor),
-        m_Tiles(nullptr),
+        m_TileEnemies(nullptr),
         m_HeroSpawnPoint(nullptr),
         m_EnemySpawnPoint(nullptr),
         m_DebugDrawingFlags(DebugDrawNothing),
-        m_DebugRenderTarget(nullptr)
+        m_TileTypeIndices(nullptr),
+        m_TileVariants(nullptr),
+        m_TileFlags(nullptr),
+        m_TilePickups(nullptr),
+        m_Tiles(nullptr),
+        m_TileSprites(nullptr),
+        m_AreTileDrawBatchesDirty(true),
+        m_Revision(0)
     {
-        //Allocate the tiles array, the inheriting class will populate this array with Tile objects
-        m_Tiles = new Tile*[GetNumberOfTiles()];
-
-        //Initialize all the tiles to NULL
-        for (unsigned int i = 0; i < GetNumberOfTiles(); i++)
-        {
-            m_Tiles[i] = NULL;
-        }
+        //Allocate the tile arrays
+        CreateTileArrays();
 
         //Create the hero and enemy spawn point sprites
         m_HeroSpawnPoint = new Sprite("MainAtlas", "Link-Spawn");
@@ -89,22 +105,33 @@ namespace GameDev2D
 
     SubSection::~SubSection()
     {
-        //Safety check the tiles pointer
-        if (m_Tiles != nullptr)
+        //Cycle through and delete the pickups and the Tile objects that were created
+        for (unsigned int i = 0; i < GetNumberOfTiles(); i++)
         {
-            //Cycle through and delete the tile objects
-            for (unsigned int i = 0; i < GetNumberOfTiles(); i++)
-            {
-                SafeDelete(m_Tiles[i]);
-            }
+            SafeDelete(m_TilePickups[i]);
+            SafeDelete(m_Tiles[i]);
+        }
 
-            //Delete the tiles array
-            SafeDeleteArray(m_Tiles);
+        //Cycle through and delete the shared tile sprites
+        for (unsigned int i = 0; i < Tile::GetNumberOfTileSprites(); i++)
+        {
+            SafeDelete(m_TileSprites[i]);
         }
 
+        //Delete the tile arrays
+        SafeDeleteArray(m_TileTypeIndices);
+        SafeDeleteArray(m_TileVariants);
+        SafeDeleteArray(m_TileFlags);
+        SafeDeleteArray(m_TilePickups);
+        SafeDeleteArray(m_Tiles);
+        SafeDeleteArray(m_TileSprites);
+
+        //Delete the enemy buckets
+        SafeDeleteArray(m_TileEnemies);
+        MemoryTracker::TrackDeallocation(MemoryTag_Tiles, GetTileArraysNumberOfBytes());
+
         SafeDelete(m_HeroSpawnPoint);
         SafeDelete(m_EnemySpawnPoint);
-        SafeDelete(m_DebugRenderTarget);
     }
 
     void SubSection::Load(const string& aFilename)
@@ -143,64 +170,29 @@ namespace GameDev2D
                 //Go throguh all the tiles in the buffer and get their information
                 for (unsigned int i = 0; i < bufferLength; i++)
                 {
-                    TileType tileType = TileTypeUnknown;
-                    bool isHeroSpawnPoint = false;
-                    bool isEnemySpawnPoint = false;
-
-                    //Check if the tile is the hero spawn point
-                    unsigned int heroValue = buffer[i] & TILE_HERO_SPAWN_POINT;//Check if it is the hero spawn point
-                    if (heroValue > 0)//if it is a spawn point
-                    {
-                        isHeroSpawnPoint = true;//Set it so that the hero will spawn here
-                        buffer[i] &= ~TILE_HERO_SPAWN_POINT;//Turn off the hero spawn point bits
-                    }
-
-                    //Check if the tile is the enemy spawn point
-                    unsigned int enemyValue = buffer[i] & TILE_ENEMY_SPAWN_POINT;//Check if it is the enemy spawn point
-                    if (enemyValue > 0)//if it is a spawn point
-                    {
-                        isEnemySpawnPoint = true;//Set it so that the enemy will spawn here
-                        buffer[i] &= ~TILE_ENEMY_SPAWN_POINT;//Turn off the enemy spawn point bits
-                    }
-
-                    for (unsigned int j = 0; j < TileTypeCount; j++)
-                    {
-                        //"Bit mask" to check the tile type set
-                        unsigned int value = (buffer[i] & TILES_TYPES[j]);
-
-                        //If we have a tile type set
-                        if (value > 0)
-                        {
-                            tileType = TILES_TYPES[j];//Set the current tile type
-
-                            //Turn off the tile type bits using the "~' complement bitwie operator, to flip
-                            //its value
-                            buffer[i] &= ~TILES_TYPES[j];
-
-                            break;
-                        }
-                    }
+                    //Decode the tile's type, variant and flags, a hero spawn point takes precedence like it does when saving
+                    unsigned char typeIndex = 0;
+                    unsigned char variant = 0;
+                    unsigned char flags = 0;
+                    bool isValid = DecodeSaveData(buffer[i], typeIndex, variant, flags);
 
                     //Assert if the buffer didn't have a valid tile type data saved
-                    assert(tileType != TileTypeUnknown);
-
-                    //Check the tile variant
-                    unsigned int tileVariant = buffer[i];
-
-                    //Set the tile accordings to its type and variant
-                    Tile*tile = SetTileTypeAtIndex(i, tileType, tileVariant);
+                    assert(isValid == true);
 
-                    //Check if the hero or enemy spawn points are in the tile
-                    if (tile != nullptr)//Check that the tile is valid
+                    //Safety check the tile data, an invalid tile is loaded as a ground tile
+                    if (isValid == false)
                     {
-                        tile->SetIsHeroSpawnPoint(isHeroSpawnPoint);
-                        tile->SetIsEnemySpawnPoint(isEnemySpawnPoint);
+                        Error(false, "The tile at index %u has an invalid tile type or variant: %s", i, aFilename.c_str());
+                        DecodeSaveData((unsigned short)TileTypeGround, typeIndex, variant, flags);
                     }
 
-                    //Spawn the enemy if it is a spawn point
-                    if (isEnemySpawnPoint == true)
+                    //Set the tile's data, the flags replace the spawn points of the level that was loaded before
+                    SetTileDataAtIndex(i, typeIndex, variant, flags);
+
+                    //Spawn the enemy on the enemy spawn point
+                    if ((flags & TileFlagEnemySpawnPoint) != 0)
                     {
-                        SpawnEnemy(tile);
+                        SpawnEnemy(GetTileForIndex(i));
                     }
                 }
 
@@ -230,8 +222,7 @@ namespace GameDev2D
                 //Ensure that the tile is not a hero or an enemy spawn point
                 DeactivateSpawnPointsAtTileIndex(i);
 
-                GetTileForIndex(i)->RemovePickup();//Remove any pick up that was in that tile
-
+                SafeDelete(m_TilePickups[i]);//Remove any pick up that was in that tile
             }
         }
     }
@@ -241,8 +232,11 @@ namespace GameDev2D
     void SubSection::DeactivateSpawnPointsAtTileIndex(unsigned int aIndex)
     {
         //Ensure that if we are loading an empty level, none of the tiles is set to be a spawn point
-        m_Tiles[aIndex]->SetIsEnemySpawnPoint(false);
-        m_Tiles[aIndex]->SetIsHeroSpawnPoint(false);
+        if ((m_TileFlags[aIndex] & (TileFlagHeroSpawnPoint | TileFlagEnemySpawnPoint)) != 0)
+        {
+            m_TileFlags[aIndex] &= ~(TileFlagHeroSpawnPoint | TileFlagEnemySpawnPoint);
+            m_Revision++;
+        }
     }
 
     void SubSection::Save(const string& aFilename)
@@ -251,58 +245,136 @@ namespace GameDev2D
         //Check that he actually passed a filename 
         if (aFilename.length() > 0)
         {
-            //Create output stream (write to a file)
-            ofstream outputStream;
-            outputStream.open(aFilename, ofstream::out | ofstream::binary);
+            //Create an  array (buffer) to hold the tile type data
+            const unsigned short bufferLength = GetNumberOfTiles();
+            unsigned short* buffer = new unsigned short[bufferLength];
 
-            //Check if the file opened
-            if (outputStream.is_open() == true)
+            //Fill the buffer
+            //Go through all the tiles in the subsection, and save teh data
+            for (unsigned int i = 0; i < bufferLength; i++)
             {
-                //Create an  array (buffer) to hold the tile type data
-                const unsigned short bufferLength = GetNumberOfTiles();
-                unsigned short* buffer = new unsigned short[bufferLength];
+                buffer[i] = GetSaveDataForIndex(i);
+            }
 
-                //Fill the buffer
-                //Go through all the tiles in the subsection, and save teh data
-                for (unsigned int i = 0; i < bufferLength; i++)
-                {
-                    //Get the current tile
-                    Tile* tile = GetTileForIndex(i);
+            //Write the buffer to a file
+            if (WriteSaveData(aFilename, buffer, bufferLength) == false)
+            {
+                Error(false, "Failed to save: %s", aFilename.c_str());
+            }
 
-                    //Set the tile in our buffer
-                    buffer[i] = tile->GetTileType();
+            //Now that the content of the buffer has been written to a file, delete the buffer.
+            SafeDeleteArray(buffer);
+        }
+    }
 
-                    //Set the tile variant by using an "or" binary operator, to use the current tile variant as a bit mask.
-                    buffer[i] |= tile->GetVariant();
+    unsigned short SubSection::GetSaveDataForIndex(unsigned int aIndex)
+    {
+        //If this assert is hit, the index isn't on the subsection
+        assert(aIndex < GetNumberOfTiles());
 
-                    //Set in the buffer the hero or enemy spawn point
-                    if (tile->IsHeroSpawnPoint() == true)
-                    {
-                        //Set the tile variant by using an "or" binary operator, to use the hero spawn point as a bit mask.
-                        buffer[i] |= TILE_HERO_SPAWN_POINT;
-                    }
-                    else if (tile->IsEnemySpawnPoint() == true)
-                    {
-                        //Set the tile variant by using an "or" binary operator, to use the enemy spawn point as a bit mask.
-                        buffer[i] |= TILE_ENEMY_SPAWN_POINT;
-                    }
-                }
+        //Set the tile type
+        unsigned short saveData = GetTileTypeForIndex(aIndex);
 
-                //Write the buffer to a file
-                unsigned int bufferSize = bufferLength*sizeof(unsigned short);
-                outputStream.write((const char*)buffer, bufferSize);
+        //Set the tile variant by using an "or" binary operator, to use the current tile variant as a bit mask.
+        saveData |= m_TileVariants[aIndex];
 
-                //Close the output stream
-                outputStream.close();
+        //Set the hero or enemy spawn point
+        if ((m_TileFlags[aIndex] & TileFlagHeroSpawnPoint) != 0)
+        {
+            saveData |= TILE_HERO_SPAWN_POINT;
+        }
+        else if ((m_TileFlags[aIndex] & TileFlagEnemySpawnPoint) != 0)
+        {
+            saveData |= TILE_ENEMY_SPAWN_POINT;
+        }
 
-                //Now that the content of the buffer has been written to a file, delete the buffer.
-                SafeDeleteArray(buffer);
-            }
-            else //if we can't open the ouput stream
+        return saveData;
+    }
+
+    void SubSection::SetSaveDataAtIndex(unsigned int aIndex, unsigned short aSaveData)
+    {
+        //Ignore the saved value if it doesn't have a valid tile type and variant
+        unsigned char typeIndex = 0;
+        unsigned char variant = 0;
+        unsigned char flags = 0;
+        if (DecodeSaveData(aSaveData, typeIndex, variant, flags) == false)
+        {
+            Error(false, "Failed to set the saved tile data at index %u, the tile type or variant is invalid", aIndex);
+            return;
+        }
+
+        SetTileDataAtIndex(aIndex, typeIndex, variant, flags);
+    }
+
+    bool SubSection::DecodeSaveData(unsigned short aSaveData, unsigned char& aTypeIndex, unsigned char& aVariant, unsigned char& aFlags)
+    {
+        //Get the tile type, the first tile type bit that is set is the tile's type
+        unsigned short tileBits = aSaveData & ~(TILE_HERO_SPAWN_POINT | TILE_ENEMY_SPAWN_POINT);
+        for (unsigned char i = 0; i < TileTypeCount; i++)
+        {
+            if ((tileBits & TILES_TYPES[i]) != 0)
             {
-                Error(false, "Failed to save: %s", aFilename.c_str());
+                //The rest of the bits are the variant, another tile type bit makes the variant invalid
+                const TileTypeBehaviour& behaviour = Tile::GetBehaviourForTileType(TILES_TYPES[i]);
+                unsigned int variant = tileBits & ~TILES_TYPES[i];
+
+                //The original animated tiles (ie. the FireTile) saved their current animation frame as the variant, the
+                //levels saved that way load the first variant, the animation frame comes from the shared animation clock
+                if (variant >= behaviour.variantCount && behaviour.animationFrameCount > 1 && variant < behaviour.animationFrameCount)
+                {
+                    variant = 0;
+                }
+
+                if (variant >= behaviour.variantCount)
+                {
+                    return false;
+                }
+                aTypeIndex = i;
+                aVariant = (unsigned char)variant;
+
+                //Set the flags, the walkable flag comes from the tile type, a hero spawn point takes precedence like it does when saving
+                aFlags = behaviour.isWalkable == true ? TileFlagWalkable : TileFlagNone;
+                if ((aSaveData & TILE_HERO_SPAWN_POINT) != 0)
+                {
+                    aFlags |= TileFlagHeroSpawnPoint;
+                }
+                else if ((aSaveData & TILE_ENEMY_SPAWN_POINT) != 0)
+                {
+                    aFlags |= TileFlagEnemySpawnPoint;
+                }
+                return true;
             }
         }
+
+        return false;
+    }
+
+    bool SubSection::WriteSaveData(const string& aFilename, const unsigned short* aSaveData, unsigned int aNumberOfTiles)
+    {
+        //Create output stream (write to a file), for the temporary file
+        string temporaryFilename = aFilename + SUBSECTION_TEMPORARY_FILE_EXTENSION;
+        ofstream outputStream;
+        outputStream.open(temporaryFilename, ofstream::out | ofstream::binary | ofstream::trunc);
+
+        //Check if the file opened
+        if (outputStream.is_open() == false)
+        {
+            return false;
+        }
+
+        //Write the tile data and close the output stream
+        outputStream.write((const char*)aSaveData, aNumberOfTiles * sizeof(unsigned short));
+        outputStream.close();
+
+        //If the write failed, delete the temporary file and leave the old file untouched
+        if (outputStream.fail() == true)
+        {
+            remove(temporaryFilename.c_str());
+            return false;
+        }
+
+        //The temporary file is complete, replace the old file with it
+        return ServiceLocator::GetPlatformLayer()->ReplaceFileAtPath(temporaryFilename, aFilename);
     }
 
     void SubSection::Update(double aDelta)
@@ -310,22 +382,74 @@ namespace GameDev2D
         //Is the sub-section active?
         if (IsEnabled() == true)
         {
-            //Cycle through the tiles and update them
-            unsigned int i = 0;
-            for (i = 0; i < GetNumberOfTiles(); i++)
+            Simulate(aDelta);
+        }
+    }
+
+    void SubSection::Simulate(double aDelta)
+    {
+        //Cycle through the pickups, update them or delete them once they are picked up
+        unsigned int i = 0;
+        for (i = 0; i < GetNumberOfTiles(); i++)
+        {
+            if (m_TilePickups[i] != nullptr)
             {
-                if (m_Tiles[i] != nullptr)
+                if (m_TilePickups[i]->IsEnabled() == true)
                 {
-                    m_Tiles[i]->Update(aDelta);
+                    m_TilePickups[i]->Update(aDelta);
                 }
+                else
+                {
+                    SafeDelete(m_TilePickups[i]);
+                }
+            }
+        }
+
+        //Cycle through and update all the enemies
+        for (i = 0; i < m_Enemies.size(); i++)
+        {
+            m_Enemies.at(i)->Update(aDelta);
+        }
+    }
+
+    void SubSection::DeferHeroDamage(unsigned int aAttackDamage)
+    {
+        m_DeferredHeroDamages.push_back(aAttackDamage);
+    }
+
+    void SubSection::DeferProjectile(ProjectileOwner aOwner, vec2 aPosition, vec2 aDirection, float aSpeed, unsigned int aAttackDamage)
+    {
+        DeferredProjectile projectile;
+        projectile.owner = aOwner;
+        projectile.position = aPosition;
+        projectile.direction = aDirection;
+        projectile.speed = aSpeed;
+        projectile.attackDamage = aAttackDamage;
+        m_DeferredProjectiles.push_back(projectile);
+    }
+
+    void SubSection::MergeDeferredWrites()
+    {
+        //Apply the damage to the hero
+        if (m_World != nullptr && m_World->GetHero() != nullptr)
+        {
+            for (unsigned int i = 0; i < m_DeferredHeroDamages.size(); i++)
+            {
+                m_World->GetHero()->ApplyDamage(m_DeferredHeroDamages.at(i));
             }
+        }
+        m_DeferredHeroDamages.clear();
 
-            //Cycle through and update all the enemies
-            for (i = 0; i < m_Enemies.size(); i++)
+        //Fire the projectiles, if the projectile manager is full the projectile isn't fired
+        if (m_World != nullptr && m_World->GetProjectileManager() != nullptr)
+        {
+            for (unsigned int i = 0; i < m_DeferredProjectiles.size(); i++)
             {
-                m_Enemies.at(i)->Update(aDelta);
+                DeferredProjectile& projectile = m_DeferredProjectiles.at(i);
+                m_World->GetProjectileManager()->Fire(projectile.owner, this, projectile.position, projectile.direction, projectile.speed, projectile.attackDamage);
             }
         }
+        m_DeferredProjectiles.clear();
     }
 
     void SubSection::Draw()
@@ -333,48 +457,92 @@ namespace GameDev2D
         //Is the sub-section active?
         if (IsEnabled() == true)
         {
-            //Cycle through the tiles and draw them
+            //Rebuild the tile batches, if a tile has changed since the last draw
+            if (m_AreTileDrawBatchesDirty == true)
+            {
+                RefreshTileDrawBatches();
+            }
+
+            //Get the sub-section's world bounds and the camera's view bounds
+            Graphics* graphics = ServiceLocator::GetGraphics();
+            unsigned int numberOfTiles = GetNumberOfTiles();
+            vec2 minimum = GetWorldPosition();
+            vec2 maximum = minimum + vec2(GetSize());
+            vec2 viewMinimum;
+            vec2 viewMaximum;
+            graphics->GetViewBounds(viewMinimum, viewMaximum);
+
+            //If the sub-section is completely outside the camera's view, none of the tiles need to be drawn. The enemies
+            //are still drawn, they cull themselves and could be standing on the edge of the sub-section
+            if (graphics->IsInView(minimum, maximum) == false)
+            {
+                graphics->AddCulledObjects(numberOfTiles);
+                DrawEnemies();
+                return;
+            }
+
+            //Draw the static tiles, one draw call for each shared sprite that is used
             unsigned int i = 0;
-            for (i = 0; i < GetNumberOfTiles(); i++)
+            bool isCompletelyInView = minimum.x >= viewMinimum.x && minimum.y >= viewMinimum.y && maximum.x <= viewMaximum.x && maximum.y <= viewMaximum.y;
+            for (i = 0; i < m_TileDrawBatches.size(); i++)
             {
-                //
-                if (m_Tiles[i] != nullptr)
+                if (m_TileDrawBatches.at(i).positions.size() > 0)
                 {
-                    //Draw the tile
-                    m_Tiles[i]->Draw();
+                    if (isCompletelyInView == true)
+                    {
+                        //The whole sub-section is visible, draw the cached batch
+                        GetTileSprite(i)->DrawBatch(m_TileDrawBatches.at(i).positions, m_TileDrawBatches.at(i).angles);
+                        graphics->AddDrawnObjects((unsigned int)m_TileDrawBatches.at(i).positions.size());
+                    }
+                    else
+                    {
+                        //The sub-section is partially visible (ie. during a camera shift), only draw the visible tiles
+                        DrawVisibleTiles(i, viewMinimum, viewMaximum);
+                    }
+                }
+            }
+
+            //Draw the animated tiles
+            DrawAnimatedTiles();
+
+            //Cycle through and draw the pickups
+            for (i = 0; i < numberOfTiles; i++)
+            {
+                if (m_TilePickups[i] != nullptr && m_TilePickups[i]->IsEnabled() == true)
+                {
+                    m_TilePickups[i]->Draw();
+                }
+            }
 
-                    //Are we in the level editor (we know this because the pointer would be null if we weren't)
-                    if (m_LevelEditor != nullptr)
+            //Are we in the level editor (we know this because the pointer would be null if we weren't)
+            if (m_LevelEditor != nullptr)
+            {
+                for (i = 0; i < numberOfTiles; i++)
+                {
+                    //Draw the hero spawn point
+                    if ((m_TileFlags[i] & TileFlagHeroSpawnPoint) != 0)
                     {
-                        //Draw the hero spawn point
-                        if (m_Tiles[i]->IsHeroSpawnPoint() == true)
-                        {
-                            m_HeroSpawnPoint->SetLocalPosition(m_Tiles[i]->GetLocalPosition());
-                            m_HeroSpawnPoint->Draw();
-                        }
+                        m_HeroSpawnPoint->SetLocalPosition(GetWorldPosition() + GetTilePositionForIndex(i));
+                        m_HeroSpawnPoint->Draw();
+                    }
 
-                        //Draw the enemy spawn point
-                        if (m_Tiles[i]->IsEnemySpawnPoint() == true)
-                        {
-                            m_EnemySpawnPoint->SetLocalPosition(m_Tiles[i]->GetLocalPosition());
-                            m_EnemySpawnPoint->Draw();
-                        }
+                    //Draw the enemy spawn point
+                    if ((m_TileFlags[i] & TileFlagEnemySpawnPoint) != 0)
+                    {
+                        m_EnemySpawnPoint->SetLocalPosition(GetWorldPosition() + GetTilePositionForIndex(i));
+                        m_EnemySpawnPoint->Draw();
                     }
                 }
             }
 
             //If there is debug data to draw, draw it
-            if (m_DebugDrawingFlags != DebugDrawNothing && m_DebugRenderTarget != nullptr)
+            if (m_DebugDrawingFlags != DebugDrawNothing)
             {
-                mat4 matrix = translate(mat4(1.0f), vec3(GetWorldPosition().x, GetWorldPosition().y, 0.0f));
-                m_DebugRenderTarget->GetTextureFrame()->Draw(matrix);
+                DebugDraw();
             }
 
-            //Cycle through and draw all the enemies
-            for (i = 0; i < m_Enemies.size(); i++)
-            {
-                m_Enemies.at(i)->Draw();
-            }
+            //Draw all the enemies
+            DrawEnemies();
         }
     }
 
@@ -431,51 +599,159 @@ namespace GameDev2D
     {
         if (aIndex < GetNumberOfTiles())
         {
-            if (m_Tiles[aIndex] != nullptr)
+            if (m_TileTypeIndices[aIndex] != TILE_TYPE_INDEX_UNKNOWN)
             {
-                return m_Tiles[aIndex]->GetTileType();
+                return TILES_TYPES[m_TileTypeIndices[aIndex]];
             }
         }
         return TileTypeUnknown;
     }
 
-    Tile* SubSection::SetTileTypeAtIndex(unsigned int aIndex, TileType aTileType, unsigned int aVariant)
+    void SubSection::SetTileTypeAtIndex(unsigned int aIndex, TileType aTileType, unsigned int aVariant)
     {
         if (aIndex < GetNumberOfTiles())
         {
+            //Safety check the tile type
+            unsigned char typeIndex = Tile::GetIndexForTileType(aTileType);
+            if (typeIndex == TILE_TYPE_INDEX_UNKNOWN)
+            {
+                Error(false, "Failed to set the tile type at index %u, the tile type is invalid", aIndex);
+                return;
+            }
 
+            //An invalid variant falls back to the first variant
+            unsigned char variant = aVariant < Tile::GetBehaviourForTileType(aTileType).variantCount ? (unsigned char)aVariant : 0;
 
-            //Don't replace the tile if its the same type of tile that already exists
-            if (m_Tiles[aIndex] != nullptr && m_Tiles[aIndex]->GetTileType() == aTileType)
+            //Nothing to do if the tile already has the tile type and variant
+            if (m_TileTypeIndices[aIndex] == typeIndex && m_TileVariants[aIndex] == variant)
             {
-                //Ensure the variant was updated before we return
-                m_Tiles[aIndex]->SetVariant(aVariant);
-                return m_Tiles[aIndex];
+                return;
             }
 
-            //Delete the tile at the index, if one exists
-            RemoveChild(m_Tiles[aIndex]);
-            SafeDelete(m_Tiles[aIndex]);
+            //If the tile type is changing, reset the tile's flags and remove its pickup
+            if (m_TileTypeIndices[aIndex] != typeIndex)
+            {
+                m_TileTypeIndices[aIndex] = typeIndex;
+                m_TileFlags[aIndex] = Tile::GetBehaviourForTileType(aTileType).isWalkable == true ? TileFlagWalkable : TileFlagNone;
+                SafeDelete(m_TilePickups[aIndex]);
+            }
 
-            //BeginProfile();
-            //Set the tile at the index
-            m_Tiles[aIndex] = CreateTile(aTileType, aVariant, GetTileCoordinatesForIndex(aIndex));
+            //Set the variant
+            m_TileVariants[aIndex] = variant;
 
-            //double duration = EndProfile();
-            //Log("%f", duration);
+            //The tile's sprite has changed, the tile batches need to be rebuilt before the next draw
+            m_AreTileDrawBatchesDirty = true;
+            m_Revision++;
+        }
+    }
 
-            //Add the tile as a child
-            if (m_Tiles[aIndex] != nullptr)
+    void SubSection::SetTileTypeAtIndices(const vector<unsigned int>& aIndices, TileType aTileType, unsigned int aVariant)
+    {
+        //Safety check the tile type, once for all the tiles
+        unsigned char typeIndex = Tile::GetIndexForTileType(aTileType);
+        if (typeIndex == TILE_TYPE_INDEX_UNKNOWN)
+        {
+            Error(false, "Failed to set the tile type at %u indices, the tile type is invalid", (unsigned int)aIndices.size());
+            return;
+        }
+
+        //An invalid variant falls back to the first variant, the flags are the same for every tile that changes type
+        const TileTypeBehaviour& behaviour = Tile::GetBehaviourForTileType(aTileType);
+        unsigned char variant = aVariant < behaviour.variantCount ? (unsigned char)aVariant : 0;
+        unsigned char flags = behaviour.isWalkable == true ? TileFlagWalkable : TileFlagNone;
+
+        bool hasChanged = false;
+        for (unsigned int i = 0; i < aIndices.size(); i++)
+        {
+            //Skip the invalid indices and the tiles that already have the tile type and variant
+            unsigned int index = aIndices.at(i);
+            if (index >= GetNumberOfTiles() || (m_TileTypeIndices[index] == typeIndex && m_TileVariants[index] == variant))
             {
-                AddChild(m_Tiles[aIndex], false);
+                continue;
             }
 
+            //If the tile type is changing, reset the tile's flags and remove its pickup
+            if (m_TileTypeIndices[index] != typeIndex)
+            {
+                m_TileTypeIndices[index] = typeIndex;
+                m_TileFlags[index] = flags;
+                SafeDelete(m_TilePickups[index]);
+            }
 
+            m_TileVariants[index] = variant;
+            hasChanged = true;
+        }
 
-            return m_Tiles[aIndex];
+        //The tile batches are rebuilt once before the next draw, no matter how many tiles changed
+        if (hasChanged == true)
+        {
+            m_AreTileDrawBatchesDirty = true;
+            m_Revision++;
         }
+    }
 
-        return nullptr;
+    void SubSection::GetTileDataAtIndex(unsigned int aIndex, unsigned char& aTypeIndex, unsigned char& aVariant, unsigned char& aFlags)
+    {
+        //If this assert is hit, the index isn't on the subsection
+        assert(aIndex < GetNumberOfTiles());
+
+        aTypeIndex = m_TileTypeIndices[aIndex];
+        aVariant = m_TileVariants[aIndex];
+        aFlags = m_TileFlags[aIndex];
+    }
+
+    void SubSection::SetTileDataAtIndex(unsigned int aIndex, unsigned char aTypeIndex, unsigned char aVariant, unsigned char aFlags)
+    {
+        //If this assert is hit, the index isn't on the subsection
+        assert(aIndex < GetNumberOfTiles());
+
+        //Nothing to do if the tile data is the same
+        if (m_TileTypeIndices[aIndex] == aTypeIndex && m_TileVariants[aIndex] == aVariant && m_TileFlags[aIndex] == aFlags)
+        {
+            return;
+        }
+        m_Revision++;
+
+        //If the tile type is changing, remove the tile's pickup
+        if (m_TileTypeIndices[aIndex] != aTypeIndex)
+        {
+            SafeDelete(m_TilePickups[aIndex]);
+        }
+
+        //Only the type and variant change the tile's sprite, the flags only change the spawn points
+        if (m_TileTypeIndices[aIndex] != aTypeIndex || m_TileVariants[aIndex] != aVariant)
+        {
+            m_TileTypeIndices[aIndex] = aTypeIndex;
+            m_TileVariants[aIndex] = aVariant;
+            m_AreTileDrawBatchesDirty = true;
+        }
+
+        m_TileFlags[aIndex] = aFlags;
+    }
+
+    unsigned int SubSection::GetRevision()
+    {
+        return m_Revision;
+    }
+
+    bool SubSection::IsTileWalkableAtIndex(unsigned int aIndex)
+    {
+        //If this assert is hit, the index that was passed in is out of bounds
+        assert(aIndex < GetNumberOfTiles());
+        return (m_TileFlags[aIndex] & TileFlagWalkable) != 0;
+    }
+
+    bool SubSection::IsHeroSpawnPointAtIndex(unsigned int aIndex)
+    {
+        //If this assert is hit, the index that was passed in is out of bounds
+        assert(aIndex < GetNumberOfTiles());
+        return (m_TileFlags[aIndex] & TileFlagHeroSpawnPoint) != 0;
+    }
+
+    vec2 SubSection::GetTilePositionForIndex(unsigned int aIndex)
+    {
+        uvec2 coordinates = GetTileCoordinatesForIndex(aIndex);
+        return vec2((float)(coordinates.x * GetTileSize()), (float)(coordinates.y * GetTileSize()));
     }
 
     bool SubSection::ValidateCoordinates(ivec2 aCoordinates)
@@ -524,18 +800,19 @@ namespace GameDev2D
 
     unsigned int SubSection::GetTileIndexForTile(Tile* aTile)
     {
-        return GetTileIndexForPosition(aTile->GetLocalPosition());
+        return aTile->GetIndex();
     }
 
     Tile* SubSection::GetTileForIndex(unsigned int aIndex)
     {
         //If this assert is hit, the index that was passed in is out of bounds
-
         assert(aIndex < GetNumberOfTiles());
-        assert(aIndex >= 0);
 
-        //If this assert is hit, then the tile object at the index is null
-        assert(m_Tiles[aIndex] != nullptr);
+        //The Tile object is only a handle into the tile arrays, create it the first time it is asked for
+        if (m_Tiles[aIndex] == nullptr)
+        {
+            m_Tiles[aIndex] = new Tile(this, aIndex);
+        }
 
         //Return the tile at the index
         return m_Tiles[aIndex];
@@ -562,45 +839,263 @@ namespace GameDev2D
         }
     }
 
-    Tile* SubSection::CreateTile(TileType aTileType, unsigned int aVariant, uvec2 aCoordinates)
+    const vector<Enemy*>& SubSection::GetEnemiesForTileIndex(unsigned int aIndex)
+    {
+        //If this assert is hit, then the index is out of bounds
+        assert(aIndex < GetNumberOfTiles());
+
+        //Return the enemy bucket for the tile
+        return m_TileEnemies[aIndex];
+    }
+
+    void SubSection::GetActiveEnemiesInRadius(vec2 aPosition, float aRadius, vector<Enemy*>& aEnemies)
     {
-        //Create the new tile based on the TileType
-        switch (aTileType)
+        //Calculate the range of tile coordinates the radius overlaps, clamped to the subsection
+        float tileSize = (float)GetTileSize();
+        int lastX = (int)GetNumberOfHorizontalTiles() - 1;
+        int lastY = (int)GetNumberOfVerticalTiles() - 1;
+        int minX = clamp((int)floorf((aPosition.x - aRadius) / tileSize), 0, lastX);
+        int minY = clamp((int)floorf((aPosition.y - aRadius) / tileSize), 0, lastY);
+        int maxX = clamp((int)floorf((aPosition.x + aRadius) / tileSize), 0, lastX);
+        int maxY = clamp((int)floorf((aPosition.y + aRadius) / tileSize), 0, lastY);
+
+        //Cycle through the overlapped tiles and check the distance of the active enemies on them
+        for (int y = minY; y <= maxY; y++)
         {
-        case TileTypeGround:
-            return new GroundTile(this, aCoordinates, aVariant);
+            for (int x = minX; x <= maxX; x++)
+            {
+                const vector<Enemy*>& bucket = m_TileEnemies[GetTileIndexForCoordinates(uvec2(x, y))];
+                for (unsigned int i = 0; i < bucket.size(); i++)
+                {
+                    if (bucket.at(i)->IsEnabled() == true)
+                    {
+                        vec2 offset = bucket.at(i)->GetWorldPosition() - GetWorldPosition() - aPosition;
+                        if (dot(offset, offset) <= aRadius * aRadius)
+                        {
+                            aEnemies.push_back(bucket.at(i));
+                        }
+                    }
+                }
+            }
+        }
+    }
 
-        case TileTypeTree:
-            return new TreeTile(this, aCoordinates, aVariant);
+    void SubSection::EnemyChangedTiles(Enemy* aEnemy, Tile* aNewTile, Tile* aOldTile)
+    {
+        //Remove the enemy from the old tile's bucket, the order of the bucket doesn't matter
+        vector<Enemy*>& oldBucket = m_TileEnemies[GetTileIndexForTile(aOldTile)];
+        for (unsigned int i = 0; i < oldBucket.size(); i++)
+        {
+            if (oldBucket.at(i) == aEnemy)
+            {
+                oldBucket.at(i) = oldBucket.back();
+                oldBucket.pop_back();
+                break;
+            }
+        }
+
+        //Add the enemy to the new tile's bucket
+        m_TileEnemies[GetTileIndexForTile(aNewTile)].push_back(aEnemy);
+    }
 
-        case TileTypeWater:
-            return new WaterTile(this, aCoordinates, aVariant);
+    void SubSection::CreateTileArrays()
+    {
+        //Allocate the tile arrays, one entry for each tile
+        unsigned int numberOfTiles = GetNumberOfTiles();
+        m_TileTypeIndices = new unsigned char[numberOfTiles];
+        m_TileVariants = new unsigned char[numberOfTiles];
+        m_TileFlags = new unsigned char[numberOfTiles];
+        m_TilePickups = new Pickup*[numberOfTiles];
+        m_Tiles = new Tile*[numberOfTiles];
+
+        //Initialize the tiles, they don't have a type until the sub-section is loaded
+        for (unsigned int i = 0; i < numberOfTiles; i++)
+        {
+            m_TileTypeIndices[i] = TILE_TYPE_INDEX_UNKNOWN;
+            m_TileVariants[i] = 0;
+            m_TileFlags[i] = TileFlagNone;
+            m_TilePickups[i] = nullptr;
+            m_Tiles[i] = nullptr;
+        }
 
-        case TileTypeBoulder:
-            return new BoulderTile(this, aCoordinates, aVariant);
+        //Allocate the shared tile sprites, they are created the first time they are drawn
+        m_TileSprites = new Sprite*[Tile::GetNumberOfTileSprites()];
+        for (unsigned int i = 0; i < Tile::GetNumberOfTileSprites(); i++)
+        {
+            m_TileSprites[i] = nullptr;
+        }
 
-        case TileTypeRock:
-            return new RockTile(this, aCoordinates, aVariant);
+        //Create a tile batch for each shared sprite
+        m_TileDrawBatches.resize(Tile::GetNumberOfTileSprites());
 
-        case TileTypeSand:
-            return new SandTile(this, aCoordinates, aVariant);
+        //Allocate the enemy buckets, one for each tile
+        m_TileEnemies = new vector<Enemy*>[numberOfTiles];
 
-        case TileTypeBridge:
-            return new BridgeTile(this, aCoordinates, aVariant);
+        //Track the tile arrays' memory
+        MemoryTracker::TrackAllocation(MemoryTag_Tiles, GetTileArraysNumberOfBytes());
+    }
 
-        case TileTypeFire:
-            return new FireTile(this, aCoordinates, aVariant);
+    unsigned int SubSection::GetTileArraysNumberOfBytes()
+    {
+        unsigned int bytesPerTile = sizeof(unsigned char) * 3 + sizeof(Pickup*) + sizeof(Tile*) + sizeof(vector<Enemy*>);
+        return GetNumberOfTiles() * bytesPerTile + Tile::GetNumberOfTileSprites() * sizeof(Sprite*);
+    }
 
-        case TileTypeUnknown:
-        default:
-            break;
+    void SubSection::RefreshTileDrawBatches()
+    {
+        //Clear the tile batches and the animated tiles, the vectors keep their capacity
+        for (unsigned int i = 0; i < m_TileDrawBatches.size(); i++)
+        {
+            m_TileDrawBatches.at(i).positions.clear();
+            m_TileDrawBatches.at(i).angles.clear();
         }
+        m_AnimatedTiles.clear();
+        m_AnimatedTileSpriteIndices.clear();
+        m_AnimatedTilePositions.clear();
+        m_AnimatedTileAngles.clear();
+        m_AnimatedTileSourceFrames.clear();
+
+        //Cycle through the tiles and add them to the batch for their sprite, the sub-section doesn't
+        //move (the camera does) so the world positions only need to be calculated here
+        vec2 worldPosition = GetWorldPosition();
+        for (unsigned int i = 0; i < GetNumberOfTiles(); i++)
+        {
+            //Tiles without a type aren't drawn
+            unsigned int spriteIndex = GetBaseSpriteIndexForTileIndex(i);
+            if (spriteIndex == Tile::GetNumberOfTileSprites())
+            {
+                continue;
+            }
 
-        return nullptr;
+            //Is the tile animated, or static
+            vec2 position = worldPosition + GetTilePositionForIndex(i);
+            if (Tile::GetBehaviourForTileType(GetTileTypeForIndex(i)).animationFrameCount > 1)
+            {
+                //The sprite index is invalid until the first draw, so that the source frame gets set
+                m_AnimatedTiles.push_back((unsigned short)i);
+                m_AnimatedTileSpriteIndices.push_back(Tile::GetNumberOfTileSprites());
+                m_AnimatedTilePositions.push_back(position);
+                m_AnimatedTileAngles.push_back(0.0f);
+                m_AnimatedTileSourceFrames.push_back(SourceFrame());
+            }
+            else
+            {
+                m_TileDrawBatches.at(spriteIndex).positions.push_back(position);
+                m_TileDrawBatches.at(spriteIndex).angles.push_back(0.0f);
+            }
+        }
+
+        //The tile batches are up to date
+        m_AreTileDrawBatchesDirty = false;
+    }
+
+    unsigned int SubSection::GetBaseSpriteIndexForTileIndex(unsigned int aIndex)
+    {
+        //The tiles without a type use the index past the last sprite
+        TileType tileType = GetTileTypeForIndex(aIndex);
+        if (tileType == TileTypeUnknown)
+        {
+            return Tile::GetNumberOfTileSprites();
+        }
+
+        //The sprite index of the variant's first animation frame
+        const TileTypeBehaviour& behaviour = Tile::GetBehaviourForTileType(tileType);
+        return behaviour.spriteIndex + m_TileVariants[aIndex] * behaviour.animationFrameCount;
+    }
+
+    void SubSection::DrawVisibleTiles(unsigned int aSpriteIndex, vec2 aViewMinimum, vec2 aViewMaximum)
+    {
+        //Clear the visible tiles batch, the vectors keep their capacity
+        m_VisibleTileDrawBatch.positions.clear();
+        m_VisibleTileDrawBatch.angles.clear();
+
+        //Gather the tiles in the batch that overlap the camera's view
+        const TileDrawBatch& batch = m_TileDrawBatches.at(aSpriteIndex);
+        float tileSize = (float)GetTileSize();
+        for (unsigned int i = 0; i < batch.positions.size(); i++)
+        {
+            const vec2& position = batch.positions.at(i);
+            if (position.x <= aViewMaximum.x && position.x + tileSize >= aViewMinimum.x && position.y <= aViewMaximum.y && position.y + tileSize >= aViewMinimum.y)
+            {
+                m_VisibleTileDrawBatch.positions.push_back(position);
+                m_VisibleTileDrawBatch.angles.push_back(batch.angles.at(i));
+            }
+        }
+
+        //Count the drawn and culled tiles
+        Graphics* graphics = ServiceLocator::GetGraphics();
+        graphics->AddDrawnObjects((unsigned int)m_VisibleTileDrawBatch.positions.size());
+        graphics->AddCulledObjects((unsigned int)(batch.positions.size() - m_VisibleTileDrawBatch.positions.size()));
+
+        //Draw the visible tiles in one draw call
+        if (m_VisibleTileDrawBatch.positions.size() > 0)
+        {
+            GetTileSprite(aSpriteIndex)->DrawBatch(m_VisibleTileDrawBatch.positions, m_VisibleTileDrawBatch.angles);
+        }
+    }
+
+    void SubSection::DrawEnemies()
+    {
+        //Cycle through and draw all the enemies
+        for (unsigned int i = 0; i < m_Enemies.size(); i++)
+        {
+            m_Enemies.at(i)->Draw();
+        }
+    }
+
+    void SubSection::DrawAnimatedTiles()
+    {
+        //Are there any animated tiles to draw
+        if (m_AnimatedTiles.size() == 0)
+        {
+            return;
+        }
+
+        //Cycle through the animated tiles, only the tiles whose frame has changed need their source frame updated
+        for (unsigned int i = 0; i < m_AnimatedTiles.size(); i++)
+        {
+            unsigned int index = m_AnimatedTiles.at(i);
+            unsigned int spriteIndex = GetBaseSpriteIndexForTileIndex(index) + Tile::GetAnimationFrameForTileType(GetTileTypeForIndex(index));
+            if (spriteIndex != m_AnimatedTileSpriteIndices.at(i))
+            {
+                m_AnimatedTileSpriteIndices.at(i) = spriteIndex;
+                m_AnimatedTileSourceFrames.at(i) = GetTileSprite(spriteIndex)->GetSourceFrame();
+            }
+        }
+
+        //All the tile sprites are in the same texture atlas, so every animated tile can be drawn in one draw call
+        GetTileSprite(m_AnimatedTileSpriteIndices.at(0))->DrawBatch(m_AnimatedTilePositions, m_AnimatedTileAngles, m_AnimatedTileSourceFrames);
+    }
+
+    Sprite* SubSection::GetTileSprite(unsigned int aSpriteIndex)
+    {
+        //If this assert is hit, the sprite index is out of bounds
+        assert(aSpriteIndex < Tile::GetNumberOfTileSprites());
+
+        //Create the shared sprite the first time it is needed
+        if (m_TileSprites[aSpriteIndex] == nullptr)
+        {
+            //Find the tile type that the sprite index belongs to, and the atlas key for the sprite
+            for (unsigned int i = 0; i < TileTypeCount; i++)
+            {
+                const TileTypeBehaviour& behaviour = Tile::GetBehaviourForTileType(TILES_TYPES[i]);
+                unsigned int numberOfSprites = behaviour.variantCount * behaviour.animationFrameCount;
+                if (aSpriteIndex >= behaviour.spriteIndex && aSpriteIndex < behaviour.spriteIndex + numberOfSprites)
+                {
+                    m_TileSprites[aSpriteIndex] = new Sprite("MainAtlas", behaviour.atlasKeys[aSpriteIndex - behaviour.spriteIndex]);
+                    break;
+                }
+            }
+        }
+
+        return m_TileSprites[aSpriteIndex];
     }
 
     void SubSection::SetHeroSpawnPointForTile(Tile* aTile)
     {
+        //The spawn points are part of the saved data
+        m_Revision++;
+
         if (aTile->IsHeroSpawnPoint() == true)//If the tile is a hero spawn point already
         {
             aTile->SetIsHeroSpawnPoint(false);//Deactivate it
@@ -610,7 +1105,7 @@ namespace GameDev2D
             //Cycle through and ensure there isn't already a spawn point set for this hero
             for (unsigned int i = 0; i < GetNumberOfTiles(); i++)
             {
-                GetTileForIndex(i)->SetIsHeroSpawnPoint(false);
+                m_TileFlags[i] &= ~TileFlagHeroSpawnPoint;
             }
 
             //Set the tile hero spawn point flag
@@ -626,6 +1121,9 @@ namespace GameDev2D
 
     void SubSection::SetEnemySpawnPoint(Tile* aTile)
     {
+        //The spawn points are part of the saved data
+        m_Revision++;
+
         //If the tile is already a spawn point
         if (aTile->IsEnemySpawnPoint() == true)
         {
@@ -648,37 +1146,18 @@ namespace GameDev2D
     {
         if (m_World != nullptr)
         {
-            m_Enemies.push_back(new Enemy(m_World, aTile));
+            //Create the enemy and add it to the spawn tile's bucket
+            Enemy* enemy = new Enemy(m_World, aTile);
+            m_Enemies.push_back(enemy);
+            m_TileEnemies[GetTileIndexForTile(aTile)].push_back(enemy);
         }
     }
 
     void SubSection::EnableDebugDrawing(unsigned int aDebugDrawingFlags)
     {
 #if DEBUG
-        //Set the debug draw flags
+        //Set the debug draw flags, the debug data is drawn every frame by the DebugRenderer
         m_DebugDrawingFlags = aDebugDrawingFlags;
-
-        //Is there anything to draw?
-        if (m_DebugDrawingFlags != DebugDrawNothing)
-        {
-            //Create a render target, if one doesn't already exist
-            if (m_DebugRenderTarget == nullptr)
-            {
-                unsigned int width = GetTileSize() * GetNumberOfHorizontalTiles();
-                unsigned int height = GetTileSize() * GetNumberOfVerticalTiles();
-                m_DebugRenderTarget = new RenderTarget(width, height);
-                m_DebugRenderTarget->CreateFrameBuffer();
-                m_DebugRenderTarget->GetTextureFrame()->SetShader(ServiceLocator::GetShaderManager()->GetPassthroughTextureShader());
-            }
-
-            //Refresh the debug draw render target
-            RefreshDebugDraw();
-        }
-        else
-        {
-            //Delete the render target
-            SafeDelete(m_DebugRenderTarget);
-        }
 #endif
     }
 
@@ -692,16 +1171,9 @@ namespace GameDev2D
         return m_DebugDrawingFlags;
     }
 
-    void SubSection::RefreshDebugDraw()
+    void SubSection::DebugDraw()
     {
 #if DEBUG
-        //Cache the graphics active render target
-        RenderTarget* oldRenderTarget = ServiceLocator::GetGraphics()->GetActiveRenderTarget();
-
-        //Set the Label's render target as the active render target
-        ServiceLocator::GetGraphics()->SetActiveRenderTarget(m_DebugRenderTarget);
-        ServiceLocator::GetGraphics()->Clear();
-
         //Draw the debug tile data
         bool tileData = (m_DebugDrawingFlags & (DebugDrawTileIndex)) != 0 || (m_DebugDrawingFlags & (DebugDrawTileCoordinates)) != 0 || (m_DebugDrawingFlags & (DebugDrawTilePositionLocal)) != 0 || (m_DebugDrawingFlags & (DebugDrawTilePositionWorld)) != 0;
         if (tileData == true)
@@ -726,8 +1198,8 @@ namespace GameDev2D
             DebugDrawSubSectionData();
         }
 
-        //Set the original graphic's render target back
-        ServiceLocator::GetGraphics()->SetActiveRenderTarget(oldRenderTarget);
+        //Draw the debug data now, with the camera the sub-section is drawn with
+        ServiceLocator::GetDebugRenderer()->Flush();
 #endif
     }
 
@@ -759,19 +1231,9 @@ namespace GameDev2D
             }
         }
 
-
-        //Create the debug draw label (on the stack), it will only be used in this method, which is seldomly called
-        Label debugLabel("Ubuntu-B", "ttf", fontSize);
-        debugLabel.SetAnchorPoint(0.5f, 0.5f);
-        debugLabel.SetJustification(JustifyCenter);
-        debugLabel.SetColor(Color::WhiteColor());
-
-        //Create the rect outline
-        Rect rect;
-        rect.SetSize((float)GetTileSize(), (float)GetTileSize());
-        rect.SetAnchorPoint(0.5f, 0.5f);
-        rect.SetColor(Color::WhiteColor());
-        rect.SetIsFilled(false);
+        //Cache the debug renderer and the tile size
+        DebugRenderer* debugRenderer = ServiceLocator::GetDebugRenderer();
+        vec2 tileSize = vec2((float)GetTileSize(), (float)GetTileSize());
 
         //Initialize a string stream
         stringstream ss;
@@ -779,92 +1241,41 @@ namespace GameDev2D
         //Cycle through all the tiles in the subsection
         for (unsigned int i = 0; i < GetNumberOfTiles(); i++)
         {
-            //Set the position for the debug label
-            vec2 position = GetTileForIndex(i)->GetCenter(false);
-            debugLabel.SetLocalPosition(position);
+            //Get the world position of the tile
+            vec2 position = GetWorldPosition() + GetTilePositionForIndex(i);
 
             //Clear the string stream
             ss.str("");
 
-            //Do we need to draw the tile index data
+            //Add the index to the string stream
             if (tileIndex == true)
             {
-                //Add the index to the string stream
                 ss << i;
-
-                //Do we also have to draw the tile coordinates data?
-                if (tileCoordinates == true || tilePositionLocal == true || tilePositionWorld == true)
-                {
-                    //If we do - then do a new line
-                    ss << "ren";
-                }
-                else
-                {
-                    //Otherwise set the text and draw the label
-                    debugLabel.SetText(ss.str());
-                    debugLabel.Draw();
-                }
             }
 
-            //Do we need to draw the tile coordinate data
+            //Add the tile coordinates to the string stream, on a new line
             if (tileCoordinates == true)
             {
-                //Add the tile coordinates to the string stream
                 uvec2 coordinates = GetTileCoordinatesForIndex(i);
-                ss << "(" << coordinates.x << "," << coordinates.y << ")";
-
-                //Do we also have to draw the tile coordinates data?
-                if (tilePositionLocal == true || tilePositionWorld == true)
-                {
-                    //If we do - then do a new line
-                    ss << "\n";
-                }
-                else
-                {
-                    //Otherwise set the text and draw the label
-                    debugLabel.SetText(ss.str());
-                    debugLabel.Draw();
-                }
+                ss << (ss.tellp() > 0 ? "\n" : "") << "(" << coordinates.x << "," << coordinates.y << ")";
             }
 
-            //Do we need to draw the tile's local position
+            //Add the tile's local position to the string stream, on a new line
             if (tilePositionLocal == true)
             {
-                //Add the tile coordinates to the string stream
-                Tile* tile = GetTileForIndex(i);
-                ss << "(" << tile->GetLocalX() << "," << tile->GetLocalY() << ")";
-
-                //Do we also have to draw the tile coordinates data?
-                if (tilePositionWorld == true)
-                {
-                    //If we do - then do a new line
-                    ss << "\n";
-                }
-                else
-                {
-                    //Otherwise set the text and draw the label
-                    debugLabel.SetText(ss.str());
-                    debugLabel.Draw();
-                }
+                vec2 localPosition = GetTilePositionForIndex(i);
+                ss << (ss.tellp() > 0 ? "\n" : "") << "(" << localPosition.x << "," << localPosition.y << ")";
             }
 
-            //Do we need to draw the tile's world position
+            //Add the tile's world position to the string stream, on a new line
             if (tilePositionWorld == true)
             {
-                //Add the tile coordinates to the string stream
-                Tile* tile = GetTileForIndex(i);
-                ss << "(" << tile->GetWorldX() << "," << tile->GetWorldY() << ")";
-
-
-                //Set the text and draw the label
-                debugLabel.SetText(ss.str());
-                debugLabel.Draw();
+                ss << (ss.tellp() > 0 ? "\n" : "") << "(" << position.x << "," << position.y << ")";
             }
 
-
-            //Draw a white Rect around the Tile
-            rect.SetLocalPosition(position);
-            rect.Draw();
+            //Draw the text in the center of the tile, and a white Rect around the Tile
+            debugRenderer->DrawText(ss.str(), position + tileSize / 2.0f, Color::WhiteColor(), (float)fontSize);
+            debugRenderer->DrawRect(position, tileSize, Color::WhiteColor());
         }
     }
 
@@ -876,79 +1287,34 @@ namespace GameDev2D
         bool subSectionPosition = (m_DebugDrawingFlags & (DebugDrawSubSectionPosition)) != 0;
         unsigned int fontSize = subSectionIndex == true && subSectionCoordinates == false ? 60 : 42;
 
-        //Create the debug draw label (on the stack), it will only be used in this method, which is seldomly called
-        Label debugLabel("Ubuntu-B", "ttf", fontSize);
-        debugLabel.SetAnchorPoint(0.5f, 0.5f);
-        debugLabel.SetJustification(JustifyCenter);
-        debugLabel.SetColor(Color::GhostWhiteColor());
-
         //Initialize a string stream
         stringstream ss;
 
         //Get the index for this subsection
         unsigned int index = m_World->GetSubSectionIndexForPosition(GetWorldPosition());
 
-        //Set the position for the debug label
-        vec2 position = vec2((float)(GetTileSize() * GetNumberOfHorizontalTiles()) / 2.0f, (float)(GetTileSize() * GetNumberOfVerticalTiles()) / 2.0f);
-        debugLabel.SetLocalPosition(position);
-
-        //Do we need to draw the subsection index data
+        //Add the index to the string stream
         if (subSectionIndex == true)
         {
-            //Add the index to the string stream
             ss << index;
-
-            //Do we also have to draw the subsection coordinates data?
-            if (subSectionCoordinates == true || subSectionPosition == true)
-            {
-                //If we do - then do a new line
-                ss << "\n";
-            }
-            else
-            {
-                //Otherwise set the text and draw the label
-                debugLabel.SetText(ss.str());
-                debugLabel.Draw();
-            }
         }
 
-        //Do we need to draw the subsection coordinate data
+        //Add the subsection coordinates to the string stream, on a new line
         if (subSectionCoordinates == true)
         {
-            //Add the subsection coordinates to the string stream
             uvec2 coordinates = m_World->GetSubSectionCoordinatesForIndex(index);
-            ss << "(" << coordinates.x << "," << coordinates.y << ")";
-
-            //Do we also have to draw the subsection coordinates data?
-            if (subSectionPosition == true)
-            {
-                //If we do - then do a new line
-                ss << "\n";
-            }
-            else
-            {
-                //Otherwise set the text and draw the label
-                debugLabel.SetText(ss.str());
-                debugLabel.Draw();
-            }
+            ss << (ss.tellp() > 0 ? "\n" : "") << "(" << coordinates.x << "," << coordinates.y << ")";
         }
 
-        //Do we need to draw the subsection position data
+        //Add the subsection position to the string stream, on a new line
         if (subSectionPosition == true)
         {
-            //Add the subsection coordinates to the string stream
-            ss << "(" << GetWorldX() << "," << GetWorldY() << ")";
-
-
-            //Set the text and draw the label
-            debugLabel.SetText(ss.str());
-            debugLabel.Draw();
+            ss << (ss.tellp() > 0 ? "\n" : "") << "(" << GetWorldX() << "," << GetWorldY() << ")";
         }
 
-        //Draw a white Rect around the SubSection
-        Rect rect(GetLocalPosition(), GetSize());
-        rect.SetColor(Color::WhiteColor());
-        rect.SetIsFilled(false);
-        rect.Draw();
+        //Draw the text in the center of the SubSection, and a white Rect around the SubSection
+        DebugRenderer* debugRenderer = ServiceLocator::GetDebugRenderer();
+        debugRenderer->DrawText(ss.str(), GetWorldPosition() + vec2(GetSize()) / 2.0f, Color::GhostWhiteColor(), (float)fontSize);
+        debugRenderer->DrawRect(GetWorldPosition(), vec2(GetSize()), Color::WhiteColor());
     }
-}
\ No newline at end of file
+}
@@ -12,6 +12,20 @@ _______________________________________________
 -Added convenience method "DeactivateSpawnPointsAtTileIndex" to deactivate both enemy and hero spawn points in
 a tile.
 -Added SetEnemySpawnPoint function to ensure we don't place a enemy spawn point on top of the player spawn point.
+-Added a tile bucketed index of the enemies, so that collision queries only look at the enemies near a tile.
+-The tiles are now stored in flat arrays (type, variant, flags and pickup), Tile objects are only created on request.
+-The static tiles are drawn from cached batches, the animated tiles are drawn in one batch driven by Tile's shared clock.
+-The tiles are culled against the camera's view when the sub-section is drawn.
+-Added methods to read and write the raw tile data at an index, for the Level Editor's undo and redo history.
+-Added a revision counter for the tile data, used by the World editor view.
+-Added SetTileTypeAtIndices to change a set of tiles in one batch.
+-Save writes to a temporary file that then replaces the level file. Added methods to convert a tile to and from its saved
+value, used by the Level Editor's autosave journal.
+-Added DecodeSaveData for the Level Editor's validator.
+-Added Simulate, and deferred writes for the hero damage and projectiles made by the enemies, so the World can update
+sub-sections in parallel.
+-The debug data is drawn every frame with the DebugRenderer service, removed the debug RenderTarget.
+-The tile arrays are tracked by the MemoryTracker.
 */
 
 #ifndef __GameDev2D__SubSection__
@@ -19,6 +33,8 @@ a tile.
 
 #include "../Source/Core/GameObject.h"
 #include "Tiles/Tile.h"
+#include "../Source/Graphics/Textures/TextureFrame.h"
+#include "ProjectileManager.h"
 
 
 namespace GameDev2D
@@ -37,15 +53,35 @@ namespace GameDev2D
         DebugDrawSubSectionPosition = 128
     };
 
+    //A batch of static tiles that are all drawn with the same sprite, in one draw call
+    struct TileDrawBatch
+    {
+        vector<vec2> positions;
+        vector<float> angles;
+    };
+
+    //Local constants
+    const string SUBSECTION_TEMPORARY_FILE_EXTENSION = ".tmp";
+
+    //A projectile fired by an enemy while its sub-section was updated, it is fired through the projectile manager when the writes are merged
+    struct DeferredProjectile
+    {
+        ProjectileOwner owner;
+        vec2 position;
+        vec2 direction;
+        float speed;
+        unsigned int attackDamage;
+    };
+
     //Forward declarations
     class World;
     class LevelEditor;
     class Tile;
+    class Pickup;
     class Player;
     class Enemy;
     class Label;
     class Sprite;
-    class RenderTarget;
 
     //The Subsection class manages the Tile objects and the Enemy objects that
     //reside within the SubSection. Enemies can NOT leave the SubSection
@@ -61,12 +97,37 @@ namespace GameDev2D
         //Loads a Subsection for the filename, if load fails, then an empty level will be loaded
         void Load(const string& filename);
 
-        //Saves a Subsection for the filename
+        //Saves a Subsection for the filename, the file is written to a temporary file first and then replaces
+        //the old file, so a crash during the save can't leave a partially written level
         void Save(const string& filename);
 
-        //Updates the Subsection
+        //Methods to convert the tile at an index to and from the 16-bit value it is saved as (tile type, variant and spawn point bits)
+        unsigned short GetSaveDataForIndex(unsigned int index);
+        void SetSaveDataAtIndex(unsigned int index, unsigned short saveData);
+
+        //Converts a saved 16-bit tile value to its tile type index, variant and flags, returns false if the
+        //value doesn't have a valid tile type and variant for that tile type. An animated tile saved with its animation frame as
+        //the variant (how the original FireTile was saved) is decoded as the first variant
+        static bool DecodeSaveData(unsigned short saveData, unsigned char& typeIndex, unsigned char& variant, unsigned char& flags);
+
+        //Writes the saved tile data to the filename through a temporary file, returns false if the file couldn't be written.
+        //Doesn't access the SubSection, so the Level Editor's autosave can call it from its background thread
+        static bool WriteSaveData(const string& filename, const unsigned short* saveData, unsigned int numberOfTiles);
+
+        //Updates the Subsection, if it is enabled
         void Update(double delta);
 
+        //Updates the pickups and enemies even if the Subsection isn't enabled. Only the Subsection and its enemies are written to,
+        //so different Subsections can be simulated on different threads, the writes to anything else are deferred
+        void Simulate(double delta);
+
+        //Methods to defer the writes that leave the Subsection, called by the enemies while the Subsection is simulated
+        void DeferHeroDamage(unsigned int attackDamage);
+        void DeferProjectile(ProjectileOwner owner, vec2 position, vec2 direction, float speed, unsigned int attackDamage);
+
+        //Applies the deferred writes in the order they were made, must be called on the main thread after the Subsection is simulated
+        void MergeDeferredWrites();
+
         //Draws the subsection
         void Draw();
 
@@ -84,8 +145,25 @@ namespace GameDev2D
         //Returns the Tile type of the Tile at the index
         TileType GetTileTypeForIndex(unsigned int index);
 
-        //Change the tile type at the index, returns the Tile object that was changed/created
-        Tile* SetTileTypeAtIndex(unsigned int index, TileType tileType, unsigned int variant);
+        //Change the tile type and variant at the index, changing the tile type clears the spawn points and pickup
+        void SetTileTypeAtIndex(unsigned int index, TileType tileType, unsigned int variant);
+
+        //Change the tile type and variant of every tile in the indices, the tile type is validated once and the
+        //tile batches are only marked dirty once, used by the Level Editor's bulk tools
+        void SetTileTypeAtIndices(const vector<unsigned int>& indices, TileType tileType, unsigned int variant);
+
+        //Methods to read and write the raw tile data at an index (type index, variant and flags), used by the Level Editor's
+        //edit history. Setting the data only marks the tile batches dirty if the tile actually changed
+        void GetTileDataAtIndex(unsigned int index, unsigned char& typeIndex, unsigned char& variant, unsigned char& flags);
+        void SetTileDataAtIndex(unsigned int index, unsigned char typeIndex, unsigned char variant, unsigned char flags);
+
+        //Returns the revision of the tile data, it is incremented every time a tile's type, variant or spawn points change
+        unsigned int GetRevision();
+
+        //Methods to read the tile data at an index, without having to create a Tile object
+        bool IsTileWalkableAtIndex(unsigned int index);
+        bool IsHeroSpawnPointAtIndex(unsigned int index);
+        vec2 GetTilePositionForIndex(unsigned int index);
 
         //Validates that the coordinates are on the subsection
         bool ValidateCoordinates(ivec2 coordinates);
@@ -100,7 +178,7 @@ namespace GameDev2D
         unsigned int GetTileIndexForCoordinates(uvec2 coordinates);
         unsigned int GetTileIndexForTile(Tile* tile);
 
-        //Methods to return a Tile object
+        //Methods to return a Tile object, the Tile object is created the first time it is asked for
         Tile* GetTileForIndex(unsigned int index);
         Tile* GetTileForPosition(vec2 position);
         Tile* GetTileForCoordinates(uvec2 coordinates);
@@ -108,16 +186,23 @@ namespace GameDev2D
         //Populates the enemies parameter with the active enemy objects in the SubSection
         void GetActiveEnemies(vector<Enemy*>& enemies);
 
+        //Returns the enemies standing on the Tile at the index, disabled enemies are included
+        const vector<Enemy*>& GetEnemiesForTileIndex(unsigned int index);
+
+        //Populates the enemies parameter with the active enemies within the radius of the position (relative
+        //to the subsection), only the tiles the radius overlaps are checked. The enemies vector is not cleared,
+        //reuse the same vector every frame to avoid allocating
+        void GetActiveEnemiesInRadius(vec2 position, float radius, vector<Enemy*>& enemies);
+
+        //Moves the enemy from the old tile's bucket to the new tile's bucket, called when an Enemy changes tiles
+        void EnemyChangedTiles(Enemy* enemy, Tile* newTile, Tile* oldTile);
+
         //Methods for debug drawing
         void EnableDebugDrawing(unsigned int debugDrawingFlags);
         void DisableDebugDrawing();
         unsigned int GetDebugDrawFlags();
-        void RefreshDebugDraw();
 
     protected:
-        //Create a new Tile object for tile type and variant at the coordinates passed in
-        Tile* CreateTile(TileType tileType, unsigned int variant, uvec2 coordinates);
-
         //Method to set the hero's spawn point, if another hero spawn point is already set, it will be removed
         void SetHeroSpawnPointForTile(Tile* tile);
         void SetEnemySpawnPoint(Tile* tile);
@@ -131,20 +216,70 @@ namespace GameDev2D
         //Allow level editor access to the protected memebers
         friend LevelEditor;
 
+        //Allow the Tile objects to access the tile arrays
+        friend Tile;
+
     private:
-        //Private debug drawing methods
+        //Allocates the tile arrays, called from both constructors
+        void CreateTileArrays();
+
+        //Returns the number of bytes the tile arrays use, tracked by the MemoryTracker
+        unsigned int GetTileArraysNumberOfBytes();
+
+        //Rebuilds the static tile batches and the animated tile list, called before drawing when a tile has changed
+        void RefreshTileDrawBatches();
+        unsigned int GetBaseSpriteIndexForTileIndex(unsigned int index);
+
+        //Draws the tiles of a static tile batch that overlap the camera's view, used when the sub-section is partially in view
+        void DrawVisibleTiles(unsigned int spriteIndex, vec2 viewMinimum, vec2 viewMaximum);
+
+        //Updates the source frames of the animated tiles whose frame has changed, then draws them in one batch
+        void DrawAnimatedTiles();
+
+        //Draws the enemies, each enemy is culled on its own
+        void DrawEnemies();
+
+        //Returns the shared Sprite for the sprite index, it is created the first time it is needed
+        Sprite* GetTileSprite(unsigned int spriteIndex);
+
+        //Private debug drawing methods, the debug data is drawn with the DebugRenderer
+        void DebugDraw();
         void DebugDrawTileData();
         void DebugDrawSubSectionData();
 
         //Member variables
         World* m_World;
         LevelEditor* m_LevelEditor;
-        Tile** m_Tiles;
         vector<Enemy*> m_Enemies;
+        vector<Enemy*>* m_TileEnemies;
         Sprite* m_HeroSpawnPoint;
         Sprite* m_EnemySpawnPoint;
         unsigned int m_DebugDrawingFlags;
-        RenderTarget* m_DebugRenderTarget;
+
+        //Tile data, each array has one entry per tile
+        unsigned char* m_TileTypeIndices;
+        unsigned char* m_TileVariants;
+        unsigned char* m_TileFlags;
+        Pickup** m_TilePickups;
+        Tile** m_Tiles;
+
+        //Tile drawing, one shared Sprite per tile atlas key, and one batch of static tiles per Sprite
+        Sprite** m_TileSprites;
+        vector<TileDrawBatch> m_TileDrawBatches;
+        TileDrawBatch m_VisibleTileDrawBatch;
+        bool m_AreTileDrawBatchesDirty;
+        unsigned int m_Revision;
+
+        //Writes deferred while the sub-section is simulated
+        vector<unsigned int> m_DeferredHeroDamages;
+        vector<DeferredProjectile> m_DeferredProjectiles;
+
+        //Animated tiles, the source frames are only updated when a tile's animation frame changes
+        vector<unsigned short> m_AnimatedTiles;
+        vector<unsigned int> m_AnimatedTileSpriteIndices;
+        vector<vec2> m_AnimatedTilePositions;
+        vector<float> m_AnimatedTileAngles;
+        vector<SourceFrame> m_AnimatedTileSourceFrames;
     };
 }
 
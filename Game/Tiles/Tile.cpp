@@ -9,75 +9,84 @@
 #include "Tile.h"
 #include "../SubSection.h"
 #include "../Pickups/Pickup.h"
-#include "../../Source/UI/UI.h"
 
 
 namespace GameDev2D
 {
-    Tile::Tile(const string& aTileName, SubSection* aSubSection, uvec2 aCoordinates) : GameObject(aTileName),
+    //The behaviour of every tile type, in the same order as TILES_TYPES[]
+    const TileTypeBehaviour TILE_TYPE_BEHAVIOURS[] =
+    {
+        { TileTypeGround, true, 5, 1, 0.0, GROUND_TILE_ATLAS_KEYS, 0 },
+        { TileTypeWater, false, 9, 1, 0.0, WATER_TILE_ATLAS_KEYS, 5 },
+        { TileTypeTree, false, 7, 1, 0.0, TREE_TILE_ATLAS_KEYS, 14 },
+        { TileTypeBoulder, false, 2, 1, 0.0, BOULDER_TILE_ATLAS_KEYS, 21 },
+        { TileTypeRock, false, 12, 1, 0.0, ROCK_TILE_ATLAS_KEYS, 23 },
+        { TileTypeSand, true, 1, 1, 0.0, SAND_TILE_ATLAS_KEYS, 35 },
+        { TileTypeBridge, true, 2, 1, 0.0, BRIDGE_TILE_ATLAS_KEYS, 36 },
+        { TileTypeFire, false, 1, 2, FIRE_TILE_DEFAULT_ANIMATION_FRAMERATE, FIRE_TILE_ATLAS_KEYS, 38 }
+    };
+    const unsigned int TILE_NUMBER_OF_SPRITES = 40;
+
+    //Initialize the shared animation clock
+    double Tile::s_AnimationElapsed = 0.0;
+
+
+    Tile::Tile(SubSection* aSubSection, unsigned int aIndex) :
         m_SubSection(aSubSection),
-        m_Pickup(nullptr),
-        m_IsWalkable(false),
-        m_IsHeroSpawnPoint(false),
-        m_IsEnemySpawnPoint(false),
-        m_Variant(0)
+        m_Index(aIndex)
     {
-        //Set the local position based on the coordinates that were passed in
-        SetLocalPosition((float)(aCoordinates.x * GetSize()), (float)(aCoordinates.y * GetSize()));
+
     }
-    
+
     Tile::~Tile()
     {
-    
+        m_SubSection = nullptr;
     }
 
-    void Tile::Update(double aDelta)
+    TileType Tile::GetTileType()
     {
-        //Update the tile
-        GameObject::Update(aDelta);
-        
-        //Update the pickup
-        if(m_Pickup != nullptr && m_Pickup->IsEnabled() == true)
-        {
-            m_Pickup->Update(aDelta);
-        }
-        else if(m_Pickup != nullptr && m_Pickup->IsEnabled() == false)
+        unsigned char typeIndex = m_SubSection->m_TileTypeIndices[m_Index];
+        if(typeIndex == TILE_TYPE_INDEX_UNKNOWN)
         {
-            RemovePickup();
+            return TileTypeUnknown;
         }
+        return TILES_TYPES[typeIndex];
     }
 
-    void Tile::Draw()
+    void Tile::GetAtlasKeyForVariant(unsigned int aVariant, string& aAtlasKey)
     {
-        //Draw the tile
-        GameObject::Draw();
-        
-        //Draw the pickup
-        if(m_Pickup != nullptr && m_Pickup->IsEnabled() == true)
+        //Safety check the tile type and the variant
+        TileType tileType = GetTileType();
+        if(tileType != TileTypeUnknown)
         {
-            m_Pickup->Draw();
+            const TileTypeBehaviour& behaviour = GetBehaviourForTileType(tileType);
+            if(aVariant < behaviour.variantCount)
+            {
+                aAtlasKey = behaviour.atlasKeys[aVariant * behaviour.animationFrameCount];
+            }
         }
     }
-    
+
     unsigned int Tile::GetVariantCount()
     {
-        return 2;
+        TileType tileType = GetTileType();
+        if(tileType != TileTypeUnknown)
+        {
+            return GetBehaviourForTileType(tileType).variantCount;
+        }
+        return 0;
     }
-    
+
     unsigned int Tile::GetVariant()
     {
-        return m_Variant;
+        return m_SubSection->m_TileVariants[m_Index];
     }
-    
+
     void Tile::SetVariant(unsigned int aVariant)
     {
-        //Set the variant
-        m_Variant = aVariant;
-        
-        //Update the sprite based on the variant
-        UpdateSprite(m_Variant);
+        m_SubSection->SetTileTypeAtIndex(m_Index, GetTileType(), aVariant);
     }
-    
+
     unsigned int Tile::GetSize()
     {
         if(m_SubSection != nullptr)
@@ -86,107 +95,190 @@ namespace GameDev2D
         }
         return 0;
     }
-    
+
+    vec2 Tile::GetLocalPosition()
+    {
+        return m_SubSection->GetTilePositionForIndex(m_Index);
+    }
+
+    float Tile::GetLocalX()
+    {
+        return GetLocalPosition().x;
+    }
+
+    float Tile::GetLocalY()
+    {
+        return GetLocalPosition().y;
+    }
+
+    vec2 Tile::GetWorldPosition()
+    {
+        return m_SubSection->GetWorldPosition() + GetLocalPosition();
+    }
+
+    float Tile::GetWorldX()
+    {
+        return GetWorldPosition().x;
+    }
+
+    float Tile::GetWorldY()
+    {
+        return GetWorldPosition().y;
+    }
+
     vec2 Tile::GetCenter(bool aWorldPosition)
     {
         if(aWorldPosition == true)
         {
             return vec2(GetWorldX() + (GetSize() / 2), GetWorldY() + (GetSize() / 2));
         }
-        
+
         return vec2(GetLocalX() + (GetSize() / 2), GetLocalY() + (GetSize() / 2));
     }
-    
+
+    unsigned int Tile::GetIndex()
+    {
+        return m_Index;
+    }
+
     uvec2 Tile::GetCoordinates()
     {
         if(m_SubSection != nullptr)
         {
-            return m_SubSection->GetTileCoordinatesForTile(this);
+            return m_SubSection->GetTileCoordinatesForIndex(m_Index);
         }
         return uvec2(0,0);
     }
-    
+
     SubSection* Tile::GetSubSection()
     {
         return m_SubSection;
     }
-    
+
     void Tile::AddPickup(Pickup* aPickup)
     {
-        if(m_Pickup == nullptr)
+        if(m_SubSection->m_TilePickups[m_Index] == nullptr)
         {
-            m_Pickup = aPickup;
-            m_Pickup->SetLocalPosition(GetCenter(true));
-            m_Pickup->SetTile(this);
+            m_SubSection->m_TilePickups[m_Index] = aPickup;
+            aPickup->SetLocalPosition(GetCenter(true));
+            aPickup->SetTile(this);
         }
         else
         {
             SafeDelete(aPickup);
         }
     }
-    
+
     void Tile::RemovePickup()
     {
-        if(m_Pickup != nullptr)
+        if(m_SubSection->m_TilePickups[m_Index] != nullptr)
         {
-            SafeDelete(m_Pickup);
+            SafeDelete(m_SubSection->m_TilePickups[m_Index]);
         }
     }
-    
+
     Pickup* Tile::GetPickup()
     {
-        return m_Pickup;
+        return m_SubSection->m_TilePickups[m_Index];
     }
-    
+
     bool Tile::IsWalkable()
     {
-        return m_IsWalkable;
+        return (m_SubSection->m_TileFlags[m_Index] & TileFlagWalkable) != 0;
     }
 
     void Tile::SetIsWalkable(bool aIsWalkable)
     {
-        m_IsWalkable = aIsWalkable;
+        if(aIsWalkable == true)
+        {
+            m_SubSection->m_TileFlags[m_Index] |= TileFlagWalkable;
+        }
+        else
+        {
+            m_SubSection->m_TileFlags[m_Index] &= ~TileFlagWalkable;
+        }
     }
 
     bool Tile::IsHeroSpawnPoint()
     {
-        return m_IsHeroSpawnPoint;
+        return (m_SubSection->m_TileFlags[m_Index] & TileFlagHeroSpawnPoint) != 0;
     }
-    
+
     void Tile::SetIsHeroSpawnPoint(bool aIsHeroSpawnPoint)
     {
-        m_IsHeroSpawnPoint = aIsHeroSpawnPoint;
+        if(aIsHeroSpawnPoint == true)
+        {
+            m_SubSection->m_TileFlags[m_Index] |= TileFlagHeroSpawnPoint;
+        }
+        else
+        {
+            m_SubSection->m_TileFlags[m_Index] &= ~TileFlagHeroSpawnPoint;
+        }
     }
 
     bool Tile::IsEnemySpawnPoint()
     {
-        return m_IsEnemySpawnPoint;
+        return (m_SubSection->m_TileFlags[m_Index] & TileFlagEnemySpawnPoint) != 0;
     }
-    
+
     void Tile::SetIsEnemySpawnPoint(bool aIsEnemySpawnPoint)
     {
-        m_IsEnemySpawnPoint = aIsEnemySpawnPoint;
+        if(aIsEnemySpawnPoint == true)
+        {
+            m_SubSection->m_TileFlags[m_Index] |= TileFlagEnemySpawnPoint;
+        }
+        else
+        {
+            m_SubSection->m_TileFlags[m_Index] &= ~TileFlagEnemySpawnPoint;
+        }
+    }
+
+    const TileTypeBehaviour& Tile::GetBehaviourForTileType(TileType aTileType)
+    {
+        //If this assert is hit, the tile type isn't in TILES_TYPES[]
+        unsigned char index = GetIndexForTileType(aTileType);
+        assert(index != TILE_TYPE_INDEX_UNKNOWN);
+
+        return TILE_TYPE_BEHAVIOURS[index];
     }
-    
-    void Tile::UpdateSprite(unsigned int aVariant)
+
+    unsigned char Tile::GetIndexForTileType(TileType aTileType)
     {
-        //Safety check the variant index
-        if(aVariant > GetVariantCount())
+        for(unsigned char i = 0; i < TileTypeCount; i++)
         {
-            return;
+            if(TILES_TYPES[i] == aTileType)
+            {
+                return i;
+            }
         }
-    
-        //Cycle through and remove all the children from the tile
-        for (unsigned int i = 0; i < GetNumberOfChildren(); i++)
+        return TILE_TYPE_INDEX_UNKNOWN;
+    }
+
+    unsigned int Tile::GetNumberOfTileSprites()
+    {
+        return TILE_NUMBER_OF_SPRITES;
+    }
+
+    void Tile::UpdateAnimationClock(double aDelta)
+    {
+        s_AnimationElapsed += aDelta;
+    }
+
+    void Tile::ResetAnimationClock()
+    {
+        s_AnimationElapsed = 0.0;
+    }
+
+    unsigned int Tile::GetAnimationFrameForTileType(TileType aTileType)
+    {
+        //Static tile types only have the one frame
+        const TileTypeBehaviour& behaviour = GetBehaviourForTileType(aTileType);
+        if(behaviour.animationFrameCount <= 1)
         {
-            RemoveChild(GetChildAtIndex(i));
+            return 0;
         }
-        
-        //Get the atlas key for the sprite
-        string atlasKey;
-        GetAtlasKeyForVariant(aVariant, atlasKey);
 
-        //Add the Sprite object as a child
-        AddChild(new Sprite("MainAtlas", atlasKey), true);
+        //Every tile of the tile type shows the same frame, based on the shared clock
+        return (unsigned int)(s_AnimationElapsed / behaviour.animationFrameDuration) % behaviour.animationFrameCount;
     }
 }
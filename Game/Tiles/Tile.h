@@ -11,12 +11,17 @@ ChangeLog
 _______________________________________________
 -Made a variable TileTypeCount, type enum TileType, to account for my special number of tiles, 7.
 - Made a const TileType TILES_TYPES[], to account for all the 7 different tile types in the game.
+-The tile data now lives in flat arrays in the SubSection. The Tile sub-classes were replaced by the TileTypeBehaviour
+table below, and a Tile is now a small handle to its SubSection's data, only created when gameplay code asks for one.
+-Added a shared animation clock, every animated tile in every SubSection shows the frame the clock is on.
+-The Tile objects are tracked by the MemoryTracker, under the Tiles memory tag.
 */
 
 #ifndef __GameDev2D__Tile__
 #define __GameDev2D__Tile__
 
 #include "../../Source/Core/GameObject.h"
+#include "../../Source/Core/MemoryTracker.h"
 
 
 namespace GameDev2D
@@ -76,31 +81,66 @@ namespace GameDev2D
 	//const TileType TILES_TYPES[] = {TileTypeGround, TileTypeWater, TileTypeTree, TileTypeBoulder, TileTypeRock};
 //    const TileType TILES_TYPES[] = {TileTypeGround, TileTypeWater, TileTypeTree, TileTypeBoulder, TileTypeRock, TileTypeSand, TileTypeBridge, TileTypeDoor, TileTypeStairs, TileTypeFire};
 
+	//Atlas keys for each tile type, animated tile types have every animation frame of a variant next to each other
+	const string GROUND_TILE_ATLAS_KEYS[] = { "Ground", "WaterEdge-9", "WaterEdge-10", "WaterEdge-11", "WaterEdge-12" };
+	const string WATER_TILE_ATLAS_KEYS[] = { "Water", "WaterEdge-1", "WaterEdge-2", "WaterEdge-3", "WaterEdge-4", "WaterEdge-5", "WaterEdge-6", "WaterEdge-7", "WaterEdge-8" };
+	const string TREE_TILE_ATLAS_KEYS[] = { "Tree-Light", "Tree-Dark", "EvilTree-1", "EvilTree-2", "EvilTree-3", "EvilTree-4", "EvilTree-5" };
+	const string BOULDER_TILE_ATLAS_KEYS[] = { "Boulder-Light", "Boulder-Dark" };
+	const string ROCK_TILE_ATLAS_KEYS[] = { "Rock-1", "Rock-2", "Rock-3", "Rock-4", "Rock-5", "Rock-6", "RedRock-1", "RedRock-2", "RedRock-3", "RedRock-4", "RedRock-5", "RedRock-6" };
+	const string SAND_TILE_ATLAS_KEYS[] = { "Sand" };
+	const string BRIDGE_TILE_ATLAS_KEYS[] = { "Bridge-1", "Bridge-2" };
+	const string FIRE_TILE_ATLAS_KEYS[] = { "Fire-1", "Fire-2" };
+	const double FIRE_TILE_DEFAULT_ANIMATION_FRAMERATE = 0.3;
+
+	//Index used in the SubSection's tile arrays for a tile that hasn't been set yet
+	const unsigned char TILE_TYPE_INDEX_UNKNOWN = 0xFF;
+
+	//Flags stored for every tile in the SubSection
+	enum TileFlags
+	{
+		TileFlagNone = 0,
+		TileFlagWalkable = 1,
+		TileFlagHeroSpawnPoint = 2,
+		TileFlagEnemySpawnPoint = 4
+	};
+
+	//The behaviour shared by every tile of a type, there is one for each entry in TILES_TYPES[]. The atlas key for a
+	//variant's animation frame is atlasKeys[variant * animationFrameCount + frame], spriteIndex is the index of the
+	//type's first atlas key when all the types' atlas keys are laid out one after another
+	struct TileTypeBehaviour
+	{
+		TileType tileType;
+		bool isWalkable;
+		unsigned int variantCount;
+		unsigned int animationFrameCount;
+		double animationFrameDuration;
+		const string* atlasKeys;
+		unsigned int spriteIndex;
+	};
+
 	//Forward Declarations
 	class SubSection;
 	class Pickup;
 
-	//The Tile class is the base class for all the Tile types in the game, it is an abstract class and must be inherited from.
+	//A Tile is a handle to one tile of a SubSection, the tile's data is stored in the SubSection's tile arrays and
+	//the behaviour shared by the tile type comes from the TileTypeBehaviour table. Tile objects are only created
+	//when they are asked for (GetTileForIndex() and friends), the SubSection draws and updates its tiles without them.
 	//It provides a lot of functionality for determining what type of tile it is, to easily calculating the center position
 	//of the tile, managing tile variants and pickups. Keeps track of if its a 'walkable' tile OR not.
-	class Tile : public GameObject
+	class Tile : public MemoryTracked<MemoryTag_Tiles>
 	{
 	public:
-		Tile(const string& tileName, SubSection* subSection, uvec2 coordinates);
-		virtual ~Tile();
-
-		//Pure virtual method, MUST be overridden in inheriting classes, should return the type of tile (from the enum above)
-		virtual TileType GetTileType() = 0;
+		Tile(SubSection* subSection, unsigned int index);
+		~Tile();
 
-		//Pure virtual method, MUST be overridden in inheriting classes. Sets the atlas key (passed by reference) for the tile variant parameter
-		virtual void GetAtlasKeyForVariant(unsigned int variant, string& atlasKey) = 0;
+		//Returns the type of tile (from the enum above)
+		TileType GetTileType();
 
-		//Updates and Draws the tile
-		void Update(double delta);
-		void Draw();
+		//Sets the atlas key (passed by reference) for the tile variant parameter
+		void GetAtlasKeyForVariant(unsigned int variant, string& atlasKey);
 
-		//Returns how many variants are available for the Tile, by default its 1, can be overridden in inheriting classes
-		virtual unsigned int GetVariantCount();
+		//Returns how many variants are available for the Tile
+		unsigned int GetVariantCount();
 
 		//Returns the tile variant
 		unsigned int GetVariant();
@@ -111,10 +151,19 @@ namespace GameDev2D
 		//Returns the size of the tile
 		unsigned int GetSize();
 
+		//Returns the position of the tile's bottom left corner, either in local space (to the subsection) or world space
+		vec2 GetLocalPosition();
+		float GetLocalX();
+		float GetLocalY();
+		vec2 GetWorldPosition();
+		float GetWorldX();
+		float GetWorldY();
+
 		//Returns the center position of the tile, either in local space (to the subsection) or world space
 		vec2 GetCenter(bool worldPosition);
 
-		//Returns the coordinates of the tile
+		//Returns the index and coordinates of the tile
+		unsigned int GetIndex();
 		uvec2 GetCoordinates();
 
 		//Returns the subsection the Tile is part of
@@ -147,17 +196,31 @@ namespace GameDev2D
 		//Sets wether the tile is an enemy spawn point
 		void SetIsEnemySpawnPoint(bool isEnemySpawnPoint);
 
-	protected:
-		//Conveniance method to update the sprite, based on the variant parameter, can be overridden
-		virtual void UpdateSprite(unsigned int variant);
+		//Returns the behaviour for a tile type, the tile type must be in TILES_TYPES[]
+		static const TileTypeBehaviour& GetBehaviourForTileType(TileType tileType);
+
+		//Returns the index of the tile type in TILES_TYPES[], returns TILE_TYPE_INDEX_UNKNOWN if it isn't in it
+		static unsigned char GetIndexForTileType(TileType tileType);
+
+		//Returns the total number of atlas keys for all the tile types
+		static unsigned int GetNumberOfTileSprites();
+
+		//Advances the shared tile animation clock, called once per frame by the Scene that draws the tiles
+		static void UpdateAnimationClock(double delta);
 
+		//Resets the shared tile animation clock, every animated tile goes back to its first frame
+		static void ResetAnimationClock();
+
+		//Returns the animation frame that every tile of the tile type is showing, always 0 for static tile types
+		static unsigned int GetAnimationFrameForTileType(TileType tileType);
+
+	private:
 		//Member variables
 		SubSection* m_SubSection;
-		Pickup* m_Pickup;
-		bool m_IsWalkable;
-		bool m_IsHeroSpawnPoint;
-		bool m_IsEnemySpawnPoint;
-		unsigned int m_Variant;
+		unsigned int m_Index;
+
+		//Static member variables
+		static double s_AnimationElapsed;
 	};
 }
 
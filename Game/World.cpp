@@ -14,14 +14,21 @@ the ""SaveData" path, so that it reads the files directly from our desired folde
 MODIFYING THE PROJECT PROERTIES, WORKING DIRECTORY TO BE THE ROOT OF THE PROJECT "../../../"
 -Added background looping music
 -Made stop music function
+-Added the projectile manager, it updates, collides and draws every projectile in the world
+-The World advances the shared tile animation clock, so the active and transition sub-sections animate in sync
+-The sub-sections are updated in parallel on the job system, their deferred writes are merged in sub-section order
+afterwards. Added a seed for the enemies and the option to keep simulating the sub-sections that are off screen
+-Set a frame allocation budget for the path nodes, so pathfinding that allocates too many path nodes a frame is reported
 */
 
 #include "World.h"
 #include "SubSection.h"
+#include "ProjectileManager.h"
 #include "Game.h"
 #include "Player/Hero.h"
 #include "../Source/Services/ServiceLocator.h"
 #include "../Source/Platforms/PlatformLayer.h"
+#include "../Source/Core/MemoryTracker.h"
 #include "../Source/Graphics/Core/Camera.h"
 #include "../Source/Audio/Audio.h"
 #include "../Source/Events/Event.h"
@@ -34,15 +41,25 @@ namespace GameDev2D
         m_SubSections(nullptr),
         m_ActiveSubSection(nullptr),
         m_TransitionSubSection(nullptr),
+        m_ProjectileManager(nullptr),
+        m_UpdatingDelta(0.0),
+        m_HeroTile(nullptr),
+        m_Seed((unsigned int)time(NULL)),
+        m_IsParallelUpdateEnabled(true),
+        m_SimulatesAllSubSections(false),
         m_OverworldTheme(nullptr),
         m_LoadStep(0),
         m_LoadSubSectionIndex(0)
     {
-
+        //Set the path node budget, the enemies' pathfinding allocates a path node for each tile it searches
+        MemoryTracker::SetFrameAllocationBudget(MemoryTag_PathNodes, WORLD_PATH_NODE_FRAME_ALLOCATION_BUDGET);
     }
 
     World::~World()
     {
+        //Remove the path node budget
+        MemoryTracker::SetFrameAllocationBudget(MemoryTag_PathNodes, 0);
+
         //Safety check the subsections pointer
         if (m_SubSections != nullptr)
         {
@@ -59,6 +76,9 @@ namespace GameDev2D
         //Delete the hero object
         SafeDelete(m_Hero);
 
+        //Delete the projectile manager
+        SafeDelete(m_ProjectileManager);
+
         //Delete the overworld music
         SafeDelete(m_OverworldTheme);
     }
@@ -75,6 +95,9 @@ namespace GameDev2D
         {
             //Create the subsections array
             m_SubSections = new SubSection*[GetNumberOfSubSections()];
+
+            //Create the projectile manager
+            m_ProjectileManager = new ProjectileManager(this);
         }
         break;
 
@@ -117,7 +140,7 @@ namespace GameDev2D
                 for (unsigned int j = 0; j < GetNumberOfTiles(); j++)
                 {
                     //If a spawn point was found, break out of the inner for loop
-                    if (m_SubSections[i]->GetTileForIndex(j)->IsHeroSpawnPoint() == true)
+                    if (m_SubSections[i]->IsHeroSpawnPointAtIndex(j) == true)
                     {
                         spawnPointFound = true;
                         subSectionIndex = i;
@@ -183,16 +206,53 @@ namespace GameDev2D
 
     void World::Update(double aDelta)
     {
-        //Safety check the active sub-section and update it
-        if (m_ActiveSubSection != nullptr)
+        //Advance the shared tile animation clock, once per frame for all the sub-sections
+        Tile::UpdateAnimationClock(aDelta);
+
+        //Cache the hero's tile, the enemies read it while the sub-sections are updated
+        m_HeroTile = m_Hero != nullptr ? m_Hero->GetTile() : nullptr;
+
+        //Gather the enabled sub-sections to update, always in the same order
+        m_UpdatingSubSections.clear();
+        if (m_SimulatesAllSubSections == true && m_SubSections != nullptr)
         {
-            m_ActiveSubSection->Update(aDelta);
+            for (unsigned int i = 0; i < GetNumberOfSubSections(); i++)
+            {
+                if (m_SubSections[i] != nullptr)
+                {
+                    m_UpdatingSubSections.push_back(m_SubSections[i]);
+                }
+            }
+        }
+        else
+        {
+            //Safety check the active and transition sub-sections
+            if (m_ActiveSubSection != nullptr && m_ActiveSubSection->IsEnabled() == true)
+            {
+                m_UpdatingSubSections.push_back(m_ActiveSubSection);
+            }
+            if (m_TransitionSubSection != nullptr && m_TransitionSubSection != m_ActiveSubSection && m_TransitionSubSection->IsEnabled() == true)
+            {
+                m_UpdatingSubSections.push_back(m_TransitionSubSection);
+            }
         }
 
-        //Safety check the transition sub-section and update it
-        if (m_TransitionSubSection != nullptr)
+        //Update the sub-sections, they only write to themselves so they can be updated in any order
+        m_UpdatingDelta = aDelta;
+        if (m_IsParallelUpdateEnabled == true)
+        {
+            //One sub-section per job, the enemies' path finding is the expensive part
+            ServiceLocator::GetJobSystem()->ParallelFor((unsigned int)m_UpdatingSubSections.size(), &World::SimulateSubSections, this, 1);
+        }
+        else
         {
-            m_TransitionSubSection->Update(aDelta);
+            SimulateSubSections(this, 0, (unsigned int)m_UpdatingSubSections.size());
+        }
+
+        //Merge the writes the enemies made to the hero and the projectile manager, in the order the sub-sections were gathered
+        for (unsigned int i = 0; i < m_UpdatingSubSections.size(); i++)
+        {
+            m_UpdatingSubSections.at(i)->MergeDeferredWrites();
         }
 
         //Safety check the hero
@@ -235,6 +295,12 @@ namespace GameDev2D
             }
         }
 
+        //Update the projectiles, after the hero and enemies have moved
+        if (m_ProjectileManager != nullptr)
+        {
+            m_ProjectileManager->Update(aDelta);
+        }
+
         //Update the Scene's GameObjects
         Scene::Update(aDelta);
 
@@ -254,6 +320,12 @@ namespace GameDev2D
             m_TransitionSubSection->Draw();
         }
 
+        //Safety check and draw the projectiles
+        if (m_ProjectileManager != nullptr)
+        {
+            m_ProjectileManager->Draw();
+        }
+
         //Safety check and draw the hero
         if (m_Hero != nullptr && m_Hero->IsEnabled() == true)
         {
@@ -264,11 +336,50 @@ namespace GameDev2D
         Scene::Draw();
     }
 
+    void World::SimulateSubSections(void* aWorld, unsigned int aStartIndex, unsigned int aEndIndex)
+    {
+        World* world = (World*)aWorld;
+        for (unsigned int i = aStartIndex; i < aEndIndex; i++)
+        {
+            world->m_UpdatingSubSections.at(i)->Simulate(world->m_UpdatingDelta);
+        }
+    }
+
     Hero* World::GetHero()
     {
         return m_Hero;
     }
 
+    ProjectileManager* World::GetProjectileManager()
+    {
+        return m_ProjectileManager;
+    }
+
+    Tile* World::GetHeroTile()
+    {
+        return m_HeroTile;
+    }
+
+    void World::SetSeed(unsigned int aSeed)
+    {
+        m_Seed = aSeed;
+    }
+
+    unsigned int World::GetSeed()
+    {
+        return m_Seed;
+    }
+
+    void World::SetIsParallelUpdateEnabled(bool aIsParallelUpdateEnabled)
+    {
+        m_IsParallelUpdateEnabled = aIsParallelUpdateEnabled;
+    }
+
+    void World::SetSimulatesAllSubSections(bool aSimulatesAllSubSections)
+    {
+        m_SimulatesAllSubSections = aSimulatesAllSubSections;
+    }
+
     SubSection* World::GetActiveSubSection()
     {
         return m_ActiveSubSection;
@@ -33,6 +33,7 @@ namespace GameDev2D
     const unsigned int WORLD_NUMBER_OF_HORIZONTAL_TILES = 16;
     const unsigned int WORLD_NUMBER_OF_VERTICAL_TILES = 11;
     const double WORLD_CAMERA_SHIFT_DURATION = 1.0;
+    const unsigned int WORLD_PATH_NODE_FRAME_ALLOCATION_BUDGET = 1024;//About six searches of an entire sub-section a frame
 
     const float WORLD_OVERWORLD_THEME_SOUND = 0.6f;//Reduce the sound slightly, since it affects the gameplay sound effects.
 
@@ -41,6 +42,8 @@ namespace GameDev2D
     class Hero;
     class Pickup;
     class SubSection;
+    class ProjectileManager;
+    class Tile;
     class Audio;
 
     //The world class manages the Subsections, camera and Hero in the world
@@ -61,6 +64,26 @@ namespace GameDev2D
         //Returns the hero object
         Hero* GetHero();
 
+        //Returns the projectile manager, every projectile in the world is fired through it
+        ProjectileManager* GetProjectileManager();
+
+        //Returns the tile the hero was on at the start of the update, the enemies read it while
+        //the sub-sections are updated in parallel, since the hero isn't updated until they are done
+        Tile* GetHeroTile();
+
+        //Sets the world's seed, the enemies' random number generators are seeded from it and their spawn tile so the
+        //world plays out the same with the same seed, whether the sub-sections are updated in parallel or not.
+        //Must be set before the world is loaded, by default it is based on the time
+        void SetSeed(unsigned int seed);
+        unsigned int GetSeed();
+
+        //Sets whether the sub-sections are updated in parallel on the job system, by default they are
+        void SetIsParallelUpdateEnabled(bool isParallelUpdateEnabled);
+
+        //Sets whether every sub-section is updated, or only the active and transition sub-sections, by default only the
+        //active and transition sub-sections are updated
+        void SetSimulatesAllSubSections(bool simulatesAllSubSections);
+
         //Returns the active subsection in the world
         SubSection* GetActiveSubSection();
 
@@ -116,11 +139,21 @@ namespace GameDev2D
         //Delayed method to enable the hero
         void EnableHero();
 
+        //The job system's parallel-for function, simulates a batch of the sub-sections being updated
+        static void SimulateSubSections(void* world, unsigned int startIndex, unsigned int endIndex);
+
         //Member variables
         Hero* m_Hero;
         SubSection** m_SubSections;
         SubSection* m_ActiveSubSection;
         SubSection* m_TransitionSubSection;
+        ProjectileManager* m_ProjectileManager;
+        vector<SubSection*> m_UpdatingSubSections;
+        double m_UpdatingDelta;
+        Tile* m_HeroTile;
+        unsigned int m_Seed;
+        bool m_IsParallelUpdateEnabled;
+        bool m_SimulatesAllSubSections;
 
         Audio* m_OverworldTheme;
 
@@ -45,9 +45,6 @@ namespace GameDev2D
         //Safety check the sound object
         if(m_Sound != nullptr)
         {
-            //Register the audio object with the audio manager
-            ServiceLocator::GetAudioManager()->RegisterAudio(this);
-        
             //Get the length and default properties of the audio file
             m_Sound->getLength(&m_Length, FMOD_TIMEUNIT_MS);
             m_Sound->getDefaults(&m_Frequency, &m_Volume, &m_Pan, &m_Priority);
@@ -74,8 +71,11 @@ namespace GameDev2D
     
     Audio::~Audio()
     {
-        //Unregister the audio object from the audio manager
-        ServiceLocator::GetAudioManager()->UnregisterAudio(this);
+        //Unregister the audio object from the audio manager, it is only registered while a delay or tween is running
+        if(ServiceLocator::GetAudioManager()->ContainsAudio(this) == true)
+        {
+            ServiceLocator::GetAudioManager()->UnregisterAudio(this);
+        }
     
         //Safety check, then unload the sound
         if(m_Sound != nullptr)
@@ -101,6 +101,12 @@ namespace GameDev2D
         UpdateDelay(aDelta, &m_DelayStop, &Audio::Stop);
     }
     
+    bool Audio::IsUpdating()
+    {
+        return m_TweenFrequency.IsRunning() == true || m_TweenVolume.IsRunning() == true || m_TweenPan.IsRunning() == true ||
+               m_DelayPlay.IsRunning() == true || m_DelayPause.IsRunning() == true || m_DelayStop.IsRunning() == true;
+    }
+    
     void Audio::UpdateTween(double aDelta, Tween* aTween, AudioTweenSetMethod aTweenSetMethod)
     {
         //Safety check the Tween and make sure it is running
@@ -190,6 +196,9 @@ namespace GameDev2D
             //Setup the delay
             m_DelayPlay.SetDuration(aDelay);
             m_DelayPlay.Reset(true);
+            
+            //Register with the audio manager, so that the delay is updated
+            ServiceLocator::GetAudioManager()->RegisterAudio(this);
         }
     }
     
@@ -213,6 +222,9 @@ namespace GameDev2D
             //Setup the delay
             m_DelayPause.SetDuration(aDelay);
             m_DelayPause.Reset(true);
+            
+            //Register with the audio manager, so that the delay is updated
+            ServiceLocator::GetAudioManager()->RegisterAudio(this);
         }
     }
     
@@ -236,6 +248,9 @@ namespace GameDev2D
             //Setup the delay
             m_DelayStop.SetDuration(aDelay);
             m_DelayStop.Reset(true);
+            
+            //Register with the audio manager, so that the delay is updated
+            ServiceLocator::GetAudioManager()->RegisterAudio(this);
         }
     }
     
@@ -273,6 +288,9 @@ namespace GameDev2D
         {
             //Setup the frequency tween
             m_TweenFrequency.Set(m_Frequency, fmaxf(aFrequency, 0.0f), aDuration, aEasingFunction, aReverse, aRepeatCount);
+            
+            //Register with the audio manager, so that the tween is updated
+            ServiceLocator::GetAudioManager()->RegisterAudio(this);
         }
     }
     
@@ -301,6 +319,9 @@ namespace GameDev2D
         {
             //Setup the volume tween
             m_TweenVolume.Set(m_Volume, fminf(fmaxf(aVolume, 0.0f), 1.0f), aDuration, aEasingFunction, aReverse, aRepeatCount);
+            
+            //Register with the audio manager, so that the tween is updated
+            ServiceLocator::GetAudioManager()->RegisterAudio(this);
         }
     }
     
@@ -329,6 +350,9 @@ namespace GameDev2D
         {
             //Setup the pan tween
             m_TweenPan.Set(m_Pan, fminf(fmaxf(aPan, -1.0f), 1.0f), aDuration, aEasingFunction, aReverse, aRepeatCount);
+            
+            //Register with the audio manager, so that the tween is updated
+            ServiceLocator::GetAudioManager()->RegisterAudio(this);
         }
     }
     
@@ -11,6 +11,7 @@
 
 #include "FrameworkConfig.h"
 #include "../Core/BaseObject.h"
+#include "../Core/MemoryTracker.h"
 #include "../Events/EventDispatcher.h"
 #include "../Animation/Tween.h"
 #include "../Animation/Timer.h"
@@ -27,7 +28,7 @@ namespace GameDev2D
     // AUDIO_PLAYBACK_FINISHED_EVENT
     // AUDIO_CHANNEL_INVALIDATED_EVENT
     //The EventData* contains a pointer to the Audio* that disptached the events
-    class Audio : public BaseObject, public EventDispatcher
+    class Audio : public BaseObject, public EventDispatcher, public MemoryTracked<MemoryTag_Audio>
     {
     public:
         //Constructor for the Audio class, many extensions are supported, use 'streamed' for longer files such as background music.
@@ -92,6 +93,9 @@ namespace GameDev2D
         //Called by the AudioManager to ensure the Delays and Tweens are updated properly
         void Update(double delta);
         
+        //Returns wether there is a delay or tween running, the AudioManager only updates the Audio object while there is
+        bool IsUpdating();
+        
         //Function pointer and conveniance method for tweens
         typedef void (Audio::*AudioTweenSetMethod)(float value, double duration, EasingFunction easingFunction, bool reverse, int repeatCount);
         void UpdateTween(double delta, Tween* tween, AudioTweenSetMethod tweenSetMethod);
@@ -170,6 +170,11 @@ namespace GameDev2D
             //Cache the profiling start time
 	        QueryPerformanceCounter(&largeInt);
             m_ProfileStart = (unsigned long long)(largeInt.QuadPart / performanceCounterFrequency);
+            #elif __linux__
+            //Cache the profiling start time, in nanoseconds
+            timespec time;
+            clock_gettime(CLOCK_MONOTONIC, &time);
+            m_ProfileStart = (unsigned long long)time.tv_sec * 1000000000 + time.tv_nsec;
             #endif
         }
     
@@ -201,6 +206,14 @@ namespace GameDev2D
 
             //determine the entire duration
             duration = (((double)(profileEnd - m_ProfileStart)) / 1000.0);
+            #elif __linux__
+            //Get the end time of the profile
+            timespec time;
+            clock_gettime(CLOCK_MONOTONIC, &time);
+            unsigned long long profileEnd = (unsigned long long)time.tv_sec * 1000000000 + time.tv_nsec;
+
+            //determine the entire duration
+            duration = (((double)(profileEnd - m_ProfileStart)) / 1000000000.0);
             #endif
 
             //Log the profile results
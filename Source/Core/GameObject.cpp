@@ -7,11 +7,15 @@
 //
 
 #include "GameObject.h"
+#include "../Services/ServiceLocator.h"
 
 
 
 namespace GameDev2D
 {
+    unsigned int GameObject::s_FixedUpdate = 0;
+    float GameObject::s_RenderInterpolation = 1.0f;
+
     GameObject::GameObject(const string& type) : BaseObject(type),
         m_ModelMatrix(mat4(1.0f)),
         m_Position(0.0f, 0.0f),
@@ -22,6 +26,15 @@ namespace GameDev2D
         m_IsEnabled(true),
         m_ResetModelMatrix(false),
         m_ForceUpdate(false),
+        m_PreviousPosition(0.0f, 0.0f),
+        m_PreviousScale(1.0f, 1.0f),
+        m_PreviousAngle(0.0f),
+        m_PreviousTransformUpdate(s_FixedUpdate - 1),
+        m_CreatedFixedUpdate(s_FixedUpdate),
+        m_IsModelMatrixInterpolated(false),
+        m_BoundsMinimum(0.0f, 0.0f),
+        m_BoundsMaximum(0.0f, 0.0f),
+        m_HasBounds(false),
         m_TweenLocalX(),
         m_TweenLocalY(),
         m_TweenAngle(),
@@ -229,6 +242,7 @@ namespace GameDev2D
         {
             if(aDuration == 0.0)
             {
+                StorePreviousTransform();
                 m_Position.x = aX;
                 ModelMatrixIsDirty();
             }
@@ -248,6 +262,7 @@ namespace GameDev2D
         {
             if(aDuration == 0.0)
             {
+                StorePreviousTransform();
                 m_Position.y = aY;
                 ModelMatrixIsDirty();
             }
@@ -312,6 +327,7 @@ namespace GameDev2D
         {
             if(aDuration == 0.0)
             {
+                StorePreviousTransform();
                 m_Angle = aAngle;
                 ModelMatrixIsDirty();
             }
@@ -345,6 +361,7 @@ namespace GameDev2D
         {
             if(aDuration == 0.0)
             {
+                StorePreviousTransform();
                 m_Scale.x = aScaleX;
                 ModelMatrixIsDirty();
             }
@@ -364,6 +381,7 @@ namespace GameDev2D
         {
             if(aDuration == 0.0)
             {
+                StorePreviousTransform();
                 m_Scale.y = aScaleY;
                 ModelMatrixIsDirty();
             }
@@ -401,6 +419,51 @@ namespace GameDev2D
         }
         return m_Scale;
     }
+    
+    vec2 GameObject::GetRenderPosition()
+    {
+        vec2 position = IsTransformInterpolated() == true ? mix(m_PreviousPosition, m_Position, s_RenderInterpolation) : GetLocalPosition();
+        if(m_Parent != nullptr)
+        {
+            return m_Parent->GetRenderPosition() + position;
+        }
+        return position;
+    }
+    
+    float GameObject::GetRenderAngle()
+    {
+        float angle = IsTransformInterpolated() == true ? mix(m_PreviousAngle, m_Angle, s_RenderInterpolation) : GetLocalAngle();
+        if(m_Parent != nullptr)
+        {
+            return m_Parent->GetRenderAngle() + angle;
+        }
+        return angle;
+    }
+    
+    vec2 GameObject::GetRenderScale()
+    {
+        vec2 scale = IsTransformInterpolated() == true ? mix(m_PreviousScale, m_Scale, s_RenderInterpolation) : GetLocalScale();
+        if(m_Parent != nullptr)
+        {
+            return m_Parent->GetRenderScale() * scale;
+        }
+        return scale;
+    }
+    
+    void GameObject::StartFixedUpdate()
+    {
+        s_FixedUpdate++;
+    }
+    
+    void GameObject::SetRenderInterpolation(float aInterpolation)
+    {
+        s_RenderInterpolation = aInterpolation;
+    }
+    
+    float GameObject::GetRenderInterpolation()
+    {
+        return s_RenderInterpolation;
+    }
 
     void GameObject::SetIsEnabled(bool aIsEnabled)
     {
@@ -437,6 +500,24 @@ namespace GameDev2D
         sort(m_Children.begin(), m_Children.end(), Child());
     }
     
+    void GameObject::StorePreviousTransform()
+    {
+        //Only the transform from before the first change in a fixed update is kept, a GameObject
+        //created in the fixed update doesn't have a previous transform to interpolate from
+        if(m_PreviousTransformUpdate != s_FixedUpdate && m_CreatedFixedUpdate != s_FixedUpdate)
+        {
+            m_PreviousPosition = m_Position;
+            m_PreviousScale = m_Scale;
+            m_PreviousAngle = m_Angle;
+            m_PreviousTransformUpdate = s_FixedUpdate;
+        }
+    }
+    
+    bool GameObject::IsTransformInterpolated()
+    {
+        return m_PreviousTransformUpdate == s_FixedUpdate && s_RenderInterpolation < 1.0f;
+    }
+    
     void GameObject::UpdateTween(double aDelta, Tween* aTween, TweenSetMethod aTweenSetMethod)
     {
         //Safety check the Tween and make sure it is running
@@ -481,6 +562,7 @@ namespace GameDev2D
         }
     
         m_ResetModelMatrix = false;
+        m_IsModelMatrixInterpolated = IsTransformInterpolated();
     }
     
     void GameObject::ModelMatrixIsDirty(bool aResetImmediately)
@@ -505,12 +587,71 @@ namespace GameDev2D
         
         if(isDirty == false)
         {
-            isDirty = m_ResetModelMatrix;
+            //An interpolated model matrix is reset every frame, and once more after the interpolation ends
+            isDirty = m_ResetModelMatrix || m_IsModelMatrixInterpolated || IsTransformInterpolated();
         }
         
         return isDirty;
     }
     
+    bool GameObject::IsInView()
+    {
+        //A GameObject without bounds can't be culled
+        if(m_HasBounds == false)
+        {
+            return true;
+        }
+        
+        //Test the bounds against the active camera's view and count the result
+        Graphics* graphics = ServiceLocator::GetGraphics();
+        if(graphics->IsInView(m_BoundsMinimum, m_BoundsMaximum) == true)
+        {
+            graphics->AddDrawnObjects(1);
+            return true;
+        }
+        
+        graphics->AddCulledObjects(1);
+        return false;
+    }
+    
+    bool GameObject::HasBounds()
+    {
+        return m_HasBounds;
+    }
+    
+    vec2 GameObject::GetBoundsMinimum()
+    {
+        return m_BoundsMinimum;
+    }
+    
+    vec2 GameObject::GetBoundsMaximum()
+    {
+        return m_BoundsMaximum;
+    }
+    
+    void GameObject::ResetBounds(vec2 aLocalMinimum, vec2 aLocalMaximum)
+    {
+        //Transform the four corners of the local bounding box, the world bounds are the bounding box of the corners
+        const vec4 corners[4] = { vec4(aLocalMinimum.x, aLocalMinimum.y, 0.0f, 1.0f), vec4(aLocalMaximum.x, aLocalMinimum.y, 0.0f, 1.0f),
+                                  vec4(aLocalMinimum.x, aLocalMaximum.y, 0.0f, 1.0f), vec4(aLocalMaximum.x, aLocalMaximum.y, 0.0f, 1.0f) };
+        for(unsigned int i = 0; i < 4; i++)
+        {
+            vec4 corner = m_ModelMatrix * corners[i];
+            if(i == 0)
+            {
+                m_BoundsMinimum = vec2(corner.x, corner.y);
+                m_BoundsMaximum = vec2(corner.x, corner.y);
+            }
+            else
+            {
+                m_BoundsMinimum = min(m_BoundsMinimum, vec2(corner.x, corner.y));
+                m_BoundsMaximum = max(m_BoundsMaximum, vec2(corner.x, corner.y));
+            }
+        }
+        
+        m_HasBounds = true;
+    }
+    
     unsigned long GameObject::GetNumberOfChildren()
     {
         return m_Children.size();
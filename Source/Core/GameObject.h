@@ -102,6 +102,21 @@ namespace GameDev2D
         
         //Returns the world scale of the GameObject, it takes into account the parent's (if any) scale Can be overridden.
         virtual vec2 GetWorldScale();
+        
+        //Returns the world position, angle and scale the GameObject is drawn at. When the fixed timestep is enabled, the
+        //transform is interpolated between the previous fixed update and the last fixed update, otherwise it's the world transform
+        vec2 GetRenderPosition();
+        float GetRenderAngle();
+        vec2 GetRenderScale();
+        
+        //Called by the PlatformLayer before each fixed update, the transform before a GameObject's first change
+        //in the fixed update is kept to interpolate from
+        static void StartFixedUpdate();
+        
+        //Sets how far (0.0 to 1.0) the frame is between the last fixed update and the next fixed update,
+        //1.0 draws the GameObjects at their current transform
+        static void SetRenderInterpolation(float interpolation);
+        static float GetRenderInterpolation();
 
         //Getter and setter methods to enable this GameObject, by default if a GameObject is NOT enabled,
         //then it won't be updated OR drawn. However that behaviour can be modified by inheriting classes
@@ -125,9 +140,20 @@ namespace GameDev2D
         //the GameObject has been updated.
         void ModelMatrixIsDirty(bool resetImmediately = false);
         
-        //Returns wether the model matrix is dirty
+        //Returns wether the model matrix is dirty, an interpolated model matrix is dirty every frame
         bool IsModelMatrixDirty();
         
+        //Returns wether the GameObject's cached world bounds overlap the active camera's view, the result is counted as drawn or
+        //culled. A GameObject without bounds (ie. one that doesn't draw anything itself) is always in view. Can be overridden.
+        virtual bool IsInView();
+        
+        //Returns wether the GameObject has world bounds, they are set when the model matrix is reset
+        bool HasBounds();
+        
+        //Returns the cached world space bounding box of the GameObject
+        vec2 GetBoundsMinimum();
+        vec2 GetBoundsMaximum();
+        
         //Returns the number of children attached to this GameObject
         unsigned long GetNumberOfChildren();
         
@@ -150,6 +176,16 @@ namespace GameDev2D
         //Conveniance method used to sort the GameObject's children, based on their 'depth'
         void SortChildren();
         
+        //Keeps the current transform, the first time the transform changes in a fixed update
+        void StorePreviousTransform();
+        
+        //Returns wether the transform changed in the last fixed update, and is interpolated when its drawn
+        bool IsTransformInterpolated();
+        
+        //Caches the world bounds, the local bounding box is transformed by the model matrix. Inheriting
+        //classes that draw something call this from ResetModelMatrix(), after the model matrix is set
+        void ResetBounds(vec2 localMinimum, vec2 localMaximum);
+        
         //Function pointer definition and conveniance tween method
         typedef void (GameObject::*TweenSetMethod)(float value, double duration, EasingFunction easingFunction, bool reverse, int repeat);
         void UpdateTween(double delta, Tween* tween, TweenSetMethod tweenSetMethod);
@@ -174,6 +210,19 @@ public:
         bool m_ForceUpdate;
         bool m_ResetModelMatrix;
         
+        //Previous transform member variables, used to interpolate the rendered transform
+        vec2 m_PreviousPosition;
+        vec2 m_PreviousScale;
+        float m_PreviousAngle;
+        unsigned int m_PreviousTransformUpdate;
+        unsigned int m_CreatedFixedUpdate;
+        bool m_IsModelMatrixInterpolated;
+        
+        //Cached world bounds member variables
+        vec2 m_BoundsMinimum;
+        vec2 m_BoundsMaximum;
+        bool m_HasBounds;
+        
         //Tween member variables
         Tween m_TweenLocalX;
         Tween m_TweenLocalY;
@@ -183,6 +232,10 @@ public:
         
         //Delayed method member variables, the pair holds the method to be delayed and the delay duration
         vector<pair<DelayedMethod, double>> m_DelayedMethods;
+        
+        //Static member variables, the number of fixed updates and the render interpolation
+        static unsigned int s_FixedUpdate;
+        static float s_RenderInterpolation;
     };
     
     //Struct to keep track of a GameObject's child, the child's depth and wether
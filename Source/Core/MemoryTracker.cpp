@@ -0,0 +1,155 @@
+//
+//  MemoryTracker.cpp
+//  GameDev2D
+//
+
+#include "MemoryTracker.h"
+#include <iomanip>
+#include <sstream>
+
+
+namespace GameDev2D
+{
+    //Local constants
+    const char* const MEMORY_TAG_NAMES[MemoryTagCount] = { "Textures", "Tiles", "Enemies", "PathNodes", "Labels", "Audio" };
+    const char* const MEMORY_SIZE_UNITS[] = { "B", "KB", "MB", "GB" };
+    const unsigned int MEMORY_SIZE_UNIT_COUNT = 4;
+
+    atomic<size_t> MemoryTracker::s_BytesUsed[MemoryTagCount];
+    atomic<size_t> MemoryTracker::s_PeakBytesUsed[MemoryTagCount];
+    atomic<unsigned int> MemoryTracker::s_NumberOfAllocations[MemoryTagCount];
+    atomic<unsigned int> MemoryTracker::s_NumberOfFrameAllocations[MemoryTagCount];
+    unsigned int MemoryTracker::s_NumberOfLastFrameAllocations[MemoryTagCount] = {};
+    size_t MemoryTracker::s_Budgets[MemoryTagCount] = {};
+    unsigned int MemoryTracker::s_FrameAllocationBudgets[MemoryTagCount] = {};
+
+    MemoryTracker::MemoryTracker() : BaseObject("MemoryTracker")
+    {
+        for(unsigned int i = 0; i < MemoryTagCount; i++)
+        {
+            m_IsOverBudget[i] = false;
+            m_IsOverFrameAllocationBudget[i] = false;
+        }
+    }
+
+    MemoryTracker::~MemoryTracker()
+    {
+
+    }
+
+    void MemoryTracker::StartFrame()
+    {
+        for(unsigned int i = 0; i < MemoryTagCount; i++)
+        {
+            //The allocations made since the last frame started
+            s_NumberOfLastFrameAllocations[i] = s_NumberOfFrameAllocations[i].exchange(0);
+
+            //Check the budget of bytes allocated
+            bool isOverBudget = s_Budgets[i] > 0 && s_BytesUsed[i] > s_Budgets[i];
+            if(isOverBudget == true && m_IsOverBudget[i] == false)
+            {
+                Error(false, "%s exceeded its memory budget, %llu bytes are allocated, the budget is %llu bytes", MEMORY_TAG_NAMES[i], (unsigned long long)s_BytesUsed[i].load(), (unsigned long long)s_Budgets[i]);
+            }
+            m_IsOverBudget[i] = isOverBudget;
+
+            //Check the budget of allocations made each frame
+            bool isOverFrameAllocationBudget = s_FrameAllocationBudgets[i] > 0 && s_NumberOfLastFrameAllocations[i] > s_FrameAllocationBudgets[i];
+            if(isOverFrameAllocationBudget == true && m_IsOverFrameAllocationBudget[i] == false)
+            {
+                Error(false, "%s exceeded its frame allocation budget, %u allocations were made last frame, the budget is %u", MEMORY_TAG_NAMES[i], s_NumberOfLastFrameAllocations[i], s_FrameAllocationBudgets[i]);
+            }
+            m_IsOverFrameAllocationBudget[i] = isOverFrameAllocationBudget;
+        }
+    }
+
+    void MemoryTracker::MemoryUsageFormatted(string& aFormatted)
+    {
+        stringstream memoryStream;
+        for(unsigned int i = 0; i < MemoryTagCount; i++)
+        {
+            //Format the bytes to the nearest KB, MB, GB
+            double bytes = (double)s_BytesUsed[i];
+            unsigned int order = 0;
+            while(bytes >= 1024 && order + 1 < MEMORY_SIZE_UNIT_COUNT)
+            {
+                order++;
+                bytes = bytes / 1024;
+            }
+
+            //One tag per line
+            memoryStream << (i > 0 ? "\n" : "") << MEMORY_TAG_NAMES[i] << ": " << fixed << setprecision(1) << bytes << MEMORY_SIZE_UNITS[order];
+            memoryStream << " (" << s_NumberOfAllocations[i] << " live, " << s_NumberOfLastFrameAllocations[i] << "/frame)";
+
+            //Flag the tags that are over budget
+            if(m_IsOverBudget[i] == true || m_IsOverFrameAllocationBudget[i] == true)
+            {
+                memoryStream << " OVER BUDGET";
+            }
+        }
+
+        aFormatted = memoryStream.str();
+    }
+
+    void MemoryTracker::TrackAllocation(MemoryTag aTag, size_t aBytes)
+    {
+#if TRACK_MEMORY_TAGS
+        //Increment the counters, relaxed ordering is enough since they are only counters
+        size_t bytesUsed = s_BytesUsed[aTag].fetch_add(aBytes, memory_order_relaxed) + aBytes;
+        s_NumberOfAllocations[aTag].fetch_add(1, memory_order_relaxed);
+        s_NumberOfFrameAllocations[aTag].fetch_add(1, memory_order_relaxed);
+
+        //Update the peak bytes used, if another thread changed the peak the exchange fails and the peak is reloaded
+        size_t peakBytesUsed = s_PeakBytesUsed[aTag].load(memory_order_relaxed);
+        while(bytesUsed > peakBytesUsed)
+        {
+            if(s_PeakBytesUsed[aTag].compare_exchange_weak(peakBytesUsed, bytesUsed, memory_order_relaxed) == true)
+            {
+                break;
+            }
+        }
+#endif
+    }
+
+    void MemoryTracker::TrackDeallocation(MemoryTag aTag, size_t aBytes)
+    {
+#if TRACK_MEMORY_TAGS
+        s_BytesUsed[aTag].fetch_sub(aBytes, memory_order_relaxed);
+        s_NumberOfAllocations[aTag].fetch_sub(1, memory_order_relaxed);
+#endif
+    }
+
+    size_t MemoryTracker::GetBytesUsed(MemoryTag aTag)
+    {
+        return s_BytesUsed[aTag];
+    }
+
+    size_t MemoryTracker::GetPeakBytesUsed(MemoryTag aTag)
+    {
+        return s_PeakBytesUsed[aTag];
+    }
+
+    unsigned int MemoryTracker::GetNumberOfAllocations(MemoryTag aTag)
+    {
+        return s_NumberOfAllocations[aTag];
+    }
+
+    unsigned int MemoryTracker::GetNumberOfFrameAllocations(MemoryTag aTag)
+    {
+        return s_NumberOfLastFrameAllocations[aTag];
+    }
+
+    void MemoryTracker::SetBudget(MemoryTag aTag, size_t aBytes)
+    {
+        s_Budgets[aTag] = aBytes;
+    }
+
+    void MemoryTracker::SetFrameAllocationBudget(MemoryTag aTag, unsigned int aAllocations)
+    {
+        s_FrameAllocationBudgets[aTag] = aAllocations;
+    }
+
+    const char* MemoryTracker::GetTagName(MemoryTag aTag)
+    {
+        return MEMORY_TAG_NAMES[aTag];
+    }
+}
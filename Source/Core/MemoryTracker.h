@@ -0,0 +1,135 @@
+//
+//  MemoryTracker.h
+//  GameDev2D
+//
+
+#ifndef __GameDev2D__MemoryTracker__
+#define __GameDev2D__MemoryTracker__
+
+#include "BaseObject.h"
+#include <atomic>
+#include <new>
+
+
+using namespace std;
+
+namespace GameDev2D
+{
+    //The subsystems that allocations are tracked for
+    enum MemoryTag
+    {
+        MemoryTag_Textures = 0,
+        MemoryTag_Tiles,
+        MemoryTag_Enemies,
+        MemoryTag_PathNodes,
+        MemoryTag_Labels,
+        MemoryTag_Audio,
+        MemoryTagCount
+    };
+
+    //The MemoryTracker keeps low overhead counters of the bytes allocated, the live allocations and the allocations
+    //made each frame for each MemoryTag. The counters are atomic, so allocations can be tracked from the JobSystem's
+    //worker threads, and static, so allocations made before the PlatformLayer creates the MemoryTracker are tracked.
+    //Budgets can be set for the bytes allocated and for the allocations made each frame, an Error is logged the first
+    //frame a budget is exceeded. Unlike MemTrack, which tracks every allocation, only the tagged allocations are tracked.
+    class MemoryTracker : public BaseObject
+    {
+    public:
+        MemoryTracker();
+        ~MemoryTracker();
+
+        //Called by the PlatformLayer at the start of each frame, the allocations made since the last call become
+        //the last frame's allocations, then the budgets are checked
+        void StartFrame();
+
+        //Formats the bytes used and the allocations of each tag, one tag per line, used by the DebugUI
+        void MemoryUsageFormatted(string& formatted);
+
+        //Tracks an allocation or a deallocation of a number of bytes for a tag, can be called from any thread
+        static void TrackAllocation(MemoryTag tag, size_t bytes);
+        static void TrackDeallocation(MemoryTag tag, size_t bytes);
+
+        //Returns the bytes currently allocated, and the most bytes that have been allocated at once for a tag
+        static size_t GetBytesUsed(MemoryTag tag);
+        static size_t GetPeakBytesUsed(MemoryTag tag);
+
+        //Returns the number of live allocations for a tag
+        static unsigned int GetNumberOfAllocations(MemoryTag tag);
+
+        //Returns the number of allocations made during the last frame for a tag
+        static unsigned int GetNumberOfFrameAllocations(MemoryTag tag);
+
+        //Sets the budget of bytes allocated and of allocations made each frame for a tag, zero (the default) means no budget
+        static void SetBudget(MemoryTag tag, size_t bytes);
+        static void SetFrameAllocationBudget(MemoryTag tag, unsigned int allocations);
+
+        //Returns the name of a tag
+        static const char* GetTagName(MemoryTag tag);
+
+    private:
+        //Member variables, used to only log an Error the first frame a budget is exceeded
+        bool m_IsOverBudget[MemoryTagCount];
+        bool m_IsOverFrameAllocationBudget[MemoryTagCount];
+
+        //Static member variables
+        static atomic<size_t> s_BytesUsed[MemoryTagCount];
+        static atomic<size_t> s_PeakBytesUsed[MemoryTagCount];
+        static atomic<unsigned int> s_NumberOfAllocations[MemoryTagCount];
+        static atomic<unsigned int> s_NumberOfFrameAllocations[MemoryTagCount];
+        static unsigned int s_NumberOfLastFrameAllocations[MemoryTagCount];
+        static size_t s_Budgets[MemoryTagCount];
+        static unsigned int s_FrameAllocationBudgets[MemoryTagCount];
+    };
+
+//MemTrack's new macro would replace the operator new declarations below
+#if TRACK_MEMORY_USAGE && DEBUG
+#pragma push_macro("new")
+#undef new
+#endif
+
+    //Inherit from MemoryTracked to track every instance of a class that is created with new under a tag, the size of
+    //the most derived class is tracked. If TRACK_MEMORY_TAGS is disabled the class is empty and new isn't overloaded.
+    template <MemoryTag tag> class MemoryTracked
+    {
+    public:
+#if TRACK_MEMORY_TAGS
+        static void* operator new(size_t aSize)
+        {
+            void* pointer = ::operator new(aSize);
+            MemoryTracker::TrackAllocation(tag, aSize);
+            return pointer;
+        }
+
+        static void* operator new[](size_t aSize)
+        {
+            void* pointer = ::operator new[](aSize);
+            MemoryTracker::TrackAllocation(tag, aSize);
+            return pointer;
+        }
+
+        static void operator delete(void* aPointer, size_t aSize)
+        {
+            if(aPointer != nullptr)
+            {
+                MemoryTracker::TrackDeallocation(tag, aSize);
+                ::operator delete(aPointer);
+            }
+        }
+
+        static void operator delete[](void* aPointer, size_t aSize)
+        {
+            if(aPointer != nullptr)
+            {
+                MemoryTracker::TrackDeallocation(tag, aSize);
+                ::operator delete[](aPointer);
+            }
+        }
+#endif
+    };
+
+#if TRACK_MEMORY_USAGE && DEBUG
+#pragma pop_macro("new")
+#endif
+}
+
+#endif /* defined(__GameDev2D__MemoryTracker__) */
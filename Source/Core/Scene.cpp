@@ -28,6 +28,12 @@ namespace GameDev2D
     
     Scene::~Scene()
     {
+        //Make sure the SceneManager doesn't keep preloading the Scene
+        if(ServiceLocator::GetSceneManager() != nullptr)
+        {
+            ServiceLocator::GetSceneManager()->CancelPreload(this);
+        }
+        
         //Delete the Camera object
         SafeDelete(m_Camera);
         
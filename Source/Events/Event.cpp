@@ -148,6 +148,9 @@ namespace GameDev2D
             case AUDIO_CHANNEL_INVALIDATED_EVENT:
                 return "Audio channel invalidated";
                 
+            case FILE_CHANGED_EVENT:
+                return "File changed";
+                
             case KEYBOARD_EVENT:
                 return "Keyboard";
                 
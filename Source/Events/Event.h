@@ -50,6 +50,9 @@ namespace GameDev2D
     const unsigned int AUDIO_PLAYBACK_FINISHED_EVENT = 35;
     const unsigned int AUDIO_CHANNEL_INVALIDATED_EVENT = 36;
     
+    //File events
+    const unsigned int FILE_CHANGED_EVENT = 37;
+    
     //Key event
     const unsigned int KEYBOARD_EVENT = 40;
     
@@ -0,0 +1,31 @@
+//
+//  FileChangedEvent.cpp
+//  GameDev2D
+//
+
+#include "FileChangedEvent.h"
+
+
+namespace GameDev2D
+{
+    FileChangedEvent::FileChangedEvent(const string& aPath) : Event("FileChangedEvent"),
+        m_Path(aPath)
+    {
+        SetEventCode(FILE_CHANGED_EVENT);
+    }
+    
+    FileChangedEvent::~FileChangedEvent()
+    {
+    
+    }
+    
+    string FileChangedEvent::GetPath()
+    {
+        return m_Path;
+    }
+    
+    void FileChangedEvent::LogEvent()
+    {
+        Log(VerbosityLevel_Events, "%s", m_Path.c_str());
+    }
+}
@@ -0,0 +1,35 @@
+//
+//  FileChangedEvent.h
+//  GameDev2D
+//
+
+#ifndef __GameDev2D__FileChangedEvent__
+#define __GameDev2D__FileChangedEvent__
+
+#include "../Event.h"
+
+
+using namespace std;
+
+namespace GameDev2D
+{
+    //The FileChangedEvent class is a subclass of the Event class and is sent by the
+    //FileWatcher on the main thread whenever a watched file is modified on disk
+    class FileChangedEvent : public Event
+    {
+    public:
+        FileChangedEvent(const string& path);
+        ~FileChangedEvent();
+        
+        //Returns the path of the file that changed
+        string GetPath();
+      
+    protected:
+        void LogEvent();
+      
+    private:
+        string m_Path;
+    };
+}
+
+#endif /* defined(__GameDev2D__FileChangedEvent__) */
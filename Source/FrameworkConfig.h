@@ -35,20 +35,54 @@
 #define WINDOWS_DEFAULT_FULLSCREEN false
 #define WINDOWS_DEFAULT_VERTICAL_SYNC false
 
+//Linux Platform settings (offscreen rendering, no window)
+#define LINUX_TARGET_FPS 60
+#define LINUX_DEFAULT_WIDTH 1024
+#define LINUX_DEFAULT_HEIGHT 832
+#define LINUX_CAP_FRAME_RATE false
+#define LINUX_OFFSCREEN_NUMBER_OF_FRAMES 0
+
 //Graphics
 #define GRAPHICS_DEFAULT_CLEAR_COLOR Color::WhiteColor()
+#define GRAPHICS_INSTANCED_RENDERING 1
+#define GRAPHICS_FRUSTUM_CULLING 1
 
 //Input
 #define SIMULATE_TOUCH_EVENTS_WITH_MOUSE 0
 
+//Audio
+#define AUDIO_NULL_OUTPUT 0
+
+//Timing
+#define FIXED_TIMESTEP 0
+#define FIXED_TIMESTEP_UPDATES_PER_SECOND 60
+#define FIXED_TIMESTEP_MAX_UPDATES_PER_FRAME 5
+#define FRAME_PACING_SPIN_MICROSECONDS 2000
+
+//Jobs
+#define JOB_SYSTEM_NUMBER_OF_WORKER_THREADS 0
+
+//Loading
+#define SCENE_PRELOAD_BUDGET_MILLISECONDS 4
+#define TEXTURE_UPLOAD_BUDGET_MILLISECONDS 2
+#define CACHE_ATLAS_METADATA 1
+
+//Hot reload
+#define HOT_RELOAD_TEXTURES 1
+#define FILE_WATCHER_POLL_INTERVAL_MILLISECONDS 500
+
 //Errors
 #define THROW_EXCEPTION_ON_ERROR 1
 
 //Memory
 #define TRACK_MEMORY_USAGE 0
+#define TRACK_MEMORY_TAGS 1
+#define FRAME_ARENA_CAPACITY (1024 * 1024)
 #define PURGE_UNUSED_TEXTURES_IMMEDIATELY 0
 #define PURGE_UNUSED_SHADERS_IMMEDIATELY 0
 #define PURGE_UNUSED_FONTS_IMMEDIATELY 0
+#define PURGE_UNUSED_SOUNDS_IMMEDIATELY 0
+#define RESOURCE_MEMORY_BUDGET (128 * 1024 * 1024)
 
 //Logging
 #define LOG_VERBOSITY_MASK VerbosityLevel_Debug | VerbosityLevel_Events
@@ -60,13 +94,20 @@
 #define LOG_PROJECTION_MATRIX 0
 #define LOG_VIEW_MATRIX 0
 
+#define LOG_JOB_SYSTEM_SCALING_BENCHMARK 0
+
 #define LOG_TRUE_TYPE_FONT_GLYPH_DATA 0
 #define LOG_BITMAP_FONT_GLYPH_DATA 0
 
+#define LOG_ATLAS_FILE_LOAD_DATA 1
+
 //Draw
 #define DRAW_DEBUG_UI 1
 #define DEBUG_UI_FONT_COLOR Color::WhiteColor()
 
+#define DRAW_PERFORMANCE_PANEL 0
+#define PERFORMANCE_PANEL_TOGGLE_KEY KEY_CODE_F3
+
 #define DRAW_JOYSTICK_DATA 0
 
 #define DRAW_TOUCH_DEBUG_DATA 0
@@ -19,6 +19,9 @@ namespace GameDev2D
     Camera::Camera() : BaseObject("Camera"),
         m_ProjectionMatrix(mat4(1.0f)),
         m_ViewMatrix(mat4(1.0f)),
+        m_ViewProjectionMatrix(mat4(1.0f)),
+        m_ViewBoundsMinimum(vec2(0.0f, 0.0f)),
+        m_ViewBoundsMaximum(vec2(0.0f, 0.0f)),
         m_Position(vec2(0.0f, 0.0f)),
         m_Orientation(0.0f),
         m_Zoom(1.0f),
@@ -30,6 +33,7 @@ namespace GameDev2D
         m_ShakeOffset(vec2(0.0f, 0.0f)),
         m_ProjectionMatrixDirty(true),
         m_ViewMatrixDirty(true),
+        m_ViewProjectionMatrixDirty(true),
         m_TweenPositionX(),
         m_TweenPositionY(),
         m_TweenOrientation(),
@@ -116,6 +120,45 @@ namespace GameDev2D
     {
         return m_ViewMatrix;
     }
+    
+    mat4 Camera::GetViewProjectionMatrix()
+    {
+        //Recalculate the view projection matrix, if the projection or view matrix has been reset
+        if(m_ViewProjectionMatrixDirty == true)
+        {
+            m_ViewProjectionMatrix = m_ProjectionMatrix * m_ViewMatrix;
+            m_ViewProjectionMatrixDirty = false;
+            
+            //Transform the corners of the clip space back into world space, the view bounds
+            //are the bounding box of the four corners, which handles any orientation
+            mat4 inverseViewProjection = inverse(m_ViewProjectionMatrix);
+            const vec4 corners[4] = { vec4(-1.0f, -1.0f, 0.0f, 1.0f), vec4(1.0f, -1.0f, 0.0f, 1.0f), vec4(-1.0f, 1.0f, 0.0f, 1.0f), vec4(1.0f, 1.0f, 0.0f, 1.0f) };
+            for(unsigned int i = 0; i < 4; i++)
+            {
+                vec4 corner = inverseViewProjection * corners[i];
+                if(i == 0)
+                {
+                    m_ViewBoundsMinimum = vec2(corner.x, corner.y);
+                    m_ViewBoundsMaximum = vec2(corner.x, corner.y);
+                }
+                else
+                {
+                    m_ViewBoundsMinimum = min(m_ViewBoundsMinimum, vec2(corner.x, corner.y));
+                    m_ViewBoundsMaximum = max(m_ViewBoundsMaximum, vec2(corner.x, corner.y));
+                }
+            }
+        }
+        return m_ViewProjectionMatrix;
+    }
+    
+    void Camera::GetViewBounds(vec2& aMinimum, vec2& aMaximum)
+    {
+        //Make sure the view projection matrix and the view bounds are up to date
+        GetViewProjectionMatrix();
+        
+        aMinimum = m_ViewBoundsMinimum;
+        aMaximum = m_ViewBoundsMaximum;
+    }
 
     float Camera::GetViewWidth()
     {
@@ -237,8 +280,9 @@ namespace GameDev2D
     
     void Camera::ResetProjectionMatrix()
     {
-        //Reset the dirty matrix flag
+        //Reset the dirty matrix flag, the view projection matrix will need to be recalculated
         m_ProjectionMatrixDirty = false;
+        m_ViewProjectionMatrixDirty = true;
     
         //Safety check the Graphics service isn't null
         if(ServiceLocator::GetGraphics() != nullptr)
@@ -263,8 +307,9 @@ namespace GameDev2D
     
     void Camera::ResetViewMatrix()
     {
-        //Reset the dirty matrix flag
+        //Reset the dirty matrix flag, the view projection matrix will need to be recalculated
         m_ViewMatrixDirty = false;
+        m_ViewProjectionMatrixDirty = true;
     
         //Safety check the Graphics service isn't null
         if(ServiceLocator::GetGraphics() != nullptr)
@@ -40,6 +40,13 @@ namespace GameDev2D
         mat4 GetProjectionMatrix();
         mat4 GetViewMatrix();
         
+        //Returns the projection matrix multiplied by the view matrix, only recalculated after one of the matrices is reset
+        mat4 GetViewProjectionMatrix();
+        
+        //Gets the world space bounding box of what the camera can see, factors in the position, orientation, zoom and shake.
+        //The bounding box is cached with the view projection matrix, used to cull objects that are outside the view
+        void GetViewBounds(vec2& minimum, vec2& maximum);
+        
         //Gets the view width and height, factors in the current zoom level
         float GetViewWidth();
         float GetViewHeight();
@@ -92,11 +99,15 @@ namespace GameDev2D
         //Member variables
         mat4 m_ProjectionMatrix;
         mat4 m_ViewMatrix;
+        mat4 m_ViewProjectionMatrix;
+        vec2 m_ViewBoundsMinimum;
+        vec2 m_ViewBoundsMaximum;
         vec2 m_Position;
         float m_Orientation;
         float m_Zoom;
         bool m_ProjectionMatrixDirty;
         bool m_ViewMatrixDirty;
+        bool m_ViewProjectionMatrixDirty;
         
         //Tween member variables
         Tween m_TweenPositionX;
@@ -9,6 +9,8 @@
 
 #include "Shader.h"
 #include "../../IO/File.h"
+#include "../../Services/ServiceLocator.h"
+#include "../../Services/Graphics/Graphics.h"
 
 
 namespace GameDev2D
@@ -19,9 +21,12 @@ namespace GameDev2D
         m_FragmentShader(0),
         m_ModelViewProjectionUniform(0),
         m_TextureUniform(0),
+        m_ViewProjectionUniform(0),
+        m_TextureSizeUniform(0),
         m_VertexShaderString(aVertexShader),
         m_FragmentShaderString(aFragmentShader),
-        m_Key("")
+        m_Key(""),
+        m_IsValid(false)
     {
         //Create the shader program
         m_Program = glCreateProgram();
@@ -64,6 +69,13 @@ namespace GameDev2D
         //Delete the shader program
         if(m_Program != 0)
         {
+            //If the program is in use, the Graphics service's cached program needs to be reset
+            Graphics* graphics = ServiceLocator::GetGraphics();
+            if(graphics != nullptr && graphics->GetCurrentProgram() == m_Program)
+            {
+                graphics->UseProgram(0);
+            }
+            
             glDeleteProgram(m_Program);
             m_Program = 0;
         }
@@ -84,7 +96,7 @@ namespace GameDev2D
     
     unsigned int Shader::GetUniform(const char* aUniform)
     {
-        return 0; //TODO:
+        return glGetUniformLocation(m_Program, aUniform);
     }
     
     unsigned int Shader::GetModelViewProjectionUniform()
@@ -97,6 +109,16 @@ namespace GameDev2D
         return m_TextureUniform;
     }
     
+    unsigned int Shader::GetViewProjectionUniform()
+    {
+        return m_ViewProjectionUniform;
+    }
+    
+    unsigned int Shader::GetTextureSizeUniform()
+    {
+        return m_TextureSizeUniform;
+    }
+    
     void Shader::Link()
     {
         //Link the program
@@ -145,13 +167,20 @@ namespace GameDev2D
         
         //Get the uniform location of the texture
         m_TextureUniform = glGetUniformLocation(m_Program, "u_texture");
+        
+        //Get the uniform locations of the view projection matrix and the texture size, only the instanced shader has them
+        m_ViewProjectionUniform = glGetUniformLocation(m_Program, "u_viewProjection");
+        m_TextureSizeUniform = glGetUniformLocation(m_Program, "u_textureSize");
+        
+        //Validate the program once, the draw calls check the result instead of validating every draw
+        m_IsValid = Validate();
     }
     
     void Shader::Use()
     {
         if(m_Program != 0)
         {
-            glUseProgram(m_Program);
+            ServiceLocator::GetGraphics()->UseProgram(m_Program);
         }
     }
     
@@ -189,6 +218,11 @@ namespace GameDev2D
         return status != GL_FALSE;
     }
     
+    bool Shader::IsValid()
+    {
+        return m_IsValid;
+    }
+    
     void Shader::SetKey(const string& aKey)
     {
         m_Key = string(aKey);
@@ -35,12 +35,19 @@ namespace GameDev2D
         //Returns the uniform for the texture (used in the passthrough shader)
         unsigned int GetTextureUniform();
         
+        //Returns the uniforms for the view projection matrix and the texture size (used in the instanced passthrough shader)
+        unsigned int GetViewProjectionUniform();
+        unsigned int GetTextureSizeUniform();
+        
         //Call to use the shader program
         void Use();
         
         //Validate the Shader, returns true is the validation was successful
         bool Validate();
         
+        //Returns wether the Shader passed validation, the Shader is validated once when it is linked
+        bool IsValid();
+        
         //Set a key to identify this shader from other shader
         void SetKey(const string& key);
         
@@ -76,9 +83,12 @@ namespace GameDev2D
         map<string, int> m_AttributeLocations;
         unsigned int m_ModelViewProjectionUniform;
         unsigned int m_TextureUniform;
+        unsigned int m_ViewProjectionUniform;
+        unsigned int m_TextureSizeUniform;
         string m_VertexShaderString;
         string m_FragmentShaderString;
         string m_Key;
+        bool m_IsValid;
     };
 }
 
@@ -134,6 +134,16 @@ namespace GameDev2D
         return 0;
     }
     
+    unsigned int TrueTypeFont::GetNumberOfBytes()
+    {
+        //The render target is RGBA, one byte per channel
+        if(m_RenderTarget != nullptr)
+        {
+            return m_RenderTarget->GetWidth() * m_RenderTarget->GetHeight() * 4;
+        }
+        return 0;
+    }
+    
     void TrueTypeFont::BuildFontAtlas()
     {
         //If this assert is hit, that means the font face couldn't be generated, 
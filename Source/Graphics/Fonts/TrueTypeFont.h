@@ -47,6 +47,9 @@ namespace GameDev2D
         unsigned short GetAdvanceXForCharacter(char character);
         char GetBearingXForCharacter(char character);
         char GetBearingYForCharacter(char character);
+        
+        //Returns the number of bytes of texture memory the font's render target uses, the FontManager uses it for the memory budget
+        unsigned int GetNumberOfBytes();
     
     private:
         //Private method, to prevent being accidentally called
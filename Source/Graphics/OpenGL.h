@@ -30,6 +30,11 @@
     //#include <gl/GL.h>
     //#include <gl/GLU.h>
     #include "../Platforms/Windows/App/OpenGL/OpenGLExtensions.h"
+#elif __linux__
+    //Mesa's libGL exports the core profile functions, they don't need to be loaded as extensions
+    #define GL_GLEXT_PROTOTYPES 1
+    #include <GL/gl.h>
+    #include <GL/glext.h>
 #endif
 
 
@@ -107,6 +107,12 @@ namespace GameDev2D
         //Delete the VAO
         if(m_VertexArrayObject != 0)
         {
+            //If the vertex array we are about to delete is bound, we need to unbind it
+            if(m_VertexArrayObject == ServiceLocator::GetGraphics()->GetBoundVertexArray())
+            {
+                ServiceLocator::GetGraphics()->BindVertexArray(0);
+            }
+            
             glDeleteVertexArrays(1, &m_VertexArrayObject);
             m_VertexArrayObject = 0;
         }
@@ -131,8 +137,8 @@ namespace GameDev2D
     
     void Polygon::Draw()
     {
-        //Safety check the shader
-        if(m_Shader == nullptr)
+        //Safety check the shader, and that it passed validation when it was linked
+        if(m_Shader == nullptr || m_Shader->IsValid() == false)
         {
             return;
         }
@@ -143,64 +149,57 @@ namespace GameDev2D
             ResetModelMatrix();
         }
     
-        //Use the shader
-        m_Shader->Use();
-        
-        //Set the point size attribute
-        int pointSizeIndex = m_Shader->GetAttribute("a_pointSize");
-        glEnable(GL_VERTEX_PROGRAM_POINT_SIZE);
-        glVertexAttrib1f(pointSizeIndex, m_PointSize);
-        
-        //Cache the graphics service
-        Graphics* graphics = ServiceLocator::GetGraphics();
-    
-        //Bind the vertex array object
-        graphics->BindVertexArray(m_VertexArrayObject);
-
-        //Set the model view projection matrix
-        mat4 mvp = graphics->GetProjectionMatrix() * graphics->GetViewMatrix() * m_ModelMatrix;
-        glUniformMatrix4fv(m_Shader->GetModelViewProjectionUniform(), 1, 0, &mvp[0][0]);
-        
-        //Validate the shader
-        if(m_Shader->Validate() == false)
-        {
-            Error(false, "Can't draw Polygon, shader failed to validate");
-            return;
-        }
-        
-        //Disable blending, if we did in fact have it enabled
-        if(m_Color.Alpha() != 1.0f)
+        //Only render the polygon if it is inside the camera's view, the children are culled on their own
+        if(IsInView() == true)
         {
-            graphics->EnableBlending();
-        }
-        
-        //Render the polygon
-        glDrawArrays(m_RenderMode, 0, (GLsizei)m_Vertices.size());
-        
-        //Disable blending, if we did in fact have it enabled
-        if(m_Color.Alpha() != 1.0f)
-        {
-            graphics->DisableBlending();
-        }
-        
-        //Unbind the vertex array
-        ServiceLocator::GetGraphics()->BindVertexArray(0);
+            //Use the shader
+            m_Shader->Use();
+            
+            //Set the point size attribute
+            int pointSizeIndex = m_Shader->GetAttribute("a_pointSize");
+            glEnable(GL_VERTEX_PROGRAM_POINT_SIZE);
+            glVertexAttrib1f(pointSizeIndex, m_PointSize);
+            
+            //Cache the graphics service
+            Graphics* graphics = ServiceLocator::GetGraphics();
         
-        //Draw the debug anchor point
-        #if DRAW_POLYGON_ANCHOR_POINT
-        if(GetType() != "Point" && GetType() != "Line")
-        {
-            Line lineA(m_AnchorLocation, vec2(m_AnchorLocation.x, m_AnchorLocation.y + DRAW_POLYGON_ANCHOR_POINT_SIZE));
-            lineA.SetLocalAngle(GetWorldAngle());
-            lineA.SetColor(Color::RedColor());
-            lineA.Draw();
-        
-            Line lineB(m_AnchorLocation, vec2(m_AnchorLocation.x + DRAW_POLYGON_ANCHOR_POINT_SIZE, m_AnchorLocation.y));
-            lineB.SetLocalAngle(GetWorldAngle());
-            lineB.SetColor(Color::GreenColor());
-            lineB.Draw();
+            //Bind the vertex array object
+            graphics->BindVertexArray(m_VertexArrayObject);
+
+            //Set the model view projection matrix, the camera caches the view projection matrix
+            mat4 mvp = graphics->GetViewProjectionMatrix() * m_ModelMatrix;
+            glUniformMatrix4fv(m_Shader->GetModelViewProjectionUniform(), 1, 0, &mvp[0][0]);
+            
+            //Enable blending if the polygon is transparent, the Graphics service skips the call if the state is already set
+            if(m_Color.Alpha() != 1.0f)
+            {
+                graphics->EnableBlending();
+            }
+            else
+            {
+                graphics->DisableBlending();
+            }
+            
+            //Render the polygon, the vertex array is left bound until another one is bound
+            graphics->AddDrawCall();
+            glDrawArrays(m_RenderMode, 0, (GLsizei)m_Vertices.size());
+            
+            //Draw the debug anchor point
+            #if DRAW_POLYGON_ANCHOR_POINT
+            if(GetType() != "Point" && GetType() != "Line")
+            {
+                Line lineA(m_AnchorLocation, vec2(m_AnchorLocation.x, m_AnchorLocation.y + DRAW_POLYGON_ANCHOR_POINT_SIZE));
+                lineA.SetLocalAngle(GetWorldAngle());
+                lineA.SetColor(Color::RedColor());
+                lineA.Draw();
+            
+                Line lineB(m_AnchorLocation, vec2(m_AnchorLocation.x + DRAW_POLYGON_ANCHOR_POINT_SIZE, m_AnchorLocation.y));
+                lineB.SetLocalAngle(GetWorldAngle());
+                lineB.SetColor(Color::GreenColor());
+                lineB.Draw();
+            }
+            #endif
         }
-        #endif
         
         //Call the GameObject's Draw() method, this will ensure that any children will also get drawn
         GameObject::Draw();
@@ -213,6 +212,9 @@ namespace GameDev2D
         
         //Add color for the vertex to the colors vector
         m_Colors.push_back(vec4(m_Color.Red(), m_Color.Green(), m_Color.Blue(), m_Color.Alpha()));
+        
+        //The vertices have changed, the model matrix and the bounds need to be reset
+        ModelMatrixIsDirty();
     }
         
     void Polygon::SetVertices(vec2* aVertices, unsigned int aCount)
@@ -493,22 +495,27 @@ namespace GameDev2D
         float height = top - bottom;
 
         //Translate the anchor, then translate the position
-        mat4 anchor = translate(mat4(1.0f), vec3(-width * GetWorldScale().x * GetAnchorPoint().x, -height * GetWorldScale().y * GetAnchorPoint().y, 0.0f));
-        mat4 viewTranslate = translate(anchor, vec3(GetWorldPosition().x, GetWorldPosition().y, 0.0f));
+        mat4 anchor = translate(mat4(1.0f), vec3(-width * GetRenderScale().x * GetAnchorPoint().x, -height * GetRenderScale().y * GetAnchorPoint().y, 0.0f));
+        mat4 viewTranslate = translate(anchor, vec3(GetRenderPosition().x, GetRenderPosition().y, 0.0f));
 
         //Calculate the rotation based on the anchor point
-        mat4 halfTranslate1 = translate(viewTranslate, vec3(width * GetWorldScale().x * GetAnchorPoint().x, height * GetWorldScale().y * GetAnchorPoint().y, 0.0f));
+        mat4 halfTranslate1 = translate(viewTranslate, vec3(width * GetRenderScale().x * GetAnchorPoint().x, height * GetRenderScale().y * GetAnchorPoint().y, 0.0f));
         
     #if DRAW_POLYGON_ANCHOR_POINT
         vec4 transformedVector = halfTranslate1 * vec4(0.0f, 0.0f, 0.0f, 1.0);
         m_AnchorLocation = vec2(transformedVector.x, transformedVector.y);
     #endif
         
-        mat4 viewRotation = rotate(halfTranslate1, GetWorldAngle(), vec3(0.0f, 0.0f, 1.0f));
-        mat4 halfTranslate2 = translate(viewRotation, vec3(-width * GetWorldScale().x * GetAnchorPoint().x, -height * GetWorldScale().y * GetAnchorPoint().y, 0.0f));
+        mat4 viewRotation = rotate(halfTranslate1, GetRenderAngle(), vec3(0.0f, 0.0f, 1.0f));
+        mat4 halfTranslate2 = translate(viewRotation, vec3(-width * GetRenderScale().x * GetAnchorPoint().x, -height * GetRenderScale().y * GetAnchorPoint().y, 0.0f));
         
         //Lastly the scale
-        m_ModelMatrix = scale(halfTranslate2, vec3(GetWorldScale().x, GetWorldScale().y, 0.0f));
+        m_ModelMatrix = scale(halfTranslate2, vec3(GetRenderScale().x, GetRenderScale().y, 0.0f));
+        
+        //Cache the world bounds, used to cull the polygon when it is outside the camera's view. The bounds
+        //are padded by half the point size, so that points and lines on the edge of the view aren't culled
+        vec2 padding = vec2(m_PointSize * 0.5f, m_PointSize * 0.5f);
+        ResetBounds(vec2(left, bottom) - padding, vec2(right, top) + padding);
         
         //Reset the model matrix
         GameObject::ResetModelMatrix();
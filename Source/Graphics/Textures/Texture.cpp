@@ -9,6 +9,7 @@
 #include "Texture.h"
 #include "../../Services/ServiceLocator.h"
 #include "../../Services/Graphics/Graphics.h"
+#include "../../Core/MemoryTracker.h"
 
 
 namespace GameDev2D
@@ -18,7 +19,8 @@ namespace GameDev2D
         m_MipmapLevel(0),
         m_Format(0),
         m_Id(0),
-        m_Filename(string(aFilename))
+        m_Filename(string(aFilename)),
+        m_ImageData(nullptr)
     {
         
     }
@@ -28,7 +30,8 @@ namespace GameDev2D
         m_MipmapLevel(0),
         m_Format(aFormat),
         m_Id(0),
-        m_Filename("")
+        m_Filename(""),
+        m_ImageData(nullptr)
     {
         GenerateTexture(aData);
     }
@@ -38,26 +41,19 @@ namespace GameDev2D
         m_MipmapLevel(0),
         m_Format(GL_RGBA),
         m_Id(0),
-        m_Filename("")
+        m_Filename(""),
+        m_ImageData(nullptr)
     {
         GenerateTexture(0);
     }
     
     Texture::~Texture()
     {
-        //Safety check the texture id
-        if(m_Id != 0)
-        {
-            //If the texture we are about to delete is bound, we need to unbind it
-            if(m_Id == ServiceLocator::GetGraphics()->GetBoundTextureId())
-            {
-                ServiceLocator::GetGraphics()->BindTexture(nullptr);
-            }
+        //Free the image data, if it was decoded but never uploaded
+        SafeFree(m_ImageData);
         
-            //Delete the texture
-            glDeleteTextures(1, &m_Id);
-            m_Id = 0;
-        }
+        //Delete the OpenGL texture
+        DeleteTexture(GetNumberOfBytes());
     }
     
     uvec2 Texture::GetSize()
@@ -81,6 +77,36 @@ namespace GameDev2D
     }
     
     bool Texture::LoadFromPath(const string& aPath)
+    {
+        //Decode the png image
+        if(DecodeFromPath(aPath) == false)
+        {
+            return false;
+        }
+        
+        //Upload the image data to OpenGL
+        UploadImageData();
+        return true;
+    }
+    
+    bool Texture::ReloadFromPath(const string& aPath)
+    {
+        //The size and format change once the image is decoded, get the number of bytes the current texture uses first
+        unsigned int numberOfBytes = GetNumberOfBytes();
+        
+        //Decode the png image, if it fails the current texture is kept
+        if(DecodeFromPath(aPath) == false)
+        {
+            return false;
+        }
+        
+        //Delete the current texture and upload the new image data
+        DeleteTexture(numberOfBytes);
+        UploadImageData();
+        return true;
+    }
+    
+    bool Texture::DecodeFromPath(const string& aPath)
     {
         png_structp png_ptr;
         png_infop info_ptr;
@@ -166,20 +192,28 @@ namespace GameDev2D
         //Set the texture color format
         m_Format = colorType == PNG_COLOR_TYPE_RGB ? GL_RGB : GL_RGBA;
         
-        //Allocate the image data
-        unsigned char* imageData = (unsigned char*)malloc(rowBytes * m_Size.y);
+        //Allocate the image data, it is kept until the OpenGL texture is generated
+        SafeFree(m_ImageData);
+        m_ImageData = (unsigned char*)malloc(rowBytes * m_Size.y);
         
         //The png image is ordered top to bottom, but OpenGL expect it bottom to top so the order or swapped
         for (unsigned int i = 0; i < m_Size.y; i++)
         {
-            memcpy(imageData + (rowBytes * (m_Size.y - 1 - i)), rowPointers[i], rowBytes);
+            memcpy(m_ImageData + (rowBytes * (m_Size.y - 1 - i)), rowPointers[i], rowBytes);
+        }
+    }
+    
+    void Texture::UploadImageData()
+    {
+        //Safety check the image data
+        if(m_ImageData != nullptr)
+        {
+            //Generate the OpenGL texture with the image data
+            GenerateTexture(m_ImageData);
+            
+            //Free the image data it has served its purpose
+            SafeFree(m_ImageData);
         }
-        
-        //Generate the OpenGL texture with the image data
-        GenerateTexture(imageData);
-        
-        //Free the image data it has served its purpose
-        SafeFree(imageData);
     }
     
     void Texture::GenerateTexture(void* data)
@@ -207,5 +241,35 @@ namespace GameDev2D
         
         //Specify a 2D texture image, provideing the a pointer to the image data in memory
         glTexImage2D(GL_TEXTURE_2D, m_MipmapLevel, m_Format, m_Size.x, m_Size.y, 0, m_Format, GL_UNSIGNED_BYTE, data);
+        
+        //Track the texture's memory
+        MemoryTracker::TrackAllocation(MemoryTag_Textures, GetNumberOfBytes());
+    }
+    
+    void Texture::DeleteTexture(unsigned int aNumberOfBytes)
+    {
+        //Safety check the texture id
+        if(m_Id != 0)
+        {
+            //If the texture we are about to delete is bound, we need to unbind it
+            if(m_Id == ServiceLocator::GetGraphics()->GetBoundTextureId())
+            {
+                ServiceLocator::GetGraphics()->BindTexture(nullptr);
+            }
+        
+            //Delete the texture
+            glDeleteTextures(1, &m_Id);
+            m_Id = 0;
+            
+            //The texture's memory has been released
+            MemoryTracker::TrackDeallocation(MemoryTag_Textures, aNumberOfBytes);
+        }
+    }
+    
+    unsigned int Texture::GetNumberOfBytes()
+    {
+        //The textures are either RGB or RGBA, one byte per channel
+        unsigned int bytesPerPixel = m_Format == GL_RGB ? 3 : 4;
+        return m_Size.x * m_Size.y * bytesPerPixel;
     }
 }
@@ -55,12 +55,29 @@ namespace GameDev2D
         //Loads the texture from a path, returns true if the loading was successful
         bool LoadFromPath(const string& path);
         
+        //Reloads the texture from a path, the current OpenGL texture is replaced once the new image has been
+        //decoded. If the decoding fails the current texture is kept, returns true if the reloading was successful
+        bool ReloadFromPath(const string& path);
+        
+        //Decodes the png image at a path, the image data is kept until UploadImageData() is called. Doesn't
+        //make any OpenGL calls, so it can be called from a worker thread, returns true if the decoding was successful
+        bool DecodeFromPath(const string& path);
+        
+        //Generates the OpenGL texture for the decoded image data and frees the image data
+        void UploadImageData();
+        
         //Set the png data
         void SetPngData(png_structp pngPointer, png_infop infoPointer);
         
         //Generates an open gl texture for the image data
         void GenerateTexture(void* data);
         
+        //Deletes the open gl texture, the number of bytes it used is tracked as released by the MemoryTracker
+        void DeleteTexture(unsigned int numberOfBytes);
+        
+        //Returns the number of bytes of texture memory the texture uses, tracked by the MemoryTracker
+        unsigned int GetNumberOfBytes();
+        
         //Friend classes, that need to access the protected methods
         friend class FontData;
         friend class TextureManager;
@@ -72,6 +89,7 @@ namespace GameDev2D
         unsigned int m_Format;
         unsigned int m_Id;
         string m_Filename;
+        unsigned char* m_ImageData;
     };
 }
 
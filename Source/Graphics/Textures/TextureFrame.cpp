@@ -20,11 +20,18 @@ namespace GameDev2D
         m_Shader(nullptr),
         m_Color(Color::WhiteColor()),
         m_SourceFrame(SourceFrame(0.0f, 0.0f, 0.0f, 0.0f)),
+        m_AtlasKey(aAtlasKey),
         m_OwnsTexture(true),
         m_VertexArrayObject(0),
         m_VertexBufferObject(0),
         m_UvCoordinatesBufferObject(0),
-        m_ColorsBufferObject(0)
+        m_ColorsBufferObject(0),
+        m_BatchVertexArrayObject(0),
+        m_BatchVertexBufferObject(0),
+        m_InstancedShader(nullptr),
+        m_InstancedVertexArrayObject(0),
+        m_InstancedQuadBufferObject(0),
+        m_InstanceBufferObject(0)
     {
         //Load the texture via the texture manager, this will ensure only one texture with this filename will be loaded
         ServiceLocator::GetTextureManager()->AddTexture(aFilename, aDirectory, this);
@@ -49,11 +56,18 @@ namespace GameDev2D
         m_Shader(nullptr),
         m_Color(Color::WhiteColor()),
         m_SourceFrame(SourceFrame(0.0f, 0.0f, (float)aWidth, (float)aHeight)),
+        m_AtlasKey(""),
         m_OwnsTexture(true),
         m_VertexArrayObject(0),
         m_VertexBufferObject(0),
         m_UvCoordinatesBufferObject(0),
-        m_ColorsBufferObject(0)
+        m_ColorsBufferObject(0),
+        m_BatchVertexArrayObject(0),
+        m_BatchVertexBufferObject(0),
+        m_InstancedShader(nullptr),
+        m_InstancedVertexArrayObject(0),
+        m_InstancedQuadBufferObject(0),
+        m_InstanceBufferObject(0)
     {
         //Create a new texture object for the width and height
         m_Texture = new Texture(aWidth, aHeight);
@@ -64,11 +78,18 @@ namespace GameDev2D
         m_Shader(nullptr),
         m_Color(Color::WhiteColor()),
         m_SourceFrame(SourceFrame(0.0f, 0.0f, (float)m_Texture->GetSize().x, (float)m_Texture->GetSize().y)),
+        m_AtlasKey(""),
         m_OwnsTexture(aOwnsTexture),
         m_VertexArrayObject(0),
         m_VertexBufferObject(0),
         m_UvCoordinatesBufferObject(0),
-        m_ColorsBufferObject(0)
+        m_ColorsBufferObject(0),
+        m_BatchVertexArrayObject(0),
+        m_BatchVertexBufferObject(0),
+        m_InstancedShader(nullptr),
+        m_InstancedVertexArrayObject(0),
+        m_InstancedQuadBufferObject(0),
+        m_InstanceBufferObject(0)
     {
 
     }
@@ -113,53 +134,211 @@ namespace GameDev2D
         //Delete the VAO
         if(m_VertexArrayObject != 0)
         {
+            //If the vertex array we are about to delete is bound, we need to unbind it
+            if(m_VertexArrayObject == ServiceLocator::GetGraphics()->GetBoundVertexArray())
+            {
+                ServiceLocator::GetGraphics()->BindVertexArray(0);
+            }
+            
             glDeleteVertexArrays(1, &m_VertexArrayObject);
             m_VertexArrayObject = 0;
         }
+        
+        //Delete the batch VBO
+        if(m_BatchVertexBufferObject != 0)
+        {
+            glDeleteBuffers(1, &m_BatchVertexBufferObject);
+            m_BatchVertexBufferObject = 0;
+        }
+        
+        //Delete the batch VAO
+        if(m_BatchVertexArrayObject != 0)
+        {
+            //If the vertex array we are about to delete is bound, we need to unbind it
+            if(m_BatchVertexArrayObject == ServiceLocator::GetGraphics()->GetBoundVertexArray())
+            {
+                ServiceLocator::GetGraphics()->BindVertexArray(0);
+            }
+            
+            glDeleteVertexArrays(1, &m_BatchVertexArrayObject);
+            m_BatchVertexArrayObject = 0;
+        }
+        
+        //Set the instanced Shader to null
+        m_InstancedShader = nullptr;
+        
+        //Delete the instanced quad and instance VBOs
+        if(m_InstancedQuadBufferObject != 0)
+        {
+            glDeleteBuffers(1, &m_InstancedQuadBufferObject);
+            m_InstancedQuadBufferObject = 0;
+        }
+        
+        if(m_InstanceBufferObject != 0)
+        {
+            glDeleteBuffers(1, &m_InstanceBufferObject);
+            m_InstanceBufferObject = 0;
+        }
+        
+        //Delete the instanced VAO
+        if(m_InstancedVertexArrayObject != 0)
+        {
+            //If the vertex array we are about to delete is bound, we need to unbind it
+            if(m_InstancedVertexArrayObject == ServiceLocator::GetGraphics()->GetBoundVertexArray())
+            {
+                ServiceLocator::GetGraphics()->BindVertexArray(0);
+            }
+            
+            glDeleteVertexArrays(1, &m_InstancedVertexArrayObject);
+            m_InstancedVertexArrayObject = 0;
+        }
     }
     
     void TextureFrame::Draw(mat4 aModelMatrix)
     {
+        //Return if the shader failed to validate when it was linked
+        if(m_Shader->IsValid() == false)
+        {
+            return;
+        }
+    
         //Set the shader to be used
         m_Shader->Use();
 
-        //Multiply the model matrix by the projection and view matrices
+        //Cache the graphics service
         Graphics* graphics = ServiceLocator::GetGraphics();
         
         //Bind the vertex array object
         graphics->BindVertexArray(m_VertexArrayObject);
 
-        //Set the model view projection matrix
-        mat4 mvp = graphics->GetProjectionMatrix() * graphics->GetViewMatrix() * aModelMatrix;
+        //Set the model view projection matrix, the camera caches the view projection matrix
+        mat4 mvp = graphics->GetViewProjectionMatrix() * aModelMatrix;
         glUniformMatrix4fv(m_Shader->GetModelViewProjectionUniform(), 1, 0, &mvp[0][0]);
         glUniform1i(m_Shader->GetTextureUniform(), 0);
         
-        //Validate the shader, return if it fails
-        if(m_Shader->Validate() == false)
+        //Bind the texture
+        graphics->BindTexture(GetTexture());
+        
+        //Enable blending if the texture has an alpha channel, the Graphics service skips the call if the state is already set
+        if(GetFormat() == GL_RGBA || m_Color.Alpha() != 1.0f)
+        {
+            graphics->EnableBlending();
+        }
+        else
+        {
+            graphics->DisableBlending();
+        }
+        
+        //Draw the texture, the vertex array is left bound until another one is bound
+        graphics->AddDrawCall();
+        glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+    }
+    
+    void TextureFrame::DrawBatch(const vector<mat4>& aModelMatrices)
+    {
+        DrawBatchQuads(aModelMatrices, nullptr);
+    }
+    
+    void TextureFrame::DrawBatch(const vector<mat4>& aModelMatrices, const vector<SourceFrame>& aSourceFrames)
+    {
+        //If this assert is hit, there isn't a source frame for every model matrix
+        assert(aModelMatrices.size() == aSourceFrames.size());
+        DrawBatchQuads(aModelMatrices, &aSourceFrames);
+    }
+    
+    void TextureFrame::DrawBatchQuads(const vector<mat4>& aModelMatrices, const vector<SourceFrame>* aSourceFrames)
+    {
+        //Is there anything to draw, return if the shader failed to validate when it was linked
+        if(aModelMatrices.size() == 0 || m_Shader == nullptr || m_Shader->IsValid() == false)
         {
             return;
         }
         
+        //Draw the quads with one instanced draw call if instancing is enabled, only the texture passthrough shader has an
+        //instanced variant, a TextureFrame with a custom shader always uses the vertex buffer path
+        Graphics* graphics = ServiceLocator::GetGraphics();
+        if(graphics->IsInstancingEnabled() == true && m_Shader == ServiceLocator::GetShaderManager()->GetPassthroughTextureShader())
+        {
+            if(DrawInstancedQuads(aModelMatrices, aSourceFrames) == true)
+            {
+                return;
+            }
+        }
+    
+        //Set the shader to be used
+        m_Shader->Use();
+        
+        //Fill the batch vertex buffer, this binds the batch vertex array object
+        UpdateBatchVertexBuffer(aModelMatrices, aSourceFrames);
+        
+        //The vertices are already transformed by their model matrices, only the projection and view matrices are needed
+        mat4 viewProjection = graphics->GetViewProjectionMatrix();
+        glUniformMatrix4fv(m_Shader->GetModelViewProjectionUniform(), 1, 0, &viewProjection[0][0]);
+        glUniform1i(m_Shader->GetTextureUniform(), 0);
+        
         //Bind the texture
         graphics->BindTexture(GetTexture());
         
-        //Enable blending if the texture has an alpha channel
+        //Enable blending if the texture has an alpha channel, the Graphics service skips the call if the state is already set
         if(GetFormat() == GL_RGBA || m_Color.Alpha() != 1.0f)
         {
             graphics->EnableBlending();
         }
+        else
+        {
+            graphics->DisableBlending();
+        }
         
-        //Draw the texture
-        glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+        //Draw all the quads, the vertex array is left bound until another one is bound
+        graphics->AddDrawCall();
+        glDrawArrays(GL_TRIANGLES, 0, (GLsizei)(aModelMatrices.size() * TEXTURE_FRAME_BATCH_VERTICES_PER_QUAD));
+    }
+    
+    bool TextureFrame::DrawInstancedQuads(const vector<mat4>& aModelMatrices, const vector<SourceFrame>* aSourceFrames)
+    {
+        //Get the instanced shader the first time the TextureFrame draws instanced quads
+        if(m_InstancedShader == nullptr)
+        {
+            m_InstancedShader = ServiceLocator::GetShaderManager()->GetPassthroughTextureInstancedShader();
+        }
         
-        //Unbind the vertex array
-        graphics->BindVertexArray(0);
+        //Safety check the instanced shader, if it didn't load or validate the vertex buffer path is used instead
+        if(m_InstancedShader == nullptr || m_InstancedShader->IsValid() == false)
+        {
+            return false;
+        }
+        
+        //Set the shader to be used
+        m_InstancedShader->Use();
         
-        //Disable blending, if we did in fact have it enabled
+        //Fill the instance buffer, this binds the instanced vertex array object
+        UpdateInstanceBuffer(aModelMatrices, aSourceFrames);
+        
+        //Each instance has its own model matrix, only the view projection matrix and the texture size are uniforms
+        Graphics* graphics = ServiceLocator::GetGraphics();
+        mat4 viewProjection = graphics->GetViewProjectionMatrix();
+        vec2 textureSize = vec2(m_Texture->GetSize());
+        glUniformMatrix4fv(m_InstancedShader->GetViewProjectionUniform(), 1, 0, &viewProjection[0][0]);
+        glUniform2f(m_InstancedShader->GetTextureSizeUniform(), textureSize.x, textureSize.y);
+        glUniform1i(m_InstancedShader->GetTextureUniform(), 0);
+        
+        //Bind the texture
+        graphics->BindTexture(GetTexture());
+        
+        //Enable blending if the texture has an alpha channel, the Graphics service skips the call if the state is already set
         if(GetFormat() == GL_RGBA || m_Color.Alpha() != 1.0f)
+        {
+            graphics->EnableBlending();
+        }
+        else
         {
             graphics->DisableBlending();
         }
+        
+        //Draw the unit quad once for each instance, the vertex array is left bound until another one is bound
+        graphics->AddDrawCall();
+        glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, TEXTURE_FRAME_VERTEX_COUNT, (GLsizei)aModelMatrices.size());
+        return true;
     }
     
     unsigned int TextureFrame::GetFormat()
@@ -180,6 +359,11 @@ namespace GameDev2D
         return "";
     }
     
+    string TextureFrame::GetAtlasKey()
+    {
+        return m_AtlasKey;
+    }
+    
     void TextureFrame::SetSourceFrame(SourceFrame aSourceFrame)
     {
         //Set the source frame
@@ -263,6 +447,23 @@ namespace GameDev2D
         }
     }
     
+    void TextureFrame::ReloadSourceFrame(SourceFrame* aAtlasFrame, uvec2 aPreviousTextureSize)
+    {
+        //Set the reloaded atlas frame, or resize the source frame if it covered the whole texture
+        if(aAtlasFrame != nullptr)
+        {
+            m_SourceFrame.position = aAtlasFrame->position;
+            m_SourceFrame.size = aAtlasFrame->size;
+        }
+        else if(m_AtlasKey == "" && m_SourceFrame.position == vec2(0.0f, 0.0f) && m_SourceFrame.size == vec2(aPreviousTextureSize))
+        {
+            m_SourceFrame.size = vec2(m_Texture->GetSize());
+        }
+        
+        //The uv coordinates depend on the texture's size, update the vertex buffer even if the source frame didn't change
+        UpdateVertexBuffer(BufferObjectVertex | BufferObjectUvCoordinates);
+    }
+    
     void TextureFrame::UpdateVertexBuffer(unsigned int aBufferObjectType)
     {
         //If the shader hasn't been set we can't update the vertex buffer, return
@@ -295,10 +496,10 @@ namespace GameDev2D
             //Bind the VBO
             glBindBuffer(GL_ARRAY_BUFFER, m_VertexBufferObject);
 
-            //Create an array for the vertices
+            //Create an array for the vertices, it is small enough to live on the stack
             const int vertexSize = 2;
             const int vertexCount = 4;
-            float* vertices = new float[vertexSize * vertexCount];
+            float vertices[vertexSize * vertexCount];
             
             //Initialize the vertices array
             vertices[0] = 0.0f;                     vertices[1] = 0.0f;
@@ -315,9 +516,6 @@ namespace GameDev2D
 
             //Set the shader's attribute for the vertices
             glVertexAttribPointer(verticesIndex, vertexSize, GL_FLOAT, GL_FALSE, 0, 0);
-            
-            //Delete the vertices array
-            SafeDeleteArray(vertices);
         }
         
         //Do we need to update the uv coordinates?
@@ -338,10 +536,10 @@ namespace GameDev2D
             float x2 = (float)(m_SourceFrame.position.x + m_SourceFrame.size.x) / (float)m_Texture->GetSize().x;
             float y2 = 1.0f - (m_SourceFrame.position.y / (float)m_Texture->GetSize().y);
             
-            //Create the uv coordinates array
+            //Create the uv coordinates array, it is small enough to live on the stack
             const int uvSize = 2;
             const int uvCount = 4;
-            float* uvCoordinates = new float[uvSize * uvCount];
+            float uvCoordinates[uvSize * uvCount];
             
             //Initialize the uv coordinates array
             uvCoordinates[0] = x1;  uvCoordinates[1] = y1;
@@ -358,9 +556,6 @@ namespace GameDev2D
             
             //Set the shader's attribute for the uv coordinates
             glVertexAttribPointer(uvIndex, uvSize, GL_FLOAT, GL_FALSE, 0, 0);
-            
-            //Delete the uv coordinates array
-            SafeDeleteArray(uvCoordinates);
         }
         
         //Do we need to update the colors?
@@ -375,10 +570,10 @@ namespace GameDev2D
             //Bind the colors buffer
             glBindBuffer(GL_ARRAY_BUFFER, m_ColorsBufferObject);
             
-            //Create the colors array
+            //Create the colors array, it is small enough to live on the stack
             const int colorSize = 4;
             const int colorCount = 4;
-            float* colors = new float[colorSize * colorCount];
+            float colors[colorSize * colorCount];
             
             //Initialize the colors array
             for(int i = 0; i < colorCount; i++)
@@ -399,12 +594,154 @@ namespace GameDev2D
             
             //Set the shader's attribute for the colors
             glVertexAttribPointer(colorIndex, colorSize, GL_FLOAT, GL_FALSE, 0, 0);
-            
-            //Delete the colors array
-            SafeDeleteArray(colors);
         }
         
         //Unbind the VAO
         ServiceLocator::GetGraphics()->BindVertexArray(0);
     }
+    
+    void TextureFrame::UpdateBatchVertexBuffer(const vector<mat4>& aModelMatrices, const vector<SourceFrame>* aSourceFrames)
+    {
+        //If the VAO hasn't been generated yet, generate one and the VBO that goes with it
+        if(m_BatchVertexArrayObject == 0)
+        {
+            glGenVertexArrays(1, &m_BatchVertexArrayObject);
+            glGenBuffers(1, &m_BatchVertexBufferObject);
+            
+            //Bind the VAO and VBO
+            ServiceLocator::GetGraphics()->BindVertexArray(m_BatchVertexArrayObject);
+            glBindBuffer(GL_ARRAY_BUFFER, m_BatchVertexBufferObject);
+            
+            //Set the shader's attributes, the vertex data is interleaved: x, y, u, v, r, g, b, a
+            GLsizei stride = sizeof(float) * TEXTURE_FRAME_BATCH_FLOATS_PER_VERTEX;
+            int verticesIndex = m_Shader->GetAttribute("a_vertices");
+            glEnableVertexAttribArray(verticesIndex);
+            glVertexAttribPointer(verticesIndex, 2, GL_FLOAT, GL_FALSE, stride, (void*)0);
+            
+            int uvIndex = m_Shader->GetAttribute("a_textureCoordinates");
+            glEnableVertexAttribArray(uvIndex);
+            glVertexAttribPointer(uvIndex, 2, GL_FLOAT, GL_FALSE, stride, (void*)(sizeof(float) * 2));
+            
+            int colorIndex = m_Shader->GetAttribute("a_textureColor");
+            glEnableVertexAttribArray(colorIndex);
+            glVertexAttribPointer(colorIndex, 4, GL_FLOAT, GL_FALSE, stride, (void*)(sizeof(float) * 4));
+        }
+        else
+        {
+            //Bind the VAO and VBO
+            ServiceLocator::GetGraphics()->BindVertexArray(m_BatchVertexArrayObject);
+            glBindBuffer(GL_ARRAY_BUFFER, m_BatchVertexBufferObject);
+        }
+        
+        //Size the vertices array, the capacity is kept between draws
+        m_BatchVertices.resize(aModelMatrices.size() * TEXTURE_FRAME_BATCH_VERTICES_PER_QUAD * TEXTURE_FRAME_BATCH_FLOATS_PER_VERTEX);
+        
+        //Transform each quad by its model matrix
+        vec2 textureSize = vec2(m_Texture->GetSize());
+        unsigned int offset = 0;
+        for(unsigned int i = 0; i < aModelMatrices.size(); i++)
+        {
+            //Get the quad's source frame
+            const SourceFrame& sourceFrame = aSourceFrames != nullptr ? aSourceFrames->at(i) : m_SourceFrame;
+        
+            //Build the UV Coordinates, the same as UpdateVertexBuffer()
+            float x1 = sourceFrame.position.x / textureSize.x;
+            float y1 = 1.0f - ((sourceFrame.position.y + sourceFrame.size.y) / textureSize.y);
+            float x2 = (sourceFrame.position.x + sourceFrame.size.x) / textureSize.x;
+            float y2 = 1.0f - (sourceFrame.position.y / textureSize.y);
+            
+            //The quad's corners and uv coordinates, as two triangles
+            const vec2 corners[TEXTURE_FRAME_BATCH_VERTICES_PER_QUAD] = { vec2(0.0f, 0.0f), vec2(sourceFrame.size.x, 0.0f), vec2(0.0f, sourceFrame.size.y),
+                                                                           vec2(0.0f, sourceFrame.size.y), vec2(sourceFrame.size.x, 0.0f), vec2(sourceFrame.size.x, sourceFrame.size.y) };
+            const vec2 uvCoordinates[TEXTURE_FRAME_BATCH_VERTICES_PER_QUAD] = { vec2(x1, y1), vec2(x2, y1), vec2(x1, y2), vec2(x1, y2), vec2(x2, y1), vec2(x2, y2) };
+            
+            for(unsigned int j = 0; j < TEXTURE_FRAME_BATCH_VERTICES_PER_QUAD; j++)
+            {
+                vec4 vertex = aModelMatrices.at(i) * vec4(corners[j].x, corners[j].y, 0.0f, 1.0f);
+                m_BatchVertices[offset++] = vertex.x;
+                m_BatchVertices[offset++] = vertex.y;
+                m_BatchVertices[offset++] = uvCoordinates[j].x;
+                m_BatchVertices[offset++] = uvCoordinates[j].y;
+                m_BatchVertices[offset++] = m_Color.Red();
+                m_BatchVertices[offset++] = m_Color.Green();
+                m_BatchVertices[offset++] = m_Color.Blue();
+                m_BatchVertices[offset++] = m_Color.Alpha();
+            }
+        }
+        
+        //Set the vertex buffer data
+        glBufferData(GL_ARRAY_BUFFER, sizeof(float) * m_BatchVertices.size(), &m_BatchVertices[0], GL_STREAM_DRAW);
+    }
+    
+    void TextureFrame::UpdateInstanceBuffer(const vector<mat4>& aModelMatrices, const vector<SourceFrame>* aSourceFrames)
+    {
+        //If the VAO hasn't been generated yet, generate one and the VBOs that go with it
+        if(m_InstancedVertexArrayObject == 0)
+        {
+            glGenVertexArrays(1, &m_InstancedVertexArrayObject);
+            glGenBuffers(1, &m_InstancedQuadBufferObject);
+            glGenBuffers(1, &m_InstanceBufferObject);
+            
+            //Bind the VAO
+            ServiceLocator::GetGraphics()->BindVertexArray(m_InstancedVertexArrayObject);
+            
+            //Fill the quad buffer with a unit quad, the shader scales it by each instance's source frame size
+            const float quad[TEXTURE_FRAME_VERTEX_COUNT * 2] = { 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f };
+            glBindBuffer(GL_ARRAY_BUFFER, m_InstancedQuadBufferObject);
+            glBufferData(GL_ARRAY_BUFFER, sizeof(quad), quad, GL_STATIC_DRAW);
+            
+            //Set the shader's attribute for the unit quad
+            int verticesIndex = m_InstancedShader->GetAttribute("a_vertices");
+            glEnableVertexAttribArray(verticesIndex);
+            glVertexAttribPointer(verticesIndex, 2, GL_FLOAT, GL_FALSE, 0, (void*)0);
+            
+            //Set the shader's per instance attributes, the instance data is interleaved: the model matrix's
+            //four columns, the source frame (x, y, width, height) and the color (r, g, b, a)
+            glBindBuffer(GL_ARRAY_BUFFER, m_InstanceBufferObject);
+            GLsizei stride = sizeof(float) * TEXTURE_FRAME_INSTANCE_FLOATS;
+            const unsigned int instanceAttributeCount = 6;
+            const char* instanceAttributes[instanceAttributeCount] = { "a_instanceModel0", "a_instanceModel1", "a_instanceModel2", "a_instanceModel3", "a_instanceSourceFrame", "a_instanceColor" };
+            for(unsigned int i = 0; i < instanceAttributeCount; i++)
+            {
+                int index = m_InstancedShader->GetAttribute(instanceAttributes[i]);
+                glEnableVertexAttribArray(index);
+                glVertexAttribPointer(index, 4, GL_FLOAT, GL_FALSE, stride, (void*)(sizeof(float) * 4 * i));
+                glVertexAttribDivisor(index, 1);
+            }
+        }
+        else
+        {
+            //Bind the VAO and the instance VBO
+            ServiceLocator::GetGraphics()->BindVertexArray(m_InstancedVertexArrayObject);
+            glBindBuffer(GL_ARRAY_BUFFER, m_InstanceBufferObject);
+        }
+        
+        //Size the instance data array, the capacity is kept between draws
+        m_InstanceData.resize(aModelMatrices.size() * TEXTURE_FRAME_INSTANCE_FLOATS);
+        
+        //Copy each instance's model matrix, source frame and color, unlike the batch
+        //vertex buffer nothing is transformed on the CPU
+        unsigned int offset = 0;
+        for(unsigned int i = 0; i < aModelMatrices.size(); i++)
+        {
+            //Get the instance's source frame
+            const SourceFrame& sourceFrame = aSourceFrames != nullptr ? aSourceFrames->at(i) : m_SourceFrame;
+            
+            //The model matrix is column major, the same layout the shader expects
+            memcpy(&m_InstanceData[offset], &aModelMatrices.at(i)[0][0], sizeof(float) * 16);
+            offset += 16;
+            
+            m_InstanceData[offset++] = sourceFrame.position.x;
+            m_InstanceData[offset++] = sourceFrame.position.y;
+            m_InstanceData[offset++] = sourceFrame.size.x;
+            m_InstanceData[offset++] = sourceFrame.size.y;
+            m_InstanceData[offset++] = m_Color.Red();
+            m_InstanceData[offset++] = m_Color.Green();
+            m_InstanceData[offset++] = m_Color.Blue();
+            m_InstanceData[offset++] = m_Color.Alpha();
+        }
+        
+        //Set the instance buffer data
+        glBufferData(GL_ARRAY_BUFFER, sizeof(float) * m_InstanceData.size(), &m_InstanceData[0], GL_STREAM_DRAW);
+    }
 }
\ No newline at end of file
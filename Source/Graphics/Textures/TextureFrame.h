@@ -18,6 +18,9 @@ namespace GameDev2D
 {
     //TextureFrame constant
     const unsigned int TEXTURE_FRAME_VERTEX_COUNT = 4;
+    const unsigned int TEXTURE_FRAME_BATCH_VERTICES_PER_QUAD = 6;
+    const unsigned int TEXTURE_FRAME_BATCH_FLOATS_PER_VERTEX = 8;
+    const unsigned int TEXTURE_FRAME_INSTANCE_FLOATS = 24;
     
     //Forward declaration
     class Shader;
@@ -66,12 +69,23 @@ namespace GameDev2D
         //Draw the TextureFrame for a given model matrix
         void Draw(mat4 modelMatrix);
         
+        //Draw the TextureFrame once for each model matrix in a single draw call. If instancing is enabled the quads are
+        //drawn with one instanced draw call, otherwise they are transformed on the CPU and uploaded into one shared vertex buffer
+        void DrawBatch(const vector<mat4>& modelMatrices);
+        
+        //Draw a quad for each model matrix in a single draw call, each quad shows its own source frame of
+        //the Texture. Used to draw different frames of the same texture atlas in one batch
+        void DrawBatch(const vector<mat4>& modelMatrices, const vector<SourceFrame>& sourceFrames);
+        
         //Returns the format of the Texture
         unsigned int GetFormat();
         
         //Returns the filename of the Texture
         string GetFilename();
         
+        //Returns the atlas key the TextureFrame was loaded with, empty if it wasn't loaded from a texture atlas
+        string GetAtlasKey();
+        
         //Sets the source frame of the Texture to render
         void SetSourceFrame(SourceFrame sourceFrame);
         
@@ -95,10 +109,15 @@ namespace GameDev2D
         Texture* GetTexture() const;
         void SetTexture(Texture* texture, bool ownsTexture);
         
+        //Called from the TextureManager when the Texture or its atlas is hot-reloaded, the source frame is set to the reloaded
+        //atlas frame (if there is one). A source frame that covered the whole previous Texture is resized to the new Texture
+        void ReloadSourceFrame(SourceFrame* atlasFrame, uvec2 previousTextureSize);
+        
         //Friend classes that need to access protected methods
         friend class TextureManager;
         friend class RenderTarget;
         friend class Graphics;
+        friend class DebugRenderer;
     
     private:
         //Enum of the vertex buffer elements
@@ -112,12 +131,25 @@ namespace GameDev2D
     
         //Conveniance method to update part of the vertex buffer
         virtual void UpdateVertexBuffer(unsigned int bufferObjectType);
+        
+        //Conveniance method that draws the batched quads, if the source frames are null every quad uses the TextureFrame's source frame
+        void DrawBatchQuads(const vector<mat4>& modelMatrices, const vector<SourceFrame>* sourceFrames);
+        
+        //Conveniance method to fill the batch vertex buffer, leaves the batch vertex array bound
+        void UpdateBatchVertexBuffer(const vector<mat4>& modelMatrices, const vector<SourceFrame>* sourceFrames);
+        
+        //Conveniance method that draws the batched quads with one instanced draw call, returns false if the instanced shader isn't available
+        bool DrawInstancedQuads(const vector<mat4>& modelMatrices, const vector<SourceFrame>* sourceFrames);
+        
+        //Conveniance method to fill the instance buffer with a model matrix, source frame and color for each quad, leaves the instanced vertex array bound
+        void UpdateInstanceBuffer(const vector<mat4>& modelMatrices, const vector<SourceFrame>* sourceFrames);
 
         //Member variables
         Texture* m_Texture;
         Shader* m_Shader;
         Color m_Color;
         SourceFrame m_SourceFrame;
+        string m_AtlasKey;
         bool m_OwnsTexture;
         
         //VAO and VBO member variables
@@ -125,6 +157,19 @@ namespace GameDev2D
         unsigned int m_VertexBufferObject;
         unsigned int m_UvCoordinatesBufferObject;
         unsigned int m_ColorsBufferObject;
+        
+        //Batch VAO and VBO member variables, the batch vertex buffer interleaves the vertices, uv coordinates and colors
+        unsigned int m_BatchVertexArrayObject;
+        unsigned int m_BatchVertexBufferObject;
+        vector<float> m_BatchVertices;
+        
+        //Instanced VAO and VBO member variables, the quad buffer holds a unit quad and the instance buffer
+        //interleaves each instance's model matrix, source frame and color
+        Shader* m_InstancedShader;
+        unsigned int m_InstancedVertexArrayObject;
+        unsigned int m_InstancedQuadBufferObject;
+        unsigned int m_InstanceBufferObject;
+        vector<float> m_InstanceData;
     };
 }
 
@@ -0,0 +1,348 @@
+//
+//  AtlasFile.cpp
+//  GameDev2D
+//
+
+#include "AtlasFile.h"
+#include "../Services/ServiceLocator.h"
+#include "../Platforms/PlatformLayer.h"
+
+
+namespace GameDev2D
+{
+    AtlasFile::AtlasFile(const string& aJsonPath) : BaseObject("AtlasFile"),
+        m_NumberOfAllocations(0),
+        m_IsLoaded(false),
+        m_Depth(0),
+        m_IsParsingFrames(false),
+        m_IsParsingFrameRect(false),
+        m_HasFrameKey(false)
+    {
+        //Load the atlas, and time how long it takes
+        unsigned long long start = ServiceLocator::GetPlatformLayer()->GetTimeNanoseconds();
+        const char* source = Load(aJsonPath);
+        unsigned long long end = ServiceLocator::GetPlatformLayer()->GetTimeNanoseconds();
+        m_IsLoaded = source != nullptr;
+
+#if LOG_ATLAS_FILE_LOAD_DATA
+        if(m_IsLoaded == true)
+        {
+            Log(VerbosityLevel_Debug, "Loaded atlas: %s from the %s, %u frames in %.3fms, %u allocations", aJsonPath.c_str(), source, GetNumberOfFrames(), (double)(end - start) / 1000000.0, m_NumberOfAllocations);
+        }
+#endif
+    }
+
+    AtlasFile::~AtlasFile()
+    {
+
+    }
+
+    bool AtlasFile::IsLoaded()
+    {
+        return m_IsLoaded;
+    }
+
+    unsigned int AtlasFile::GetNumberOfFrames()
+    {
+        return (unsigned int)m_Frames.size();
+    }
+
+    const AtlasFrameData& AtlasFile::GetFrame(unsigned int aIndex)
+    {
+        return m_Frames.at(aIndex);
+    }
+
+    string AtlasFile::GetKey(unsigned int aIndex)
+    {
+        const AtlasFrameData& frame = m_Frames.at(aIndex);
+        return m_Keys.substr(frame.keyOffset, frame.keyLength);
+    }
+
+    const char* AtlasFile::Load(const string& aJsonPath)
+    {
+#if CACHE_ATLAS_METADATA
+        //Get the json file's modification time, it is compared with the time saved in the cache
+        unsigned long long modificationTime = ServiceLocator::GetPlatformLayer()->GetModificationTimeForFileAtPath(aJsonPath);
+
+        //The cache file is in the working directory, the resource directory can be read-only
+        string filename = aJsonPath.substr(aJsonPath.find_last_of("/\\") + 1);
+        string cachePath = ServiceLocator::GetPlatformLayer()->GetWorkingDirectory() + "/" + filename + ATLAS_FILE_CACHE_EXTENSION;
+
+        //Open the cache file and read its header, if there is one
+        AtlasCacheHeader header;
+        ifstream cacheStream;
+        cacheStream.open(cachePath.c_str(), ifstream::in | ifstream::binary);
+        bool hasCache = cacheStream.is_open() == true && cacheStream.read((char*)&header, sizeof(AtlasCacheHeader)).good() == true;
+        hasCache = hasCache == true && header.magic == ATLAS_FILE_CACHE_MAGIC && header.version == ATLAS_FILE_CACHE_VERSION;
+
+        //If the json file hasn't been modified since the cache was written, load the cache
+        if(hasCache == true && modificationTime != 0 && header.modificationTime == modificationTime)
+        {
+            if(ReadCache(cacheStream, header) == true)
+            {
+                return "cache";
+            }
+            hasCache = false;
+        }
+#endif
+
+        //Read the json file
+        string json;
+        if(ReadFile(aJsonPath, json) == false)
+        {
+            Error(false, "Failed to read atlas json file: %s", aJsonPath.c_str());
+            return nullptr;
+        }
+
+#if CACHE_ATLAS_METADATA
+        //The json file was touched, if its contents haven't changed then load the cache and save the new modification time
+        unsigned long long hash = Hash(json);
+        if(hasCache == true && header.hash == hash)
+        {
+            if(ReadCache(cacheStream, header) == true)
+            {
+                WriteCache(cachePath, modificationTime, hash);
+                return "cache";
+            }
+        }
+        cacheStream.close();
+#endif
+
+        //Parse the json, the frames are added as they are parsed
+        JsonStreamReader jsonStreamReader;
+        if(jsonStreamReader.Parse(json, this) == false)
+        {
+            Error(false, "Failed to parse atlas json file: %s", aJsonPath.c_str());
+            m_Frames.clear();
+            m_Keys.clear();
+            return nullptr;
+        }
+
+#if CACHE_ATLAS_METADATA
+        //Write the cache, so the json doesn't have to be parsed next time
+        if(WriteCache(cachePath, modificationTime, hash) == false)
+        {
+            Log(VerbosityLevel_Debug, "Failed to write the atlas cache file: %s", cachePath.c_str());
+        }
+#endif
+
+        return "json";
+    }
+
+    bool AtlasFile::ReadFile(const string& aPath, string& aBuffer)
+    {
+        //Open the input stream at the end of the file, to get the file's size
+        ifstream inputStream;
+        inputStream.open(aPath.c_str(), ifstream::in | ifstream::binary | ifstream::ate);
+        if(inputStream.is_open() == false)
+        {
+            return false;
+        }
+
+        //Read the whole file with one allocation
+        streamoff size = inputStream.tellg();
+        inputStream.seekg(0, ifstream::beg);
+        aBuffer.resize((size_t)size);
+        m_NumberOfAllocations++;
+
+        inputStream.read(&aBuffer[0], size);
+        return inputStream.good() == true || inputStream.eof() == true;
+    }
+
+    bool AtlasFile::ReadCache(ifstream& aInputStream, const AtlasCacheHeader& aHeader)
+    {
+        //Read the frames and key pool, they are sized up front so each is a single allocation
+        m_Frames.resize(aHeader.numberOfFrames);
+        m_Keys.resize(aHeader.keysSize);
+        m_NumberOfAllocations += 2;
+
+        if(aHeader.numberOfFrames > 0)
+        {
+            aInputStream.read((char*)&m_Frames[0], aHeader.numberOfFrames * sizeof(AtlasFrameData));
+        }
+        if(aHeader.keysSize > 0)
+        {
+            aInputStream.read(&m_Keys[0], aHeader.keysSize);
+        }
+
+        //Safety check that the whole cache was read and that the keys are in the key pool
+        bool success = aInputStream.good() == true;
+        for(unsigned int i = 0; i < aHeader.numberOfFrames && success == true; i++)
+        {
+            success = (unsigned long long)m_Frames[i].keyOffset + m_Frames[i].keyLength <= aHeader.keysSize;
+        }
+
+        if(success == false)
+        {
+            m_Frames.clear();
+            m_Keys.clear();
+        }
+        return success;
+    }
+
+    bool AtlasFile::WriteCache(const string& aCachePath, unsigned long long aModificationTime, unsigned long long aHash)
+    {
+        //Create output stream (write to a file), for the temporary file
+        string temporaryPath = aCachePath + ATLAS_FILE_TEMPORARY_FILE_EXTENSION;
+        ofstream outputStream;
+        outputStream.open(temporaryPath.c_str(), ofstream::out | ofstream::binary | ofstream::trunc);
+
+        //Check if the file opened
+        if(outputStream.is_open() == false)
+        {
+            return false;
+        }
+
+        //Write the header, followed by the frames and the key pool
+        AtlasCacheHeader header;
+        header.magic = ATLAS_FILE_CACHE_MAGIC;
+        header.version = ATLAS_FILE_CACHE_VERSION;
+        header.modificationTime = aModificationTime;
+        header.hash = aHash;
+        header.numberOfFrames = (unsigned int)m_Frames.size();
+        header.keysSize = (unsigned int)m_Keys.size();
+        outputStream.write((const char*)&header, sizeof(AtlasCacheHeader));
+
+        if(m_Frames.size() > 0)
+        {
+            outputStream.write((const char*)&m_Frames[0], m_Frames.size() * sizeof(AtlasFrameData));
+        }
+        outputStream.write(m_Keys.c_str(), m_Keys.size());
+        outputStream.close();
+
+        //If the write failed, delete the temporary file and leave the old cache untouched
+        if(outputStream.fail() == true)
+        {
+            remove(temporaryPath.c_str());
+            return false;
+        }
+
+        //The temporary file is complete, replace the old cache with it
+        return ServiceLocator::GetPlatformLayer()->ReplaceFileAtPath(temporaryPath, aCachePath);
+    }
+
+    unsigned long long AtlasFile::Hash(const string& aBuffer)
+    {
+        unsigned long long hash = 14695981039346656037ULL;
+        for(size_t i = 0; i < aBuffer.length(); i++)
+        {
+            hash ^= (unsigned char)aBuffer[i];
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    void AtlasFile::AddFrame(const AtlasFrameData& aFrame, const string& aKey)
+    {
+        //Count the allocations made when the frames vector or the key pool has to grow
+        size_t framesCapacity = m_Frames.capacity();
+        size_t keysCapacity = m_Keys.capacity();
+
+        AtlasFrameData frame = aFrame;
+        frame.keyOffset = (unsigned int)m_Keys.length();
+        frame.keyLength = (unsigned int)aKey.length();
+        m_Keys.append(aKey);
+        m_Frames.push_back(frame);
+
+        if(m_Frames.capacity() != framesCapacity)
+        {
+            m_NumberOfAllocations++;
+        }
+        if(m_Keys.capacity() != keysCapacity)
+        {
+            m_NumberOfAllocations++;
+        }
+    }
+
+    void AtlasFile::StartObject()
+    {
+        m_Depth++;
+
+        //Is it the start of a frame in the frames array, or the start of a frame's rect?
+        if(m_IsParsingFrames == true && m_Depth == 3)
+        {
+            m_Frame = AtlasFrameData();
+            m_HasFrameKey = false;
+        }
+        else if(m_IsParsingFrames == true && m_Depth == 4 && m_Key == "frame")
+        {
+            m_IsParsingFrameRect = true;
+        }
+    }
+
+    void AtlasFile::EndObject()
+    {
+        //Is it the end of a frame's rect, or the end of a frame? The frame is only added if it had a filename
+        if(m_IsParsingFrameRect == true && m_Depth == 4)
+        {
+            m_IsParsingFrameRect = false;
+        }
+        else if(m_IsParsingFrames == true && m_Depth == 3 && m_HasFrameKey == true)
+        {
+            AddFrame(m_Frame, m_FrameKey);
+        }
+
+        m_Depth--;
+    }
+
+    void AtlasFile::StartArray()
+    {
+        m_Depth++;
+
+        //The frames array is in the root object
+        if(m_Depth == 2 && m_Key == "frames")
+        {
+            m_IsParsingFrames = true;
+        }
+    }
+
+    void AtlasFile::EndArray()
+    {
+        if(m_Depth == 2)
+        {
+            m_IsParsingFrames = false;
+        }
+
+        m_Depth--;
+    }
+
+    void AtlasFile::Key(const string& aKey)
+    {
+        //Assigning keeps the string's capacity, so the keys don't allocate
+        m_Key = aKey;
+    }
+
+    void AtlasFile::String(const string& aValue)
+    {
+        //The frame's filename is the atlas key
+        if(m_IsParsingFrames == true && m_Depth == 3 && m_Key == "filename")
+        {
+            m_FrameKey = aValue;
+            m_HasFrameKey = true;
+        }
+    }
+
+    void AtlasFile::Number(double aValue)
+    {
+        //The frame's rect
+        if(m_IsParsingFrameRect == true && m_Depth == 4)
+        {
+            if(m_Key == "x")
+            {
+                m_Frame.x = (float)aValue;
+            }
+            else if(m_Key == "y")
+            {
+                m_Frame.y = (float)aValue;
+            }
+            else if(m_Key == "w")
+            {
+                m_Frame.width = (float)aValue;
+            }
+            else if(m_Key == "h")
+            {
+                m_Frame.height = (float)aValue;
+            }
+        }
+    }
+}
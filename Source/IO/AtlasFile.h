@@ -0,0 +1,113 @@
+//
+//  AtlasFile.h
+//  GameDev2D
+//
+
+#ifndef __GameDev2D__AtlasFile__
+#define __GameDev2D__AtlasFile__
+
+#include "../Core/BaseObject.h"
+#include "JsonStreamReader.h"
+#include <vector>
+
+
+using namespace std;
+
+namespace GameDev2D
+{
+    //Local constants
+    const unsigned int ATLAS_FILE_CACHE_MAGIC = 0x534C5441; //'ATLS'
+    const unsigned int ATLAS_FILE_CACHE_VERSION = 1;
+    const string ATLAS_FILE_CACHE_EXTENSION = ".cache";
+    const string ATLAS_FILE_TEMPORARY_FILE_EXTENSION = ".tmp";
+
+    //The frame data for an atlas key, the key is stored in the AtlasFile's key pool at the offset
+    struct AtlasFrameData
+    {
+        unsigned int keyOffset;
+        unsigned int keyLength;
+        float x;
+        float y;
+        float width;
+        float height;
+    };
+
+    //The header of the binary cache file, followed by the frame data and the key pool
+    struct AtlasCacheHeader
+    {
+        unsigned int magic;
+        unsigned int version;
+        unsigned long long modificationTime;
+        unsigned long long hash;
+        unsigned int numberOfFrames;
+        unsigned int keysSize;
+    };
+
+    //The AtlasFile loads the frames of a TexturePacker json file (array format), in the order they appear in the json.
+    //The json is parsed with the JsonStreamReader, then the frames are written to a binary cache file in the working
+    //directory. The next time the atlas is loaded the cache is used if the json's modification time hasn't changed,
+    //or if its contents hash to the same value. The AtlasFile doesn't use any services other than the PlatformLayer,
+    //it is safe to load on a JobSystem worker thread
+    class AtlasFile : public BaseObject, public JsonStreamHandler
+    {
+    public:
+        //Loads the atlas json file at the path, or its cache if it is up to date. Logs an Error if the json can't be parsed
+        AtlasFile(const string& jsonPath);
+        ~AtlasFile();
+
+        //Returns wether the atlas was loaded
+        bool IsLoaded();
+
+        //Returns the number of frames in the atlas
+        unsigned int GetNumberOfFrames();
+
+        //Returns the frame data and the atlas key of the frame at the index
+        const AtlasFrameData& GetFrame(unsigned int index);
+        string GetKey(unsigned int index);
+
+    private:
+        //Loads the atlas from the json file or the cache file, returns the source of the frames ("json" or "cache") or null if it failed
+        const char* Load(const string& jsonPath);
+
+        //Reads the entire file at the path into the buffer
+        bool ReadFile(const string& path, string& buffer);
+
+        //Reads the frames and key pool that follow the cache header
+        bool ReadCache(ifstream& inputStream, const AtlasCacheHeader& header);
+
+        //Writes the frames and key pool to the cache file, through a temporary file so that a partial cache is never read
+        bool WriteCache(const string& cachePath, unsigned long long modificationTime, unsigned long long hash);
+
+        //Returns the FNV-1a hash of the buffer
+        static unsigned long long Hash(const string& buffer);
+
+        //Adds a frame, counts the allocations made when the frames vector or the key pool grows
+        void AddFrame(const AtlasFrameData& frame, const string& key);
+
+        //Inherited from JsonStreamHandler, picks the frames out of the json as it is parsed
+        void StartObject();
+        void EndObject();
+        void StartArray();
+        void EndArray();
+        void Key(const string& key);
+        void String(const string& value);
+        void Number(double value);
+
+        //Member variables
+        vector<AtlasFrameData> m_Frames;
+        string m_Keys;
+        unsigned int m_NumberOfAllocations;
+        bool m_IsLoaded;
+
+        //Parsing member variables
+        unsigned int m_Depth;
+        bool m_IsParsingFrames;
+        bool m_IsParsingFrameRect;
+        bool m_HasFrameKey;
+        AtlasFrameData m_Frame;
+        string m_Key;
+        string m_FrameKey;
+    };
+}
+
+#endif /* defined(__GameDev2D__AtlasFile__) */
@@ -0,0 +1,439 @@
+//
+//  JsonStreamReader.cpp
+//  GameDev2D
+//
+
+#include "JsonStreamReader.h"
+#include <stdlib.h>
+
+
+namespace GameDev2D
+{
+    JsonStreamReader::JsonStreamReader() : BaseObject("JsonStreamReader"),
+        m_Start(nullptr),
+        m_Position(nullptr),
+        m_End(nullptr),
+        m_Handler(nullptr)
+    {
+
+    }
+
+    JsonStreamReader::~JsonStreamReader()
+    {
+
+    }
+
+    bool JsonStreamReader::Parse(const string& aJson, JsonStreamHandler* aHandler)
+    {
+        //Set the json buffer and the handler
+        m_Start = aJson.c_str();
+        m_Position = m_Start;
+        m_End = m_Start + aJson.length();
+        m_Handler = aHandler;
+
+        //Parse the root value, only whitespace can follow it
+        bool success = ParseValue(0);
+        if(success == true && SkipWhitespace() != 0)
+        {
+            success = false;
+        }
+
+        //Log where the parsing stopped
+        if(success == false)
+        {
+            Error(false, "Failed to parse json, unexpected character at offset %u", (unsigned int)(m_Position - m_Start));
+        }
+
+        m_Handler = nullptr;
+        return success;
+    }
+
+    bool JsonStreamReader::ParseValue(unsigned int aDepth)
+    {
+        //Determine the type of value from its first character
+        char character = SkipWhitespace();
+        switch(character)
+        {
+            case '{':
+                return ParseObject(aDepth + 1);
+
+            case '[':
+                return ParseArray(aDepth + 1);
+
+            case '"':
+                if(ParseString(m_Scratch) == true)
+                {
+                    m_Handler->String(m_Scratch);
+                    return true;
+                }
+                return false;
+
+            case 't':
+                if(ParseLiteral("true") == true)
+                {
+                    m_Handler->Bool(true);
+                    return true;
+                }
+                return false;
+
+            case 'f':
+                if(ParseLiteral("false") == true)
+                {
+                    m_Handler->Bool(false);
+                    return true;
+                }
+                return false;
+
+            case 'n':
+                if(ParseLiteral("null") == true)
+                {
+                    m_Handler->Null();
+                    return true;
+                }
+                return false;
+
+            default:
+                if(character == '-' || (character >= '0' && character <= '9'))
+                {
+                    return ParseNumber();
+                }
+                return false;
+        }
+    }
+
+    bool JsonStreamReader::ParseObject(unsigned int aDepth)
+    {
+        //Safety check the depth, deeply nested json would overflow the stack
+        if(aDepth > JSON_STREAM_READER_MAX_DEPTH)
+        {
+            return false;
+        }
+
+        //Skip the opening brace
+        m_Position++;
+        m_Handler->StartObject();
+
+        //Is the object empty?
+        if(SkipWhitespace() == '}')
+        {
+            m_Position++;
+            m_Handler->EndObject();
+            return true;
+        }
+
+        while(true)
+        {
+            //Parse the key, followed by a colon
+            if(SkipWhitespace() != '"' || ParseString(m_Scratch) == false)
+            {
+                return false;
+            }
+            m_Handler->Key(m_Scratch);
+
+            if(SkipWhitespace() != ':')
+            {
+                return false;
+            }
+            m_Position++;
+
+            //Parse the value
+            if(ParseValue(aDepth) == false)
+            {
+                return false;
+            }
+
+            //The value is followed by a comma or the closing brace
+            char character = SkipWhitespace();
+            m_Position++;
+            if(character == '}')
+            {
+                m_Handler->EndObject();
+                return true;
+            }
+            else if(character != ',')
+            {
+                m_Position--;
+                return false;
+            }
+        }
+    }
+
+    bool JsonStreamReader::ParseArray(unsigned int aDepth)
+    {
+        //Safety check the depth, deeply nested json would overflow the stack
+        if(aDepth > JSON_STREAM_READER_MAX_DEPTH)
+        {
+            return false;
+        }
+
+        //Skip the opening bracket
+        m_Position++;
+        m_Handler->StartArray();
+
+        //Is the array empty?
+        if(SkipWhitespace() == ']')
+        {
+            m_Position++;
+            m_Handler->EndArray();
+            return true;
+        }
+
+        while(true)
+        {
+            //Parse the value
+            if(ParseValue(aDepth) == false)
+            {
+                return false;
+            }
+
+            //The value is followed by a comma or the closing bracket
+            char character = SkipWhitespace();
+            m_Position++;
+            if(character == ']')
+            {
+                m_Handler->EndArray();
+                return true;
+            }
+            else if(character != ',')
+            {
+                m_Position--;
+                return false;
+            }
+        }
+    }
+
+    bool JsonStreamReader::ParseString(string& aValue)
+    {
+        //Skip the opening quote, the scratch string keeps its capacity between strings
+        m_Position++;
+        aValue.clear();
+
+        while(m_Position < m_End)
+        {
+            //Append the characters up to the next quote or escape sequence in one go
+            const char* start = m_Position;
+            while(m_Position < m_End && *m_Position != '"' && *m_Position != '\\')
+            {
+                m_Position++;
+            }
+            aValue.append(start, m_Position - start);
+
+            if(m_Position >= m_End)
+            {
+                break;
+            }
+
+            //Is it the closing quote?
+            if(*m_Position == '"')
+            {
+                m_Position++;
+                return true;
+            }
+
+            //Handle the escape sequence
+            m_Position++;
+            if(m_Position >= m_End)
+            {
+                break;
+            }
+
+            char escape = *m_Position;
+            m_Position++;
+            switch(escape)
+            {
+                case '"': aValue.push_back('"'); break;
+                case '\\': aValue.push_back('\\'); break;
+                case '/': aValue.push_back('/'); break;
+                case 'b': aValue.push_back('\b'); break;
+                case 'f': aValue.push_back('\f'); break;
+                case 'n': aValue.push_back('\n'); break;
+                case 'r': aValue.push_back('\r'); break;
+                case 't': aValue.push_back('\t'); break;
+
+                case 'u':
+                {
+                    unsigned int codePoint = 0;
+                    if(ParseHexDigits(codePoint) == false)
+                    {
+                        return false;
+                    }
+
+                    //Is it the first half of a surrogate pair? If it is, the second half must follow it
+                    if(codePoint >= 0xD800 && codePoint <= 0xDBFF)
+                    {
+                        unsigned int lowSurrogate = 0;
+                        if(m_End - m_Position < 2 || m_Position[0] != '\\' || m_Position[1] != 'u')
+                        {
+                            return false;
+                        }
+                        m_Position += 2;
+
+                        if(ParseHexDigits(lowSurrogate) == false || lowSurrogate < 0xDC00 || lowSurrogate > 0xDFFF)
+                        {
+                            return false;
+                        }
+                        codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (lowSurrogate - 0xDC00);
+                    }
+
+                    AppendCodePoint(codePoint, aValue);
+                    break;
+                }
+
+                default:
+                    m_Position--;
+                    return false;
+            }
+        }
+
+        //The string wasn't closed
+        return false;
+    }
+
+    bool JsonStreamReader::ParseNumber()
+    {
+        //Validate the number's format, strtod() accepts more than json does (hexadecimal, infinity, etc)
+        const char* start = m_Position;
+        if(*m_Position == '-')
+        {
+            m_Position++;
+        }
+
+        //The integer part, a leading zero can't be followed by more digits
+        if(m_Position < m_End && *m_Position == '0')
+        {
+            m_Position++;
+        }
+        else if(m_Position < m_End && *m_Position >= '1' && *m_Position <= '9')
+        {
+            while(m_Position < m_End && *m_Position >= '0' && *m_Position <= '9')
+            {
+                m_Position++;
+            }
+        }
+        else
+        {
+            return false;
+        }
+
+        //The fraction part
+        if(m_Position < m_End && *m_Position == '.')
+        {
+            m_Position++;
+            if(m_Position >= m_End || *m_Position < '0' || *m_Position > '9')
+            {
+                return false;
+            }
+            while(m_Position < m_End && *m_Position >= '0' && *m_Position <= '9')
+            {
+                m_Position++;
+            }
+        }
+
+        //The exponent part
+        if(m_Position < m_End && (*m_Position == 'e' || *m_Position == 'E'))
+        {
+            m_Position++;
+            if(m_Position < m_End && (*m_Position == '+' || *m_Position == '-'))
+            {
+                m_Position++;
+            }
+            if(m_Position >= m_End || *m_Position < '0' || *m_Position > '9')
+            {
+                return false;
+            }
+            while(m_Position < m_End && *m_Position >= '0' && *m_Position <= '9')
+            {
+                m_Position++;
+            }
+        }
+
+        //Convert the number, the json string is null terminated so strtod() stops at the end of the buffer
+        m_Handler->Number(strtod(start, nullptr));
+        return true;
+    }
+
+    bool JsonStreamReader::ParseLiteral(const char* aLiteral)
+    {
+        //Compare the literal one character at a time
+        while(*aLiteral != 0)
+        {
+            if(m_Position >= m_End || *m_Position != *aLiteral)
+            {
+                return false;
+            }
+            m_Position++;
+            aLiteral++;
+        }
+        return true;
+    }
+
+    void JsonStreamReader::AppendCodePoint(unsigned int aCodePoint, string& aValue)
+    {
+        if(aCodePoint < 0x80)
+        {
+            aValue.push_back((char)aCodePoint);
+        }
+        else if(aCodePoint < 0x800)
+        {
+            aValue.push_back((char)(0xC0 | (aCodePoint >> 6)));
+            aValue.push_back((char)(0x80 | (aCodePoint & 0x3F)));
+        }
+        else if(aCodePoint < 0x10000)
+        {
+            aValue.push_back((char)(0xE0 | (aCodePoint >> 12)));
+            aValue.push_back((char)(0x80 | ((aCodePoint >> 6) & 0x3F)));
+            aValue.push_back((char)(0x80 | (aCodePoint & 0x3F)));
+        }
+        else
+        {
+            aValue.push_back((char)(0xF0 | (aCodePoint >> 18)));
+            aValue.push_back((char)(0x80 | ((aCodePoint >> 12) & 0x3F)));
+            aValue.push_back((char)(0x80 | ((aCodePoint >> 6) & 0x3F)));
+            aValue.push_back((char)(0x80 | (aCodePoint & 0x3F)));
+        }
+    }
+
+    bool JsonStreamReader::ParseHexDigits(unsigned int& aValue)
+    {
+        aValue = 0;
+        for(unsigned int i = 0; i < 4; i++)
+        {
+            if(m_Position >= m_End)
+            {
+                return false;
+            }
+
+            char character = *m_Position;
+            unsigned int digit = 0;
+            if(character >= '0' && character <= '9')
+            {
+                digit = character - '0';
+            }
+            else if(character >= 'a' && character <= 'f')
+            {
+                digit = character - 'a' + 10;
+            }
+            else if(character >= 'A' && character <= 'F')
+            {
+                digit = character - 'A' + 10;
+            }
+            else
+            {
+                return false;
+            }
+
+            aValue = (aValue << 4) | digit;
+            m_Position++;
+        }
+        return true;
+    }
+
+    char JsonStreamReader::SkipWhitespace()
+    {
+        while(m_Position < m_End && (*m_Position == ' ' || *m_Position == '\t' || *m_Position == '\n' || *m_Position == '\r'))
+        {
+            m_Position++;
+        }
+        return m_Position < m_End ? *m_Position : 0;
+    }
+}
@@ -0,0 +1,85 @@
+//
+//  JsonStreamReader.h
+//  GameDev2D
+//
+
+#ifndef __GameDev2D__JsonStreamReader__
+#define __GameDev2D__JsonStreamReader__
+
+#include "../Core/BaseObject.h"
+
+
+using namespace std;
+
+namespace GameDev2D
+{
+    //Local constants
+    const unsigned int JSON_STREAM_READER_MAX_DEPTH = 64;
+
+    //The JsonStreamHandler receives the values from the JsonStreamReader in the order they appear in the json,
+    //inherit from it and override the methods for the values you are interested in. The strings passed in are
+    //only valid for the duration of the call
+    class JsonStreamHandler
+    {
+    public:
+        virtual ~JsonStreamHandler() {}
+
+        //Called at the start and end of an object, the key for each of the object's values is passed to Key()
+        virtual void StartObject() {}
+        virtual void EndObject() {}
+
+        //Called at the start and end of an array
+        virtual void StartArray() {}
+        virtual void EndArray() {}
+
+        //Called for the key of an object's value, the value follows
+        virtual void Key(const string& key) {}
+
+        //Called for each string, number, bool and null value
+        virtual void String(const string& value) {}
+        virtual void Number(double value) {}
+        virtual void Bool(bool value) {}
+        virtual void Null() {}
+    };
+
+    //The JsonStreamReader parses json in a single pass, without building a tree of the json values. Each value is
+    //passed to a JsonStreamHandler as it is parsed, the only memory used is a scratch string that is reused for
+    //every key and string value.
+    class JsonStreamReader : public BaseObject
+    {
+    public:
+        JsonStreamReader();
+        ~JsonStreamReader();
+
+        //Parses the json, the values are passed to the handler. Returns false if the json isn't valid, an Error is logged
+        //with the offset the parsing stopped at. The handler has been called for the values before the offset
+        bool Parse(const string& json, JsonStreamHandler* handler);
+
+    private:
+        //Parses a value, based on its first character, the depth is the number of containers the value is in
+        bool ParseValue(unsigned int depth);
+        bool ParseObject(unsigned int depth);
+        bool ParseArray(unsigned int depth);
+        bool ParseString(string& value);
+        bool ParseNumber();
+        bool ParseLiteral(const char* literal);
+
+        //Appends the unicode code point to the string, encoded in UTF-8
+        void AppendCodePoint(unsigned int codePoint, string& value);
+
+        //Reads the 4 hexadecimal digits of a \u escape sequence
+        bool ParseHexDigits(unsigned int& value);
+
+        //Skips over whitespace, returns the character at the position after the whitespace, or zero at the end of the json
+        char SkipWhitespace();
+
+        //Member variables
+        const char* m_Start;
+        const char* m_Position;
+        const char* m_End;
+        JsonStreamHandler* m_Handler;
+        string m_Scratch;
+    };
+}
+
+#endif /* defined(__GameDev2D__JsonStreamReader__) */
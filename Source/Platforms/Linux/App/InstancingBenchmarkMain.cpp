@@ -0,0 +1,105 @@
+#include "FrameworkConfig.h"
+#include "OffscreenContext.h"
+#include "../Platform_Linux.h"
+#include "../../../Services/ServiceLocator.h"
+#include "../../../Services/Graphics/Graphics.h"
+#include "../../../UI/Sprite/Sprite.h"
+#include "../../../../Game/Tiles/Tile.h"
+
+
+//Local constants
+const unsigned int INSTANCING_BENCHMARK_TILES_WIDE = 64;
+const unsigned int INSTANCING_BENCHMARK_TILES_HIGH = 52;
+const float INSTANCING_BENCHMARK_TILE_SCALE = 0.25f;
+const unsigned int INSTANCING_BENCHMARK_WARMUP_FRAMES = 10;
+const unsigned int INSTANCING_BENCHMARK_DEFAULT_FRAMES = 200;
+
+//Draws the tile batch for the number of frames and returns the average frame time in milliseconds, each frame waits for the
+//GPU to finish (SwapDrawBuffer calls glFinish), so the time includes the driver's and the rasterizer's work
+static double TimeFrames(GameDev2D::OffscreenContext* aOffscreenContext, GameDev2D::Sprite* aSprite, const vector<vec2>& aPositions, const vector<float>& aAngles, unsigned int aNumberOfFrames)
+{
+    GameDev2D::Graphics* graphics = GameDev2D::ServiceLocator::GetGraphics();
+    GameDev2D::PlatformLayer* platformLayer = GameDev2D::ServiceLocator::GetPlatformLayer();
+
+    unsigned long long start = platformLayer->GetTimeNanoseconds();
+    for(unsigned int i = 0; i < aNumberOfFrames; i++)
+    {
+        graphics->Clear();
+        aSprite->DrawBatch(aPositions, aAngles);
+        aOffscreenContext->SwapDrawBuffer();
+    }
+    unsigned long long elapsed = platformLayer->GetTimeNanoseconds() - start;
+
+    return (double)elapsed / 1000000.0 / (double)aNumberOfFrames;
+}
+
+//Usage: InstancingBenchmark [number of frames]
+//Draws a fixed batch of ground tiles offscreen with instancing disabled, then enabled, and prints the average frame times.
+//With EGL_PLATFORM=surfaceless and Mesa this measures llvmpipe, returns 1 if instancing isn't supported by the renderer
+int main(int aArgumentCount, char* aArguments[])
+{
+    //Parse the command line arguments
+    unsigned int numberOfFrames = aArgumentCount > 1 ? (unsigned int)strtoul(aArguments[1], NULL, 10) : INSTANCING_BENCHMARK_DEFAULT_FRAMES;
+    numberOfFrames = numberOfFrames > 0 ? numberOfFrames : INSTANCING_BENCHMARK_DEFAULT_FRAMES;
+
+    //Create an OpenGL 4.1 Context that renders offscreen
+    GameDev2D::OffscreenContext* offscreenContext = new GameDev2D::OffscreenContext();
+    if(offscreenContext->CreateOpenGLContext(4, 1, LINUX_DEFAULT_WIDTH, LINUX_DEFAULT_HEIGHT) == false)
+    {
+        delete offscreenContext;
+        return 1;
+    }
+
+    //Create the Linux PlatformLayer and initialize it, there is no Root Scene, the benchmark draws the batch itself
+    GameDev2D::Platform_Linux* platform_Linux = new GameDev2D::Platform_Linux(offscreenContext, LINUX_TARGET_FPS);
+    platform_Linux->Init(LINUX_DEFAULT_WIDTH, LINUX_DEFAULT_HEIGHT, false);
+
+    int result = 0;
+    GameDev2D::Graphics* graphics = GameDev2D::ServiceLocator::GetGraphics();
+    if(graphics->IsInstancingSupported() == true)
+    {
+        //The tile batch is a grid of ground tiles covering the screen, drawn the same way a SubSection draws its tiles
+        GameDev2D::Sprite* sprite = new GameDev2D::Sprite("MainAtlas", GameDev2D::Tile::GetBehaviourForTileType(GameDev2D::TileTypeGround).atlasKeys[0]);
+        sprite->SetLocalScale(INSTANCING_BENCHMARK_TILE_SCALE, INSTANCING_BENCHMARK_TILE_SCALE);
+
+        vector<vec2> positions;
+        vector<float> angles;
+        for(unsigned int y = 0; y < INSTANCING_BENCHMARK_TILES_HIGH; y++)
+        {
+            for(unsigned int x = 0; x < INSTANCING_BENCHMARK_TILES_WIDE; x++)
+            {
+                positions.push_back(vec2(x * sprite->GetWidth() * INSTANCING_BENCHMARK_TILE_SCALE, y * sprite->GetHeight() * INSTANCING_BENCHMARK_TILE_SCALE));
+                angles.push_back(0.0f);
+            }
+        }
+
+        //Time the vertex buffer path, then the instanced path
+        printf("Renderer: %s\n", offscreenContext->GetRendererName());
+        printf("Tiles: %u, frames: %u\n", (unsigned int)positions.size(), numberOfFrames);
+
+        bool isInstancingEnabled = graphics->IsInstancingEnabled();
+        for(unsigned int i = 0; i < 2; i++)
+        {
+            graphics->SetInstancingEnabled(i == 1);
+            TimeFrames(offscreenContext, sprite, positions, angles, INSTANCING_BENCHMARK_WARMUP_FRAMES);
+            double frameTime = TimeFrames(offscreenContext, sprite, positions, angles, numberOfFrames);
+            printf("Instancing %s: %.3fms per frame\n", i == 1 ? "enabled" : "disabled", frameTime);
+        }
+        graphics->SetInstancingEnabled(isInstancingEnabled);
+
+        //Cleanup the sprite
+        delete sprite;
+    }
+    else
+    {
+        fprintf(stderr, "Instancing isn't supported by the renderer: %s\n", offscreenContext->GetRendererName());
+        result = 1;
+    }
+
+    //Shutdown, then cleanup the linux platform layer and the offscreen context
+    platform_Linux->Shutdown();
+    delete platform_Linux;
+    delete offscreenContext;
+
+    return result;
+}
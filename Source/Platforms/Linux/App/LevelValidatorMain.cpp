@@ -0,0 +1,36 @@
+#include "FrameworkConfig.h"
+#include "../../../../Game/LevelEditor/LevelValidator.h"
+#include <unistd.h>
+
+
+//Usage: LevelValidator [directory]
+//Validates the SubSections saved in the directory's SaveData folder (the working directory by default), without creating a
+//PlatformLayer or an OpenGL context. Prints the issues found and returns 1 if there are any, 2 if the directory is invalid
+int main(int aArgumentCount, char* aArguments[])
+{
+    //The SubSections' files are relative to the working directory, like they are in the game
+    if(aArgumentCount > 1 && chdir(aArguments[1]) != 0)
+    {
+        fprintf(stderr, "Failed to open the directory: %s\n", aArguments[1]);
+        return 2;
+    }
+
+    //Validate the SubSections' files
+    GameDev2D::LevelValidator* levelValidator = new GameDev2D::LevelValidator();
+    unsigned int numberOfIssues = levelValidator->ValidateFiles();
+
+    //Print the issues
+    string description;
+    const vector<GameDev2D::LevelValidationIssue>& issues = levelValidator->GetIssues();
+    for(unsigned int i = 0; i < issues.size(); i++)
+    {
+        GameDev2D::LevelValidator::GetDescriptionForIssue(issues.at(i), description);
+        printf("%s\n", description.c_str());
+    }
+    printf("Level validation found %u issues\n", numberOfIssues);
+
+    //Cleanup the level validator
+    delete levelValidator;
+
+    return numberOfIssues > 0 ? 1 : 0;
+}
@@ -0,0 +1,180 @@
+#include "OffscreenContext.h"
+
+
+//Older EGL headers don't define the Mesa surfaceless platform
+#ifndef EGL_PLATFORM_SURFACELESS_MESA
+#define EGL_PLATFORM_SURFACELESS_MESA 0x31DD
+#endif
+
+
+namespace GameDev2D
+{
+    OffscreenContext::OffscreenContext() :
+        m_Display(EGL_NO_DISPLAY),
+        m_Config(nullptr),
+        m_Surface(EGL_NO_SURFACE),
+        m_Context(EGL_NO_CONTEXT),
+        m_Width(0),
+        m_Height(0)
+    {
+
+    }
+
+    OffscreenContext::~OffscreenContext()
+    {
+        //Safety check the display, release the context and the surface
+        if(m_Display != EGL_NO_DISPLAY)
+        {
+            eglMakeCurrent(m_Display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+
+            if(m_Context != EGL_NO_CONTEXT)
+            {
+                eglDestroyContext(m_Display, m_Context);
+            }
+
+            if(m_Surface != EGL_NO_SURFACE)
+            {
+                eglDestroySurface(m_Display, m_Surface);
+            }
+
+            eglTerminate(m_Display);
+        }
+    }
+
+    bool OffscreenContext::CreateOpenGLContext(unsigned int aMajorVersion, unsigned int aMinorVersion, unsigned int aWidth, unsigned int aHeight)
+    {
+        //Use the surfaceless platform if it's available, it doesn't need a display server. Otherwise use the default display
+        const char* clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+        PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+        if(clientExtensions != nullptr && strstr(clientExtensions, "EGL_MESA_platform_surfaceless") != nullptr && getPlatformDisplay != nullptr)
+        {
+            m_Display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+        }
+
+        if(m_Display == EGL_NO_DISPLAY)
+        {
+            m_Display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+        }
+
+        //Initialize EGL
+        EGLint majorVersion = 0;
+        EGLint minorVersion = 0;
+        if(m_Display == EGL_NO_DISPLAY || eglInitialize(m_Display, &majorVersion, &minorVersion) == EGL_FALSE)
+        {
+            fprintf(stderr, "Failed to initialize EGL\n");
+            return false;
+        }
+
+        //Desktop OpenGL, not OpenGL ES
+        if(eglBindAPI(EGL_OPENGL_API) == EGL_FALSE)
+        {
+            fprintf(stderr, "EGL doesn't support OpenGL\n");
+            return false;
+        }
+
+        //Choose a pbuffer config with the same pixel format as the other platforms' windows
+        const EGLint configAttributes[] =
+        {
+            EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+            EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+            EGL_RED_SIZE, 8,
+            EGL_GREEN_SIZE, 8,
+            EGL_BLUE_SIZE, 8,
+            EGL_ALPHA_SIZE, 8,
+            EGL_DEPTH_SIZE, 24,
+            EGL_STENCIL_SIZE, 8,
+            EGL_NONE
+        };
+
+        EGLint numberOfConfigs = 0;
+        if(eglChooseConfig(m_Display, configAttributes, &m_Config, 1, &numberOfConfigs) == EGL_FALSE || numberOfConfigs == 0)
+        {
+            fprintf(stderr, "Failed to find an EGL pbuffer config\n");
+            return false;
+        }
+
+        //Create the OpenGL core profile context for the requested version
+        const EGLint contextAttributes[] =
+        {
+            EGL_CONTEXT_MAJOR_VERSION, (EGLint)aMajorVersion,
+            EGL_CONTEXT_MINOR_VERSION, (EGLint)aMinorVersion,
+            EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+            EGL_NONE
+        };
+
+        m_Context = eglCreateContext(m_Display, m_Config, EGL_NO_CONTEXT, contextAttributes);
+        if(m_Context == EGL_NO_CONTEXT)
+        {
+            fprintf(stderr, "Failed to create an OpenGL %u.%u context\n", aMajorVersion, aMinorVersion);
+            return false;
+        }
+
+        //Create the pbuffer and make the context current
+        return CreateSurface(aWidth, aHeight);
+    }
+
+    bool OffscreenContext::Resize(unsigned int aWidth, unsigned int aHeight)
+    {
+        //Has the size changed
+        if(aWidth == m_Width && aHeight == m_Height)
+        {
+            return true;
+        }
+
+        //Release the current surface and create one at the new size
+        eglMakeCurrent(m_Display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        if(m_Surface != EGL_NO_SURFACE)
+        {
+            eglDestroySurface(m_Display, m_Surface);
+            m_Surface = EGL_NO_SURFACE;
+        }
+
+        return CreateSurface(aWidth, aHeight);
+    }
+
+    void OffscreenContext::SwapDrawBuffer()
+    {
+        glFinish();
+    }
+
+    void OffscreenContext::ReadPixels(unsigned char* aPixels)
+    {
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+        glReadPixels(0, 0, m_Width, m_Height, GL_RGBA, GL_UNSIGNED_BYTE, aPixels);
+    }
+
+    const char* OffscreenContext::GetRendererName()
+    {
+        return (const char*)glGetString(GL_RENDERER);
+    }
+
+    bool OffscreenContext::CreateSurface(unsigned int aWidth, unsigned int aHeight)
+    {
+        //Create the pbuffer surface
+        const EGLint surfaceAttributes[] =
+        {
+            EGL_WIDTH, (EGLint)aWidth,
+            EGL_HEIGHT, (EGLint)aHeight,
+            EGL_NONE
+        };
+
+        m_Surface = eglCreatePbufferSurface(m_Display, m_Config, surfaceAttributes);
+        if(m_Surface == EGL_NO_SURFACE)
+        {
+            fprintf(stderr, "Failed to create a %ux%u pbuffer surface\n", aWidth, aHeight);
+            return false;
+        }
+
+        //Make the context current on the new surface
+        if(eglMakeCurrent(m_Display, m_Surface, m_Surface, m_Context) == EGL_FALSE)
+        {
+            fprintf(stderr, "Failed to make the OpenGL context current\n");
+            return false;
+        }
+
+        //Set the size
+        m_Width = aWidth;
+        m_Height = aHeight;
+        return true;
+    }
+}
@@ -0,0 +1,52 @@
+#ifndef OFFSCREEN_CONTEXT_H
+#define OFFSCREEN_CONTEXT_H
+
+#include "FrameworkConfig.h"
+#include "../../../Graphics/OpenGL.h"
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+
+namespace GameDev2D
+{
+    //The OffscreenContext creates an OpenGL context that renders to an EGL pbuffer surface instead of a window, it
+    //doesn't need a display server or a GPU, on a machine without a GPU Mesa renders with its software rasterizer
+    //(llvmpipe). The pbuffer is the default framebuffer, so the Graphics service and the RenderTargets work unchanged.
+    class OffscreenContext
+    {
+    public:
+        OffscreenContext();
+        ~OffscreenContext();
+
+        //Create an OpenGL core profile context for the requested version, and a pbuffer surface of the requested size
+        bool CreateOpenGLContext(unsigned int majorVersion, unsigned int minorVersion, unsigned int width, unsigned int height);
+
+        //Recreates the pbuffer surface at the new size, the context (and its textures and buffers) is kept
+        bool Resize(unsigned int width, unsigned int height);
+
+        //A pbuffer isn't displayed, this waits for the frame to finish rendering so the frame times include the rendering
+        void SwapDrawBuffer();
+
+        //Reads the pixels of the last frame, the buffer must be width * height * 4 bytes (RGBA, bottom row first)
+        void ReadPixels(unsigned char* pixels);
+
+        //Returns the renderer's name, on a machine without a GPU this is the software rasterizer
+        const char* GetRendererName();
+
+    private:
+        //Creates the pbuffer surface and makes the context current on it
+        bool CreateSurface(unsigned int width, unsigned int height);
+
+        //EGL members
+        EGLDisplay m_Display;
+        EGLConfig m_Config;
+        EGLSurface m_Surface;
+        EGLContext m_Context;
+
+        //The size of the pbuffer surface
+        unsigned int m_Width;
+        unsigned int m_Height;
+    };
+}
+
+#endif
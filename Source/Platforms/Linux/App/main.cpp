@@ -0,0 +1,81 @@
+#include "FrameworkConfig.h"
+#include "OffscreenContext.h"
+#include "../Platform_Linux.h"
+#include "../../../Graphics/OpenGL.h"
+#include "../../../../Game/Game.h"
+#include "../../../../Game/Menus/Splash.h"
+#include "../../../../Examples/Examples.h"
+
+
+//Writes the last frame to a binary PPM file, so the rendering can be checked without a display
+static bool WriteFrame(GameDev2D::OffscreenContext* aOffscreenContext, unsigned int aWidth, unsigned int aHeight, const char* aPath)
+{
+    //Read the frame's pixels
+    vector<unsigned char> pixels(aWidth * aHeight * 4);
+    aOffscreenContext->ReadPixels(pixels.data());
+
+    //Open the file
+    FILE* file = fopen(aPath, "wb");
+    if(file == NULL)
+    {
+        return false;
+    }
+
+    //The pixels are read bottom row first, a PPM image is top row first and has no alpha
+    fprintf(file, "P6\n%u %u\n255\n", aWidth, aHeight);
+    for(unsigned int y = aHeight; y > 0; y--)
+    {
+        for(unsigned int x = 0; x < aWidth; x++)
+        {
+            fwrite(&pixels[((y - 1) * aWidth + x) * 4], 1, 3, file);
+        }
+    }
+
+    return fclose(file) == 0;
+}
+
+//Usage: GameDev2D [number of frames] [frame.ppm]
+//Runs the game offscreen for the number of frames (zero runs until SIGINT or SIGTERM) and writes the last frame to the ppm file
+int main(int aArgumentCount, char* aArguments[])
+{
+    //Parse the command line arguments
+    unsigned int numberOfFrames = aArgumentCount > 1 ? (unsigned int)strtoul(aArguments[1], NULL, 10) : LINUX_OFFSCREEN_NUMBER_OF_FRAMES;
+    const char* framePath = aArgumentCount > 2 ? aArguments[2] : NULL;
+
+    //Create an OpenGL 4.1 Context that renders offscreen
+    GameDev2D::OffscreenContext* offscreenContext = new GameDev2D::OffscreenContext();
+    if(offscreenContext->CreateOpenGLContext(4, 1, LINUX_DEFAULT_WIDTH, LINUX_DEFAULT_HEIGHT) == false)
+    {
+        delete offscreenContext;
+        return 1;
+    }
+
+    //Create the Linux PlatformLayer and initialize it and set the Root Scene
+    GameDev2D::Platform_Linux* platform_Linux = new GameDev2D::Platform_Linux(offscreenContext, LINUX_TARGET_FPS);
+    platform_Linux->Init(LINUX_DEFAULT_WIDTH, LINUX_DEFAULT_HEIGHT, LINUX_CAP_FRAME_RATE);
+    platform_Linux->SetRootScene(new GameDev2D::ROOT_SCENE());
+
+    //Run the game loop until the game shuts down, or the number of frames have been drawn
+    while(platform_Linux->GameLoop() == true)
+    {
+        if(numberOfFrames > 0 && platform_Linux->GetNumberOfFramesDrawn() >= numberOfFrames)
+        {
+            break;
+        }
+    }
+
+    //Write the last frame
+    int result = 0;
+    if(framePath != NULL && WriteFrame(offscreenContext, platform_Linux->GetWidth(), platform_Linux->GetHeight(), framePath) == false)
+    {
+        fprintf(stderr, "Failed to write the frame to: %s\n", framePath);
+        result = 1;
+    }
+
+    //Shutdown, then cleanup the linux platform layer and the offscreen context
+    platform_Linux->Shutdown();
+    delete platform_Linux;
+    delete offscreenContext;
+
+    return result;
+}
@@ -0,0 +1,381 @@
+#include "Platform_Linux.h"
+#include "App/OffscreenContext.h"
+#include "../../Services/ServiceLocator.h"
+#include "../../Events/Platform/ResizeEvent.h"
+
+#include <signal.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+#include <sys/utsname.h>
+
+
+namespace GameDev2D
+{
+    volatile int Platform_Linux::s_ShutdownSignal = 0;
+
+    Platform_Linux::Platform_Linux(OffscreenContext* aOffscreenContext, int aFrameRate) : PlatformLayer("Platform_Linux", aFrameRate),
+        m_OffscreenContext(aOffscreenContext),
+        m_InitTime(0),
+        m_NumberOfFramesDrawn(0),
+        m_IsFrameRateCapped(true)
+    {
+        //Get the time the app started up
+        timespec time;
+        clock_gettime(CLOCK_MONOTONIC, &time);
+        m_InitTime = (unsigned long long)time.tv_sec * 1000000000 + time.tv_nsec;
+
+        //Shutdown cleanly when the process is interrupted or terminated
+        signal(SIGINT, &Platform_Linux::HandleSignal);
+        signal(SIGTERM, &Platform_Linux::HandleSignal);
+
+        //There isn't a video mode change yet
+        m_VideoModeChangeInfo.needsChange = false;
+    }
+
+    Platform_Linux::~Platform_Linux()
+    {
+        //Restore the default signal handlers
+        signal(SIGINT, SIG_DFL);
+        signal(SIGTERM, SIG_DFL);
+    }
+
+    PlatformType Platform_Linux::GetPlatformType()
+    {
+        return PlatformType_Linux;
+    }
+
+    void Platform_Linux::Init(unsigned int aWidth, unsigned int aHeight, bool aIsFrameRateCapped)
+    {
+        //Initialize the base class
+        PlatformLayer::Init();
+
+        //Set the offscreen surface's size
+        VideoModeInfo videoModeInfo;
+        videoModeInfo.width = aWidth;
+        videoModeInfo.height = aHeight;
+        ApplyVideoModeChanges(&videoModeInfo);
+
+        //Lastly set wether the frame rate is capped
+        SetIsFrameRateCapped(aIsFrameRateCapped);
+    }
+
+    bool Platform_Linux::Update()
+    {
+        //Was the process interrupted or terminated
+        if(s_ShutdownSignal != 0)
+        {
+            Log(VerbosityLevel_Debug, "Received signal %i, shutting down", s_ShutdownSignal);
+            s_ShutdownSignal = 0;
+            Shutdown();
+        }
+
+        //If the game isn't running anymore, return false
+        if(m_IsRunning == false)
+        {
+            return false;
+        }
+
+        //Sleep the game timer
+        DoSleep();
+
+        //Handle video mode changes
+        if(m_VideoModeChangeInfo.needsChange == true)
+        {
+            ApplyVideoModeChanges(&m_VideoModeChangeInfo);
+            m_VideoModeChangeInfo.needsChange = false;
+        }
+
+        //Calculate the tick (milleseconds since last update) and update the game
+        Tick();
+
+        //Return wether the game is still running or not
+        return m_IsRunning;
+    }
+
+    void Platform_Linux::Draw()
+    {
+        //If the application isn't suspended, clear the OpenGL view
+        if(m_IsSuspended == false)
+        {
+            ServiceLocator::GetGraphics()->Clear();
+        }
+
+        //Draw the services
+        ServiceLocator::DrawServices();
+
+        //If the application isn't suspended, finish the frame
+        if(m_IsSuspended == false)
+        {
+            if(m_OffscreenContext != nullptr)
+            {
+                m_OffscreenContext->SwapDrawBuffer();
+            }
+            m_NumberOfFramesDrawn++;
+        }
+    }
+
+    void Platform_Linux::SetVideoModeInfo(VideoModeInfo* aVideoModeInfo)
+    {
+        m_VideoModeChangeInfo.needsChange = true;
+        m_VideoModeChangeInfo.width = aVideoModeInfo->width;
+        m_VideoModeChangeInfo.height = aVideoModeInfo->height;
+    }
+
+    void Platform_Linux::ResizeTo(unsigned int aWidth, unsigned int aHeight)
+    {
+        VideoModeInfo videoModeInfo;
+        videoModeInfo.width = aWidth;
+        videoModeInfo.height = aHeight;
+        SetVideoModeInfo(&videoModeInfo);
+    }
+
+    void Platform_Linux::ApplyVideoModeChanges(VideoModeInfo* aVideoModeInfo)
+    {
+        //Resize the offscreen surface, then the viewport
+        if(m_OffscreenContext != nullptr && m_OffscreenContext->Resize(aVideoModeInfo->width, aVideoModeInfo->height) == true)
+        {
+            HandleViewportResize(aVideoModeInfo->width, aVideoModeInfo->height);
+        }
+    }
+
+    void Platform_Linux::HandleViewportResize(unsigned int aWidth, unsigned int aHeight)
+    {
+        //Safety check that the width and height have changed
+        if(aWidth != m_Width || aHeight != m_Height)
+        {
+            //Set the width and height
+            m_Width = aWidth;
+            m_Height = aHeight;
+
+            //Resize the Graphics service
+            ServiceLocator::GetGraphics()->Resize(m_Width, m_Height);
+
+            //Dispatch a Resize event
+            DispatchEvent(new ResizeEvent(vec2(m_Width, m_Height)));
+        }
+    }
+
+    void Platform_Linux::DoSleep()
+    {
+        if(m_IsFrameRateCapped == true)
+        {
+            PlatformLayer::DoSleep();
+        }
+    }
+
+    bool Platform_Linux::IsFrameRateCapped()
+    {
+        return m_IsFrameRateCapped;
+    }
+
+    void Platform_Linux::SetIsFrameRateCapped(bool aIsFrameRateCapped)
+    {
+        m_IsFrameRateCapped = aIsFrameRateCapped;
+    }
+
+    unsigned int Platform_Linux::GetNumberOfFramesDrawn()
+    {
+        return m_NumberOfFramesDrawn;
+    }
+
+    bool Platform_Linux::HasMouseInput()
+    {
+        return false;
+    }
+
+    bool Platform_Linux::HasKeyboardInput()
+    {
+        return false;
+    }
+
+    bool Platform_Linux::HasTouchInput()
+    {
+        return false;
+    }
+
+    bool Platform_Linux::HasControllerInput()
+    {
+        return false;
+    }
+
+    bool Platform_Linux::HasAccelerometerInput()
+    {
+        return false;
+    }
+
+    bool Platform_Linux::HasGyroscopeInput()
+    {
+        return false;
+    }
+
+    bool Platform_Linux::IsMultipleTouchEnabled()
+    {
+        return false;
+    }
+
+    void Platform_Linux::SetMultipleTouchEnabled(bool aEnabled)
+    {
+        //Unused on Linux
+    }
+
+    bool Platform_Linux::IsAccelerometerEnabled()
+    {
+        return false;
+    }
+
+    void Platform_Linux::SetAccelerometerEnabled(bool aEnabled)
+    {
+        //Unused on Linux
+    }
+
+    void Platform_Linux::SetAccelerometerUpdateInterval(double aInterval)
+    {
+        //Unused on Linux
+    }
+
+    bool Platform_Linux::IsGyroscopeEnabled()
+    {
+        return false;
+    }
+
+    void Platform_Linux::SetGyroscopeEnabled(bool aEnabled)
+    {
+        //Unused on Linux
+    }
+
+    void Platform_Linux::SetGyroscopeUpdateInterval(double aInterval)
+    {
+        //Unused on Linux
+    }
+
+    string Platform_Linux::GetWorkingDirectory()
+    {
+        return GetApplicationDirectory();
+    }
+
+    string Platform_Linux::GetApplicationDirectory()
+    {
+        //The executable's path, without the executable's name
+        char path[PATH_MAX];
+        ssize_t length = readlink("/proc/self/exe", path, PATH_MAX - 1);
+        if(length <= 0)
+        {
+            return string(".");
+        }
+        path[length] = '\0';
+
+        string directory = string(path);
+        return directory.substr(0, directory.find_last_of('/'));
+    }
+
+    string Platform_Linux::GetPathForResourceInDirectory(const char* aFileName, const char* aFileType, const char* aDirectory)
+    {
+        string path = string(GetApplicationDirectory());
+        path += "/Assets/";
+        path += string(aDirectory);
+        path += "/";
+        path += string(aFileName);
+        path += ".";
+        path += string(aFileType);
+        return path;
+    }
+
+    bool Platform_Linux::DoesFileExistAtPath(const string& aPath)
+    {
+        struct stat fileStatus;
+        return stat(aPath.c_str(), &fileStatus) == 0 && S_ISREG(fileStatus.st_mode);
+    }
+
+    bool Platform_Linux::ReplaceFileAtPath(const string& aSourcePath, const string& aDestinationPath)
+    {
+        //Renaming a file over another file on the same file system is atomic
+        return rename(aSourcePath.c_str(), aDestinationPath.c_str()) == 0;
+    }
+
+    unsigned long long Platform_Linux::GetModificationTimeForFileAtPath(const string& aPath)
+    {
+        struct stat fileStatus;
+        if(stat(aPath.c_str(), &fileStatus) != 0)
+        {
+            return 0;
+        }
+        return (unsigned long long)fileStatus.st_mtim.tv_sec * 1000000000ULL + (unsigned long long)fileStatus.st_mtim.tv_nsec;
+    }
+
+    int Platform_Linux::PresentNativeDialogBox(const char* aTitle, const char* aMessage, NativeDialogType aType)
+    {
+        //There is no display to present the dialog box on, the first button (Ok or Yes) is returned
+        fprintf(stderr, "[%s] %s\n", aTitle, aMessage);
+        return 0;
+    }
+
+    void Platform_Linux::PlatformName(string& aName)
+    {
+        aName = "Linux";
+    }
+
+    void Platform_Linux::PlatformModel(string& aModel)
+    {
+        struct utsname systemName;
+        aModel = uname(&systemName) == 0 ? string(systemName.machine) : "";
+    }
+
+    void Platform_Linux::PlatformVersion(string& aVersion)
+    {
+        struct utsname systemName;
+        aVersion = uname(&systemName) == 0 ? string(systemName.release) : "";
+    }
+
+    unsigned long long Platform_Linux::MemoryInstalled()
+    {
+        return (unsigned long long)sysconf(_SC_PHYS_PAGES) * (unsigned long long)sysconf(_SC_PAGE_SIZE);
+    }
+
+    unsigned long long Platform_Linux::DiskSpaceUsed()
+    {
+        return DiskSpaceTotal() - DiskSpaceFree();
+    }
+
+    unsigned long long Platform_Linux::DiskSpaceFree()
+    {
+        struct statvfs fileSystemStatus;
+        if(statvfs(GetApplicationDirectory().c_str(), &fileSystemStatus) != 0)
+        {
+            return 0;
+        }
+        return (unsigned long long)fileSystemStatus.f_bavail * fileSystemStatus.f_frsize;
+    }
+
+    unsigned long long Platform_Linux::DiskSpaceTotal()
+    {
+        struct statvfs fileSystemStatus;
+        if(statvfs(GetApplicationDirectory().c_str(), &fileSystemStatus) != 0)
+        {
+            return 0;
+        }
+        return (unsigned long long)fileSystemStatus.f_blocks * fileSystemStatus.f_frsize;
+    }
+
+    unsigned int Platform_Linux::CpuCount()
+    {
+        return (unsigned int)sysconf(_SC_NPROCESSORS_ONLN);
+    }
+
+    unsigned int Platform_Linux::GetTicks()
+    {
+        return (unsigned int)(GetTimeNanoseconds() / 1000000);
+    }
+
+    unsigned long long Platform_Linux::GetTimeNanoseconds()
+    {
+        timespec time;
+        clock_gettime(CLOCK_MONOTONIC, &time);
+        return (unsigned long long)time.tv_sec * 1000000000 + time.tv_nsec - m_InitTime;
+    }
+
+    void Platform_Linux::HandleSignal(int aSignal)
+    {
+        s_ShutdownSignal = aSignal;
+    }
+}
@@ -0,0 +1,149 @@
+#ifndef PLATFORM_LINUX_H
+#define PLATFORM_LINUX_H
+
+#include "../PlatformLayer.h"
+
+
+namespace GameDev2D
+{
+    //Forward declarations
+    class OffscreenContext;
+
+    //The Platform_Linux class inherits from the PlatformLayer class. This class provides a headless Linux platform
+    //implementation, the game renders to an offscreen OpenGL context so that it can run (and be profiled) on a machine
+    //without a display server or a GPU. There is no window, so there is no mouse or keyboard input and the native dialog
+    //boxes are written to the standard error output. SIGINT and SIGTERM shut the game down cleanly.
+    //This class dispatches the following events:
+    // SHUTDOWN_EVENT
+    // SUSPEND_EVENT
+    // RESUME_EVENT
+    // LOW_MEMORY_WARNING_EVENT (iOS Only)
+    // ORIENTATION_CHANGED_EVENT (iOS Only)
+    // RESIZE_EVENT
+    // FULLSCREEN_EVENT
+    class Platform_Linux : public PlatformLayer
+    {
+    public:
+        //The constructor takes in the offscreen context the game renders to and the target frame rate.
+        Platform_Linux(OffscreenContext* offscreenContext, int frameRate);
+        ~Platform_Linux();
+
+        //Returns the Linux platform type
+        PlatformType GetPlatformType();
+
+        //Intiailizes the Platform_Linux layer to a initial size, and wether the frame rate is capped to the target frame rate
+        void Init(unsigned int width, unsigned int height, bool isFrameRateCapped);
+
+        //Methods used to Update and Draw the application, inherited from PlatformLayer
+        bool Update();
+        void Draw();
+
+        //Sets the current video mode, this will set a flag to trigger a resize event at the start of the next Update(),
+        //inherited from PlatformLayer
+        void SetVideoModeInfo(VideoModeInfo* videoModeInfo);
+
+        //Call this method to resize the offscreen surface, inherited from PlatformLayer
+        void ResizeTo(unsigned int width, unsigned int height);
+
+        //Returns wether the frame rate is capped to the target frame rate, uncapped the frames are rendered back to back
+        bool IsFrameRateCapped();
+        void SetIsFrameRateCapped(bool isFrameRateCapped);
+
+        //Returns the number of frames that have been drawn
+        unsigned int GetNumberOfFramesDrawn();
+
+        //Platform specific methods to determine what input is available, inherited from PlatformLayer
+        bool HasMouseInput();
+        bool HasKeyboardInput();
+        bool HasTouchInput();
+        bool HasControllerInput();
+        bool HasAccelerometerInput();
+        bool HasGyroscopeInput();
+
+        //Touch input is NOT supported on Linux, methods do not do anything
+        bool IsMultipleTouchEnabled();
+        void SetMultipleTouchEnabled(bool enabled);
+
+        //Accelerometer input is NOT supported on Linux, methods do not do anything
+        bool IsAccelerometerEnabled();
+        void SetAccelerometerEnabled(bool enabled);
+        void SetAccelerometerUpdateInterval(double interval);
+
+        //Gyroscope input is NOT supported on Linux, methods do not do anything
+        bool IsGyroscopeEnabled();
+        void SetGyroscopeEnabled(bool enabled);
+        void SetGyroscopeUpdateInterval(double interval);
+
+        //Returns a path to the directory where files can be written to, inherited from PlatformLayer
+        string GetWorkingDirectory();
+
+        //Returns a path to the directory that the application is in, inherited from PlatformLayer
+        string GetApplicationDirectory();
+
+        //Returns a path for a resource in a specific directory, inherited from PlatformLayer
+        string GetPathForResourceInDirectory(const char* fileName, const char* fileType, const char* directory);
+
+        //Returns wether the file exists at the path, inherited from PlatformLayer
+        bool DoesFileExistAtPath(const string& path);
+
+        //Moves the file at the source path to the destination path, replacing the destination file, inherited from PlatformLayer
+        bool ReplaceFileAtPath(const string& sourcePath, const string& destinationPath);
+
+        //Returns the time the file at the path was last modified (in nanoseconds since 1970), inherited from PlatformLayer
+        unsigned long long GetModificationTimeForFileAtPath(const string& path);
+
+        //Writes the dialog box to the standard error output and returns the first button, inherited from PlatformLayer
+        int PresentNativeDialogBox(const char* title, const char* message, NativeDialogType type);
+
+        //Returns platform specific details and the operating system name and version, and
+        //hardware model (if available). Inherited from PlatformLayer
+        void PlatformName(string& name);
+        void PlatformModel(string& model);
+        void PlatformVersion(string& version);
+
+        //Returns how much memory (RAM) is installed on the machine, inherited from PlatformLayer
+        unsigned long long MemoryInstalled();
+
+        //Hard drive specific methods, inherited from PlatformLayer
+        unsigned long long DiskSpaceUsed();
+        unsigned long long DiskSpaceFree();
+        unsigned long long DiskSpaceTotal();
+
+        //Returns the number of available CPUs on the machine, inherited from PlatformLayer
+        unsigned int CpuCount();
+
+        //Returns the number of ticks since the start of the application, inherited from PlatformLayer
+        unsigned int GetTicks();
+
+        //Returns the number of nanoseconds since the start of the application, inherited from PlatformLayer
+        unsigned long long GetTimeNanoseconds();
+
+    protected:
+        //This method applies the changes set in the SetVideoModeInfo() method at the start of the
+        //Update() method. Inherited from PlatformLayer
+        void ApplyVideoModeChanges(VideoModeInfo* videoModeInfo);
+
+        //This handles the viewport and back buffer resizing when the offscreen surface is resized.
+        //Inherited from PlatformLayer.
+        void HandleViewportResize(unsigned int width, unsigned int height);
+
+        //Only sleeps if the frame rate is capped, inherited from PlatformLayer
+        void DoSleep();
+
+    private:
+        //Signal handler for SIGINT and SIGTERM, the shutdown happens at the start of the next Update()
+        static void HandleSignal(int signal);
+
+        //Member variables
+        OffscreenContext* m_OffscreenContext;
+        unsigned long long m_InitTime;
+        unsigned int m_NumberOfFramesDrawn;
+        bool m_IsFrameRateCapped;
+        VideoModeInfo m_VideoModeChangeInfo;
+
+        //Set by the signal handler
+        static volatile int s_ShutdownSignal;
+    };
+}
+
+#endif
@@ -17,6 +17,7 @@
 #include <sys/sysctl.h>
 #include <sys/utsname.h>
 #include <sys/types.h>
+#include <sys/stat.h>
 #include <mach/mach.h>
 #include <mach/mach_host.h>
 #include <mach/mach_time.h>
@@ -383,6 +384,22 @@ namespace GameDev2D
         return fileExists;
     }
     
+    bool Platform_OSX::ReplaceFileAtPath(const string& aSourcePath, const string& aDestinationPath)
+    {
+        //The POSIX rename function atomically replaces the destination file
+        return rename(aSourcePath.c_str(), aDestinationPath.c_str()) == 0;
+    }
+    
+    unsigned long long Platform_OSX::GetModificationTimeForFileAtPath(const string& aPath)
+    {
+        struct stat fileStatus;
+        if(stat(aPath.c_str(), &fileStatus) != 0)
+        {
+            return 0;
+        }
+        return (unsigned long long)fileStatus.st_mtimespec.tv_sec * 1000000000ULL + (unsigned long long)fileStatus.st_mtimespec.tv_nsec;
+    }
+    
     int Platform_OSX::PresentNativeDialogBox(const char* aTitle, const char* aMessage, NativeDialogType aType)
     {
         //Create the NSString objects for the title and message
@@ -499,14 +516,20 @@ namespace GameDev2D
     
     unsigned int Platform_OSX::GetTicks()
     {
-    	uint64_t time = mach_absolute_time();	
-        double conversion = 0.0;
-        
-        mach_timebase_info_data_t info;
-        mach_timebase_info( &info );
-        conversion = 1e-9 * (double) info.numer / (double) info.denom;	
+        return (unsigned int)(GetTimeNanoseconds() / 1000000);
+    }
+    
+    unsigned long long Platform_OSX::GetTimeNanoseconds()
+    {
+        //Cache the timebase, it converts the absolute time units to nanoseconds
+        static mach_timebase_info_data_t info = {0, 0};
+        if(info.denom == 0)
+        {
+            mach_timebase_info(&info);
+        }
         
-        return (((double)(time - m_InitTime)) * conversion) * 1000.0f;
+        uint64_t time = mach_absolute_time() - m_InitTime;
+        return (unsigned long long)((double)time * (double)info.numer / (double)info.denom);
     }
     
 }
\ No newline at end of file
@@ -9,14 +9,21 @@
 
 #include "PlatformLayer.h"
 #include "../Services/ServiceLocator.h"
+#include "../Core/MemoryTracker.h"
 #include "../../Game/Game.h"
-#if __APPLE__
+#if __APPLE__ || __linux__
 #include <unistd.h>
 #endif
+#include <thread>
 
 
 namespace GameDev2D
 {
+    //Local constants
+    const unsigned long long NANOSECONDS_PER_SECOND = 1000000000;
+    const unsigned long long NANOSECONDS_PER_MILLISECOND = 1000000;
+    const unsigned long long MAXIMUM_DELTA_TIME = NANOSECONDS_PER_SECOND;
+
     PlatformLayer::PlatformLayer(const string& aPlatformType, int aFrameRate) : BaseObject(aPlatformType), EventDispatcher(),
         m_Width(0),
         m_Height(0),
@@ -26,12 +33,19 @@ namespace GameDev2D
         m_RefreshInterval(0),
         m_FramesPerSecond(0),
         m_DeltaTicks(0),
+        m_DeltaTime(0.0),
         m_FrameRate(0),
-        m_FrameTicks(0),
-		m_LastFrameTicks(0),
-        m_LastSleepFrameTicks(0),
-		m_LastFPSTicks(0)
+        m_FrameTime(0),
+        m_LastFrameTime(0),
+        m_LastSleepFrameTime(0),
+        m_LastFPSTime(0),
+        m_FixedTimestepAccumulator(0.0),
+        m_IsFixedTimestepEnabled(FIXED_TIMESTEP),
+        m_MemoryTracker(nullptr)
     {
+        //Create the MemoryTracker
+        m_MemoryTracker = new MemoryTracker();
+        
         //Set the target framerate
         SetTargetFramerate(aFrameRate);
         
@@ -43,6 +57,9 @@ namespace GameDev2D
     {    
         //Remove all the game services
         ServiceLocator::RemoveAllServices();
+        
+        //Delete the MemoryTracker
+        SafeDelete(m_MemoryTracker);
     }
 
     void PlatformLayer::Init()
@@ -55,6 +72,11 @@ namespace GameDev2D
         
         //Initialize the Game services
         ServiceLocator::LoadDefaultServices();
+        
+        //Start the frame timers, so the first frame's delta time isn't the start up time
+        m_LastFrameTime = GetTimeNanoseconds();
+        m_LastSleepFrameTime = m_LastFrameTime;
+        m_LastFPSTime = m_LastFrameTime;
     }
     
     void PlatformLayer::InitLogFiles()
@@ -156,8 +178,9 @@ namespace GameDev2D
         //Set the isSuspended flag to false
         m_IsSuspended = false;
 
-        //Reset the last frame ticks, to avoid a large delta time after the app suspension
-        m_LastFrameTicks = GetTicks();
+        //Reset the last frame time, to avoid a large delta time after the app suspension
+        m_LastFrameTime = GetTimeNanoseconds();
+        m_FixedTimestepAccumulator = 0.0;
         
         //Dispatch a Resume Event
         DispatchEvent(new Event(RESUME_EVENT));
@@ -211,12 +234,30 @@ namespace GameDev2D
     
     double PlatformLayer::GetDeltaTime()
     {
-        return (double)(m_DeltaTicks / 1000.0);
+        return m_DeltaTime;
     }
     
     double PlatformLayer::GetElapsedTime()
     {
-        return ((double)GetTicks()) / 1000.0;
+        return (double)GetTimeNanoseconds() / (double)NANOSECONDS_PER_SECOND;
+    }
+    
+    bool PlatformLayer::IsFixedTimestepEnabled()
+    {
+        return m_IsFixedTimestepEnabled;
+    }
+    
+    void PlatformLayer::SetIsFixedTimestepEnabled(bool aIsFixedTimestepEnabled)
+    {
+        //Reset the accumulated time, and stop interpolating the rendered transforms
+        m_IsFixedTimestepEnabled = aIsFixedTimestepEnabled;
+        m_FixedTimestepAccumulator = 0.0;
+        GameObject::SetRenderInterpolation(1.0f);
+    }
+    
+    double PlatformLayer::GetFixedTimestep()
+    {
+        return 1.0 / (double)FIXED_TIMESTEP_UPDATES_PER_SECOND;
     }
     
     unsigned int PlatformLayer::GetFramesPerSecond()
@@ -227,7 +268,7 @@ namespace GameDev2D
     void PlatformLayer::SetTargetFramerate(unsigned int aFramerate)
     {
         m_FrameRate = aFramerate;
-        m_RefreshInterval = 1000 / m_FrameRate;
+        m_RefreshInterval = NANOSECONDS_PER_SECOND / m_FrameRate;
     }
 
     bool PlatformLayer::IsFullscreen()
@@ -295,6 +336,11 @@ namespace GameDev2D
         #endif   
     }
     
+    MemoryTracker* PlatformLayer::GetMemoryTracker()
+    {
+        return m_MemoryTracker;
+    }
+    
     void PlatformLayer::SetRenderBufferStorage()
     {
         //By default this method does nothing, platforms that require
@@ -303,41 +349,100 @@ namespace GameDev2D
     
     void PlatformLayer::DoSleep()
     {
-        //Sleep the main thread to achieve our target framerate
-        unsigned int ticks = GetTicks();
-		unsigned int ticksSinceLastFrame = ticks - m_LastSleepFrameTicks;
-		if(ticksSinceLastFrame <= m_RefreshInterval)
+        //The time the frame should start at
+        unsigned long long targetTime = m_LastSleepFrameTime + m_RefreshInterval;
+        unsigned long long time = GetTimeNanoseconds();
+        
+        //Sleep the main thread until shortly before the target time, a sleep can last longer than requested
+        unsigned long long spinDuration = FRAME_PACING_SPIN_MICROSECONDS * 1000;
+        while(time + spinDuration < targetTime)
+        {
+            unsigned long long sleepDuration = targetTime - time - spinDuration;
 #ifdef _WINDOWS
-		Sleep((m_RefreshInterval - ticksSinceLastFrame));
+            if(sleepDuration < NANOSECONDS_PER_MILLISECOND)
+            {
+                break;
+            }
+            Sleep((DWORD)(sleepDuration / NANOSECONDS_PER_MILLISECOND));
 #else
-        usleep((m_RefreshInterval - ticksSinceLastFrame) * 1000);
+            usleep((useconds_t)(sleepDuration / 1000));
 #endif
-		m_LastSleepFrameTicks = GetTicks();
+            time = GetTimeNanoseconds();
+        }
+        
+        //Yield the main thread until the target time
+        while(time < targetTime)
+        {
+            this_thread::yield();
+            time = GetTimeNanoseconds();
+        }
+        
+        //The next frame is paced from the target time, so the sleep error doesn't add up. If the
+        //frame is more than a refresh interval late, don't try to catch up
+        m_LastSleepFrameTime = time - targetTime > m_RefreshInterval ? time : targetTime;
     }
     
     void PlatformLayer::Tick()
     {
-        //Increment the frames and calculate the delta ticks
+        //Start tracking the frame's allocations, and check the memory budgets
+        m_MemoryTracker->StartFrame();
+        
+        //Increment the frames and calculate the delta time
         m_Frames++;
-		m_FrameTicks = GetTicks();
-		m_DeltaTicks = m_FrameTicks - m_LastFrameTicks;
-		
-        //Clamp the delta ticks
-		if(m_DeltaTicks > 1000)
+        m_FrameTime = GetTimeNanoseconds();
+        unsigned long long deltaTime = m_FrameTime - m_LastFrameTime;
+        
+        //Clamp the delta time
+        if(deltaTime > MAXIMUM_DELTA_TIME)
         {
-			m_DeltaTicks = 1000;
+            deltaTime = MAXIMUM_DELTA_TIME;
         }
+        m_DeltaTicks = (unsigned int)(deltaTime / NANOSECONDS_PER_MILLISECOND);
         
         //Update the Game's services
-        ServiceLocator::UpdateServices(GetDeltaTime());
-		
+        if(m_IsFixedTimestepEnabled == true)
+        {
+            //Accumulate the time between frames, then update the services in fixed steps
+            double fixedTimestep = GetFixedTimestep();
+            m_FixedTimestepAccumulator += (double)deltaTime / (double)NANOSECONDS_PER_SECOND;
+            m_DeltaTime = fixedTimestep;
+            
+            unsigned int updates = 0;
+            while(m_FixedTimestepAccumulator >= fixedTimestep && updates < FIXED_TIMESTEP_MAX_UPDATES_PER_FRAME)
+            {
+                //GameObjects keep their transform from before the step, to interpolate from
+                GameObject::StartFixedUpdate();
+                ServiceLocator::UpdateServices(fixedTimestep);
+                m_FixedTimestepAccumulator -= fixedTimestep;
+                updates++;
+            }
+            
+            //If the updates can't keep up, drop the time that is left over, the game slows down instead of
+            //spending even longer on the next frame's updates
+            if(m_FixedTimestepAccumulator >= fixedTimestep)
+            {
+                m_FixedTimestepAccumulator = fmod(m_FixedTimestepAccumulator, fixedTimestep);
+            }
+            
+            //The left over time is how far the frame is between the last step and the next step
+            GameObject::SetRenderInterpolation((float)(m_FixedTimestepAccumulator / fixedTimestep));
+        }
+        else
+        {
+            m_DeltaTime = (double)deltaTime / (double)NANOSECONDS_PER_SECOND;
+            ServiceLocator::UpdateServices(m_DeltaTime);
+        }
+        
         //Calculate the frames per second
-		if(m_FrameTicks - m_LastFPSTicks >= 1000)
+        if(m_FrameTime - m_LastFPSTime >= NANOSECONDS_PER_SECOND)
         {
-			m_FramesPerSecond = m_Frames;
-			m_Frames = 0;
-			m_LastFPSTicks = m_FrameTicks;
-		}
-		m_LastFrameTicks = m_FrameTicks;
+            m_FramesPerSecond = m_Frames;
+            m_Frames = 0;
+            m_LastFPSTime = m_FrameTime;
+        }
+        m_LastFrameTime = m_FrameTime;
+        
+        //The frame's transient allocations are done with, reset the frame arena
+        ServiceLocator::GetFrameArena()->Reset();
     }
-}
\ No newline at end of file
+}
@@ -22,6 +22,7 @@ namespace GameDev2D
     //Forward Declarations
     struct VideoModeInfo;
     class Scene;
+    class MemoryTracker;
 
     //Supported platforms
     enum PlatformType
@@ -30,6 +31,7 @@ namespace GameDev2D
         PlatformType_iOS,
         PlatformType_OSX,
         PlatformType_Win32,
+        PlatformType_Linux,
     };
     
     //Supported orientations (only iOS)
@@ -105,12 +107,25 @@ namespace GameDev2D
         //Returns the last Update() method's delta tick count
         unsigned int GetDeltaTicks();
         
-        //Returns the last Update() method's delta time (in seconds)
+        //Returns the last Update() method's delta time (in seconds), when the fixed timestep is
+        //enabled this is the fixed timestep, not the time between frames
         double GetDeltaTime();
         
         //Returns how much time has elapsed since the start of the application (in seconds)
         double GetElapsedTime();
         
+        //Returns the number of nanoseconds since the start of the application, from the platform's monotonic
+        //high resolution clock. Abstract, must be implemented by an inheriting class
+        virtual unsigned long long GetTimeNanoseconds() = 0;
+        
+        //Returns wether the services are updated with a fixed timestep. The time between frames is accumulated
+        //and the services are updated zero or more times per frame, in fixed steps
+        bool IsFixedTimestepEnabled();
+        void SetIsFixedTimestepEnabled(bool isFixedTimestepEnabled);
+        
+        //Returns the fixed timestep (in seconds)
+        double GetFixedTimestep();
+        
         //Returns the current number of frames per second
         unsigned int GetFramesPerSecond();
         
@@ -167,6 +182,14 @@ namespace GameDev2D
         //Returns wether the file exists at the path, abstract, must be implemented by an inheriting class
         virtual bool DoesFileExistAtPath(const string& path) = 0;
         
+        //Moves the file at the source path to the destination path, replacing the destination file if it exists. The replacement
+        //is atomic, the destination path either has the old file or the new file. Abstract, must be implemented by an inheriting class
+        virtual bool ReplaceFileAtPath(const string& sourcePath, const string& destinationPath) = 0;
+        
+        //Returns the time the file at the path was last modified (in nanoseconds since 1970), returns zero if the
+        //file doesn't exist. Abstract, must be implemented by an inheriting class
+        virtual unsigned long long GetModificationTimeForFileAtPath(const string& path) = 0;
+        
         //Presents a platform specific native dialog box, abstract, must be implemented by an inheriting class
         virtual int PresentNativeDialogBox(const char* title, const char* message, NativeDialogType type) = 0;
  
@@ -187,6 +210,9 @@ namespace GameDev2D
         //Formats the memory returned in the above method and formats it in a string and formats to the nearest KB, MB, GB
         virtual void MemoryAllocatedFormatted(string& formatted);
         
+        //Returns the MemoryTracker, which tracks the allocations of each MemoryTag and their budgets
+        MemoryTracker* GetMemoryTracker();
+        
         //Returns how much memory (RAM) is installed on the machine, abstract, must be implemented by an inheriting class
         virtual unsigned long long MemoryInstalled() = 0;
         
@@ -217,7 +243,8 @@ namespace GameDev2D
         //those platforms (iOS), by default it does nothing.
         virtual void SetRenderBufferStorage();
         
-        //Sleeps the thread to help achieve the frames per second target
+        //Sleeps the thread to help achieve the frames per second target, the thread sleeps until shortly before the
+        //target time (sleeping isn't precise) then yields until the target time
         virtual void DoSleep();
         
         //Returns the number of ticks since the start of the application, abstract, must be implemented by an inheriting class
@@ -240,14 +267,18 @@ namespace GameDev2D
         bool m_IsSuspended;
         bool m_IsRunning;
         int m_Frames;
-        unsigned int m_RefreshInterval;
+        unsigned long long m_RefreshInterval;
         unsigned int m_FramesPerSecond;
         unsigned int m_DeltaTicks;
+        double m_DeltaTime;
         unsigned int m_FrameRate;
-        unsigned int m_FrameTicks;
-		unsigned int m_LastFrameTicks;
-        unsigned int m_LastSleepFrameTicks;
-		unsigned int m_LastFPSTicks;
+        unsigned long long m_FrameTime;
+        unsigned long long m_LastFrameTime;
+        unsigned long long m_LastSleepFrameTime;
+        unsigned long long m_LastFPSTime;
+        double m_FixedTimestepAccumulator;
+        bool m_IsFixedTimestepEnabled;
+        MemoryTracker* m_MemoryTracker;
     };
     
     //The video mode struct keeps track of the width and height, and if they need to be changed
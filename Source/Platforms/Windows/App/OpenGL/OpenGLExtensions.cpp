@@ -73,6 +73,9 @@ PFNGLBINDVERTEXARRAYPROC            glBindVertexArray = 0;
 PFNGLGENVERTEXARRAYSPROC            glGenVertexArrays = 0;
 PFNGLDELETEVERTEXARRAYSPROC         glDeleteVertexArrays = 0;
 
+PFNGLDRAWARRAYSINSTANCEDPROC        glDrawArraysInstanced = 0;
+PFNGLVERTEXATTRIBDIVISORPROC        glVertexAttribDivisor = 0;
+
 PFNGLFRAMEBUFFERRENDERBUFFERPROC    glFramebufferRenderbuffer = 0;
 PFNGLBINDRENDERBUFFERPROC           glBindRenderbuffer = 0;
 PFNGLGENRENDERBUFFERSPROC           glGenRenderbuffers = 0;
@@ -171,6 +174,14 @@ void InitOpenGLExtensions()
     glGenVertexArrays               = (PFNGLGENVERTEXARRAYSPROC)            wglGetProcAddress( "glGenVertexArrays" );
     glDeleteVertexArrays            = (PFNGLDELETEVERTEXARRAYSPROC)         wglGetProcAddress( "glDeleteVertexArrays" );
 
+    glDrawArraysInstanced           = (PFNGLDRAWARRAYSINSTANCEDPROC)        wglGetProcAddress( "glDrawArraysInstanced" );
+    if( glDrawArraysInstanced == 0 )
+        glDrawArraysInstanced       = (PFNGLDRAWARRAYSINSTANCEDPROC)        wglGetProcAddress( "glDrawArraysInstancedARB" );
+
+    glVertexAttribDivisor           = (PFNGLVERTEXATTRIBDIVISORPROC)        wglGetProcAddress( "glVertexAttribDivisor" );
+    if( glVertexAttribDivisor == 0 )
+        glVertexAttribDivisor       = (PFNGLVERTEXATTRIBDIVISORPROC)        wglGetProcAddress( "glVertexAttribDivisorARB" );
+
     glFramebufferRenderbuffer       = (PFNGLFRAMEBUFFERRENDERBUFFERPROC)    wglGetProcAddress( "glFramebufferRenderbuffer" );
     if( glFramebufferRenderbuffer == 0 )
         glFramebufferRenderbuffer   = (PFNGLFRAMEBUFFERRENDERBUFFERPROC)    wglGetProcAddress( "glFramebufferRenderbufferEXT" );
@@ -80,6 +80,9 @@ extern PFNGLBINDVERTEXARRAYPROC             glBindVertexArray;
 extern PFNGLGENVERTEXARRAYSPROC             glGenVertexArrays;
 extern PFNGLDELETEVERTEXARRAYSPROC          glDeleteVertexArrays;
 
+extern PFNGLDRAWARRAYSINSTANCEDPROC         glDrawArraysInstanced;
+extern PFNGLVERTEXATTRIBDIVISORPROC         glVertexAttribDivisor;
+
 extern PFNGLFRAMEBUFFERRENDERBUFFERPROC     glFramebufferRenderbuffer;
 extern PFNGLBINDRENDERBUFFERPROC            glBindRenderbuffer;
 extern PFNGLGENRENDERBUFFERSPROC            glGenRenderbuffers;
@@ -17,10 +17,12 @@ namespace GameDev2D
         //Set the window's title
         SetWindowTitle(aWindowTitle);
 
-        //Cache the performance counter frequency
+        //Cache the performance counter frequency (counts per second) and the count the app started up at
         LARGE_INTEGER largeInt;
 	    QueryPerformanceFrequency(&largeInt);
-	    m_PerformanceCounterFrequency = double(largeInt.QuadPart) / 1000.0;
+	    m_PerformanceCounterFrequency = largeInt.QuadPart;
+        QueryPerformanceCounter(&largeInt);
+        m_InitCounter = largeInt.QuadPart;
     }
 
     Platform_Windows::~Platform_Windows()
@@ -372,6 +374,27 @@ namespace GameDev2D
         return (fileAttributes != INVALID_FILE_ATTRIBUTES && !(fileAttributes & FILE_ATTRIBUTE_DIRECTORY));
     }
 
+    bool Platform_Windows::ReplaceFileAtPath(const string& aSourcePath, const string& aDestinationPath)
+    {
+        //MoveFileEx replaces the destination file, write through doesn't return until the file has been moved on disk
+        return MoveFileExA(aSourcePath.c_str(), aDestinationPath.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+    }
+
+    unsigned long long Platform_Windows::GetModificationTimeForFileAtPath(const string& aPath)
+    {
+        WIN32_FILE_ATTRIBUTE_DATA fileAttributes;
+        if(GetFileAttributesExA(aPath.c_str(), GetFileExInfoStandard, &fileAttributes) == 0)
+        {
+            return 0;
+        }
+
+        //The file time is in 100 nanosecond intervals since 1601, convert it to nanoseconds since 1970
+        ULARGE_INTEGER fileTime;
+        fileTime.LowPart = fileAttributes.ftLastWriteTime.dwLowDateTime;
+        fileTime.HighPart = fileAttributes.ftLastWriteTime.dwHighDateTime;
+        return (fileTime.QuadPart - 116444736000000000ULL) * 100ULL;
+    }
+
     int Platform_Windows::PresentNativeDialogBox(const char* aTitle, const char* aMessage, NativeDialogType aType)
     {   
         //Determine the type of windows dialog box to display
@@ -526,10 +549,18 @@ namespace GameDev2D
     }
     
     unsigned int Platform_Windows::GetTicks()
+    {
+        return (unsigned int)(GetTimeNanoseconds() / 1000000);
+    }
+    
+    unsigned long long Platform_Windows::GetTimeNanoseconds()
     {
 	    LARGE_INTEGER largeInt;
 	    QueryPerformanceCounter(&largeInt);
-        unsigned int ticks = (unsigned int)(largeInt.QuadPart / m_PerformanceCounterFrequency);
-	    return ticks;
+        unsigned long long counter = (unsigned long long)(largeInt.QuadPart - m_InitCounter);
+        unsigned long long frequency = (unsigned long long)m_PerformanceCounterFrequency;
+
+        //Convert the whole seconds and the remainder separately, multiplying the count by a billion would overflow
+        return (counter / frequency) * 1000000000 + (counter % frequency) * 1000000000 / frequency;
     }
 }
\ No newline at end of file
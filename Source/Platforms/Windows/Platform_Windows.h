@@ -109,6 +109,12 @@ namespace GameDev2D
         //Returns wether the file exists at the path, inherited from PlatformLayer
         bool DoesFileExistAtPath(const string& path);
         
+        //Moves the file at the source path to the destination path, replacing the destination file, inherited from PlatformLayer
+        bool ReplaceFileAtPath(const string& sourcePath, const string& destinationPath);
+        
+        //Returns the time the file at the path was last modified (in nanoseconds since 1970), inherited from PlatformLayer
+        unsigned long long GetModificationTimeForFileAtPath(const string& path);
+        
         //Presents a platform specific native dialog box, inherited from PlatformLayer
         int PresentNativeDialogBox(const char* title, const char* message, NativeDialogType type);
 
@@ -131,6 +137,9 @@ namespace GameDev2D
         
         //Returns the number of ticks since the start of the application, inherited from PlatformLayer
         unsigned int GetTicks();
+        
+        //Returns the number of nanoseconds since the start of the application, inherited from PlatformLayer
+        unsigned long long GetTimeNanoseconds();
     
     protected:
         //This method applies the changes set in the SetVideoModeInfo() method at the start of the
@@ -149,7 +158,8 @@ namespace GameDev2D
         GameWindow* m_GameWindow;
         bool m_IsFullScreen;
         bool m_IsMouseCursorVisible;
-        double m_PerformanceCounterFrequency;
+        LONGLONG m_PerformanceCounterFrequency;
+        LONGLONG m_InitCounter;
         VideoModeInfo_Win32 m_VideoModeChangeInfo;
     };
 }
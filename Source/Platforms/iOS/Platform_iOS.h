@@ -111,6 +111,12 @@ namespace GameDev2D
         //Returns wether the file exists at the path, inherited from PlatformLayer
         bool DoesFileExistAtPath(const string& path);
         
+        //Moves the file at the source path to the destination path, replacing the destination file, inherited from PlatformLayer
+        bool ReplaceFileAtPath(const string& sourcePath, const string& destinationPath);
+        
+        //Returns the time the file at the path was last modified (in nanoseconds since 1970), inherited from PlatformLayer
+        unsigned long long GetModificationTimeForFileAtPath(const string& path);
+        
         //Dispatches a low memory warning, if you receive this event you should unload any un-needed resources
         void LowMemoryWarning();
         
@@ -142,6 +148,9 @@ namespace GameDev2D
         
         //Returns the number of ticks since the start of the application, inherited from PlatformLayer
         unsigned int GetTicks();
+        
+        //Returns the number of nanoseconds since the start of the application, inherited from PlatformLayer
+        unsigned long long GetTimeNanoseconds();
     
     protected:
         //iOS requires specific render buffer storage, inherited from PlatformLayer
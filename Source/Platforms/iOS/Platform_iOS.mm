@@ -13,6 +13,7 @@
 #include <sys/sysctl.h>
 #include <sys/utsname.h>
 #include <sys/types.h>
+#include <sys/stat.h>
 #include <mach/mach.h>
 #include <mach/mach_host.h>
 #include <mach/mach_time.h>
@@ -378,6 +379,22 @@ namespace GameDev2D
         return fileExists;
     }
     
+    bool Platform_iOS::ReplaceFileAtPath(const string& aSourcePath, const string& aDestinationPath)
+    {
+        //The POSIX rename function atomically replaces the destination file
+        return rename(aSourcePath.c_str(), aDestinationPath.c_str()) == 0;
+    }
+    
+    unsigned long long Platform_iOS::GetModificationTimeForFileAtPath(const string& aPath)
+    {
+        struct stat fileStatus;
+        if(stat(aPath.c_str(), &fileStatus) != 0)
+        {
+            return 0;
+        }
+        return (unsigned long long)fileStatus.st_mtimespec.tv_sec * 1000000000ULL + (unsigned long long)fileStatus.st_mtimespec.tv_nsec;
+    }
+    
     void Platform_iOS::LowMemoryWarning()
     {
         //Dispatch event - low memory warning
@@ -530,13 +547,19 @@ namespace GameDev2D
     
     unsigned int Platform_iOS::GetTicks()
     {
-    	uint64_t time = mach_absolute_time();	
-        double conversion = 0.0;
-        
-        mach_timebase_info_data_t info;
-        mach_timebase_info( &info );
-        conversion = 1e-9 * (double) info.numer / (double) info.denom;	
+        return (unsigned int)(GetTimeNanoseconds() / 1000000);
+    }
+    
+    unsigned long long Platform_iOS::GetTimeNanoseconds()
+    {
+        //Cache the timebase, it converts the absolute time units to nanoseconds
+        static mach_timebase_info_data_t info = {0, 0};
+        if(info.denom == 0)
+        {
+            mach_timebase_info(&info);
+        }
         
-        return (((double)(time - m_InitTime)) * conversion) * 1000.0f;
+        uint64_t time = mach_absolute_time() - m_InitTime;
+        return (unsigned long long)((double)time * (double)info.numer / (double)info.denom);
     }
 }
\ No newline at end of file
@@ -7,9 +7,11 @@
 //
 
 #include "AudioManager.h"
+#include "FrameworkConfig.h"
 #include "../ServiceLocator.h"
 #include "../../Audio/Audio.h"
 #include "../../Platforms/PlatformLayer.h"
+#include "../../Core/MemoryTracker.h"
 
 
 #if TARGET_OS_IPHONE
@@ -20,7 +22,10 @@
 namespace GameDev2D
 {
     AudioManager::AudioManager() : GameService("AudioManager"),
-        m_System(nullptr)
+        m_System(nullptr),
+        m_NumberOfPlayingVoices(0),
+        m_VoiceSequence(0),
+        m_IsNullOutput(AUDIO_NULL_OUTPUT == 1)
     {
         //Create the FMOD system
         if(FMOD::System_Create(&m_System) != FMOD_OK)
@@ -28,14 +33,37 @@ namespace GameDev2D
             Error(true, "The Audio Manager failed to initialize FMOD");
         }
         
+        //Use the no sound output if it was requested
+        if(m_IsNullOutput == true)
+        {
+            m_System->setOutput(FMOD_OUTPUTTYPE_NOSOUND);
+        }
+        
         //Initialize the audio channels for the FMOD system
         if(m_System->init(MAX_AUDIO_CHANNELS, FMOD_INIT_NORMAL, NULL) != FMOD_OK)
         {
-            Error(true, "The Audio Manager failed to initialize FMOD");
+            //There might not be an audio device (headless), fall back to the no sound output
+            bool didInitialize = false;
+            if(m_IsNullOutput == false)
+            {
+                Log(VerbosityLevel_Audio, "The Audio Manager failed to initialize FMOD, falling back to the no sound output");
+                m_IsNullOutput = true;
+                m_System->setOutput(FMOD_OUTPUTTYPE_NOSOUND);
+                didInitialize = m_System->init(MAX_AUDIO_CHANNELS, FMOD_INIT_NORMAL, NULL) == FMOD_OK;
+            }
+            
+            //If the no sound output failed too, there's nothing else to fall back on
+            if(didInitialize == false)
+            {
+                Error(true, "The Audio Manager failed to initialize FMOD");
+            }
         }
         
         //Add a resume event listener
         ServiceLocator::GetPlatformLayer()->AddEventListener(this, RESUME_EVENT);
+        
+        //The ResourceManager releases the evicted sounds through the AudioManager
+        ServiceLocator::GetResourceManager()->SetResourceUnloader(ResourceTypeSound, this);
     }
 
     AudioManager::~AudioManager()
@@ -43,6 +71,10 @@ namespace GameDev2D
         //Remove the resume event listener
         ServiceLocator::GetPlatformLayer()->RemoveEventListener(this, RESUME_EVENT);
         
+        //Stop the sound effect voices, the shared sounds are released with the rest of the sounds below
+        StopAllSoundEffects();
+        m_SoundEffects.clear();
+        
         //Release any streams that are remaining
         while(m_Streams.empty() == false)
         {
@@ -50,12 +82,9 @@ namespace GameDev2D
             m_Streams.pop_back();
         }
         
-        //Cycle through and release any existing system sounds
-        while(m_SoundMap.size() > 0)
-        {
-            m_SoundMap.begin()->second.first->release();
-            m_SoundMap.erase(m_SoundMap.begin());
-        }
+        //Release any existing system sounds, before the FMOD system is released
+        ServiceLocator::GetResourceManager()->UnloadResources(ResourceTypeSound);
+        ServiceLocator::GetResourceManager()->SetResourceUnloader(ResourceTypeSound, nullptr);
         
         //Release the FMOD system
         if(m_System != nullptr)
@@ -73,10 +102,32 @@ namespace GameDev2D
             m_System->update();
         }
         
-        //Update the audio sources
-        for(unsigned int i = 0; i < m_AudioSources.size(); i++)
+        //Release the voices that have finished playing, only the playing voices are checked
+        unsigned int i = 0;
+        while(i < m_NumberOfPlayingVoices)
         {
-            m_AudioSources.at(i)->Update(aDelta);
+            bool isPlaying = false;
+            if(m_Voices[i].channel->isPlaying(&isPlaying) != FMOD_OK || isPlaying == false)
+            {
+                ReleaseVoice(i);
+            }
+            else
+            {
+                i++;
+            }
+        }
+        
+        //Update the audio sources, once their delays and tweens are done they no longer need to be updated.
+        //Cycle backwards so that the audio sources can be unregistered while cycling through them
+        for(int j = (int)m_AudioSources.size() - 1; j >= 0; j--)
+        {
+            Audio* audio = m_AudioSources.at(j);
+            audio->Update(aDelta);
+            
+            if(audio->IsUpdating() == false)
+            {
+                m_AudioSources.erase(m_AudioSources.begin() + j);
+            }
         }
     }
     
@@ -134,11 +185,11 @@ namespace GameDev2D
             //Create a key for the filename and extension
             string key = aFilename + "." + aExtension;
         
-            //Check to see if the Audio object is already loaded in the sound map
-            pair<FMOD::Sound*, unsigned int> soundPair = m_SoundMap[key];
+            //Check to see if the sound is already resident
+            Resource* resource = ServiceLocator::GetResourceManager()->GetResource(ResourceTypeSound, key);
             
-            //Is the sound pointer null? That means it doesn't exist yet
-            if(soundPair.first == nullptr)
+            //Is the resource null? That means it doesn't exist yet
+            if(resource == nullptr)
             {
                 //Get the path for the texture
                 string path = ServiceLocator::GetPlatformLayer()->GetPathForResourceInDirectory(aFilename.c_str(), aExtension.c_str(), "Audio");
@@ -167,22 +218,22 @@ namespace GameDev2D
                 }
                 else
                 {
-                    //Set the sound pointer and set the reference count to 1
-                    soundPair.first = sound;
-                    soundPair.second = 1;
+                    //Track the sound's decoded sample data
+                    unsigned int numberOfBytes = GetSoundNumberOfBytes(sound);
+                    MemoryTracker::TrackAllocation(MemoryTag_Audio, numberOfBytes);
+                    
+                    //Add the sound's resource and set the reference count to 1
+                    resource = ServiceLocator::GetResourceManager()->AddResource(ResourceTypeSound, key, sound, numberOfBytes, 1);
                 }
             }
             else
             {
                 //The sound is already loaded increment the reference count
-                soundPair.second++;
+                ServiceLocator::GetResourceManager()->AddReference(resource);
             }
             
-            //Set the sound pair
-            m_SoundMap[key] = soundPair;
-            
-            //And return the Audio object
-            return soundPair.first;
+            //And return the sound object
+            return (FMOD::Sound*)resource->object;
         }
 
         //If we got here, we failed to load a sound, return null
@@ -223,29 +274,15 @@ namespace GameDev2D
         }
         else
         {
-            //Get the sound pair for the key
-            pair<FMOD::Sound*, unsigned int> soundPair = m_SoundMap[aKey];
+            //Get the sound's resource for the key
+            Resource* resource = ServiceLocator::GetResourceManager()->GetResource(ResourceTypeSound, aKey);
             
-            //Safety check the sound pair
-            if(soundPair.first == aSound)
+            //Safety check the resource
+            if(resource != nullptr && resource->object == aSound)
             {
-                //Subract from the retain counter
-                soundPair.second--;
-                
-                //Has the counter reacher zero?
-                if(soundPair.second == 0)
-                {
-                    //Release the sound object
-                    aSound->release();
-
-                    //Erase the name from the map
-                    m_SoundMap.erase(aKey);
-                }
-                else
-                {
-                    //Set the sound map pair for the name key
-                    m_SoundMap[aKey] = soundPair;
-                }
+                //Subract from the reference count, if the purge unused sounds config is enabled the
+                //sound is released immediately if the reference count reaches zero
+                ServiceLocator::GetResourceManager()->RemoveReference(resource, PURGE_UNUSED_SOUNDS_IMMEDIATELY == 1);
                 
                 //Return success!
                 return true;
@@ -258,7 +295,7 @@ namespace GameDev2D
     
     void AudioManager::RegisterAudio(Audio* aAudio)
     {
-        if(aAudio != nullptr)
+        if(aAudio != nullptr && ContainsAudio(aAudio) == false)
         {
             m_AudioSources.push_back(aAudio);
         }
@@ -286,10 +323,161 @@ namespace GameDev2D
         }
     }
     
+    bool AudioManager::ContainsAudio(Audio* aAudio)
+    {
+        for(unsigned int i = 0; i < m_AudioSources.size(); i++)
+        {
+            if(m_AudioSources.at(i) == aAudio)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+    
     unsigned int AudioManager::GetMaxChannels()
     {
         return MAX_AUDIO_CHANNELS;
     }
+    
+    bool AudioManager::PlaySoundEffect(const string& aFilename, const string& aExtension, int aPriority, float aVolume, float aPan)
+    {
+        //Get the shared sound for the sound effect
+        FMOD::Sound* sound = GetSoundEffect(aFilename, aExtension);
+        if(sound == nullptr)
+        {
+            return false;
+        }
+        
+        //Use the next free voice, if all the voices are playing one has to be stolen
+        unsigned int index = m_NumberOfPlayingVoices;
+        if(index == MAX_SOUND_EFFECT_VOICES)
+        {
+            //If every voice is more important than this sound effect, it isn't played
+            index = GetVoiceToSteal(aPriority);
+            if(index == MAX_SOUND_EFFECT_VOICES)
+            {
+                return false;
+            }
+            
+            //Stop the stolen voice's channel
+            m_Voices[index].channel->stop();
+        }
+        else
+        {
+            m_NumberOfPlayingVoices++;
+        }
+        
+        //Play the sound paused, so the channel settings can be applied first
+        FMOD::Channel* channel = nullptr;
+        if(m_System->playSound(FMOD_CHANNEL_FREE, sound, true, &channel) != FMOD_OK)
+        {
+            Error(false, "Failed to play sound effect %s.%s", aFilename.c_str(), aExtension.c_str());
+            ReleaseVoice(index);
+            return false;
+        }
+        
+        //Set the channel's volume, pan and priority, then start playing
+        channel->setVolume(fminf(fmaxf(aVolume, 0.0f), 1.0f));
+        channel->setPan(fminf(fmaxf(aPan, -1.0f), 1.0f));
+        channel->setPriority(aPriority);
+        channel->setPaused(false);
+        
+        //Set the voice
+        m_Voices[index].channel = channel;
+        m_Voices[index].priority = aPriority;
+        m_Voices[index].sequence = m_VoiceSequence++;
+        return true;
+    }
+    
+    void AudioManager::PreloadSoundEffect(const string& aFilename, const string& aExtension)
+    {
+        GetSoundEffect(aFilename, aExtension);
+    }
+    
+    void AudioManager::StopAllSoundEffects()
+    {
+        //Stop the playing voices
+        for(unsigned int i = 0; i < m_NumberOfPlayingVoices; i++)
+        {
+            m_Voices[i].channel->stop();
+        }
+        m_NumberOfPlayingVoices = 0;
+    }
+    
+    unsigned int AudioManager::GetNumberOfPlayingVoices()
+    {
+        return m_NumberOfPlayingVoices;
+    }
+    
+    bool AudioManager::IsNullOutput()
+    {
+        return m_IsNullOutput;
+    }
+    
+    FMOD::Sound* AudioManager::GetSoundEffect(const string& aFilename, const string& aExtension)
+    {
+        //Is the sound effect already loaded?
+        string key = aFilename + "." + aExtension;
+        map<string, FMOD::Sound*>::iterator iterator = m_SoundEffects.find(key);
+        if(iterator != m_SoundEffects.end())
+        {
+            return iterator->second;
+        }
+        
+        //Load the sound, this retains it in the ResourceManager (the Audio objects share it) until the AudioManager is deleted
+        FMOD::System* system = nullptr;
+        FMOD::Sound* sound = LoadSound(&system, aFilename, aExtension, false, false);
+        if(sound != nullptr)
+        {
+            m_SoundEffects[key] = sound;
+        }
+        return sound;
+    }
+    
+    unsigned int AudioManager::GetSoundNumberOfBytes(FMOD::Sound* aSound)
+    {
+        unsigned int bytes = 0;
+        if(aSound->getLength(&bytes, FMOD_TIMEUNIT_PCMBYTES) != FMOD_OK)
+        {
+            bytes = 0;
+        }
+        return bytes;
+    }
+    
+    unsigned int AudioManager::GetVoiceToSteal(int aPriority)
+    {
+        //Find the least important voice, the oldest voice is stolen if the priorities are the same
+        unsigned int index = MAX_SOUND_EFFECT_VOICES;
+        for(unsigned int i = 0; i < m_NumberOfPlayingVoices; i++)
+        {
+            //Voices that are more important than the priority can't be stolen
+            if(m_Voices[i].priority < aPriority)
+            {
+                continue;
+            }
+            
+            if(index == MAX_SOUND_EFFECT_VOICES || m_Voices[i].priority > m_Voices[index].priority ||
+              (m_Voices[i].priority == m_Voices[index].priority && m_Voices[i].sequence < m_Voices[index].sequence))
+            {
+                index = i;
+            }
+        }
+        return index;
+    }
+    
+    void AudioManager::ReleaseVoice(unsigned int aIndex)
+    {
+        //If this assert is hit, the index is not a playing voice
+        assert(aIndex < m_NumberOfPlayingVoices);
+        
+        //Move the last playing voice into the released voice's slot
+        m_NumberOfPlayingVoices--;
+        if(aIndex != m_NumberOfPlayingVoices)
+        {
+            m_Voices[aIndex] = m_Voices[m_NumberOfPlayingVoices];
+        }
+    }
 
     bool AudioManager::CanUpdate()
     {
@@ -315,4 +503,12 @@ namespace GameDev2D
             break;
         }
     }
+    
+    void AudioManager::UnloadResource(ResourceType aType, void* aObject)
+    {
+        //Release the sound object
+        FMOD::Sound* sound = (FMOD::Sound*)aObject;
+        MemoryTracker::TrackDeallocation(MemoryTag_Audio, GetSoundNumberOfBytes(sound));
+        sound->release();
+    }
 }
\ No newline at end of file
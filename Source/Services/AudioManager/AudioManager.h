@@ -10,6 +10,7 @@
 #define __GameDev2D__AudioManager__
 
 #include "../GameService.h"
+#include "../ResourceManager/ResourceManager.h"
 #include <fmod.hpp>
 
 
@@ -22,12 +23,27 @@ namespace GameDev2D
 
     //Local constants
     const unsigned int MAX_AUDIO_CHANNELS = 32;
+    const unsigned int MAX_SOUND_EFFECT_VOICES = 16;
+    const int SOUND_EFFECT_DEFAULT_PRIORITY = 128;
+
+    //A voice is one playing instance of a sound effect, the sound itself is shared by every voice
+    struct SoundEffectVoice
+    {
+        FMOD::Channel* channel;
+        int priority;
+        unsigned int sequence;
+    };
 
     //The AudioManager leverages the FMOD library to load and play audio files. It can load
     //complete sounds (for SFX) or stream larger audio files (for background music). You can
     //load as many 'sounds' as you want (up to 32 at a time), but the AudioManager limits
-    //streams to one at time and uses reference counting to ensures only one will be loaded.
-    class AudioManager : public GameService
+    //streams to one at time. The sounds are reference counted by the ResourceManager to
+    //ensure only one will be loaded, unused sounds stay resident until they are evicted.
+    //Short sound effects can also be played fire and forget with PlaySoundEffect(), they are
+    //played on a fixed pool of voices and don't need an Audio object. If there isn't an audio
+    //device (or AUDIO_NULL_OUTPUT is set) FMOD's no sound output is used, everything still
+    //plays and finishes on time, it just can't be heard.
+    class AudioManager : public GameService, public ResourceUnloader
     {
     public:
         AudioManager();
@@ -38,6 +54,24 @@ namespace GameDev2D
         
         //Returns the max number of channels that are available
         unsigned int GetMaxChannels();
+
+        //Plays a sound effect, fire and forget. The sound is loaded the first time it is played and is shared
+        //by every voice after that. Priority follows FMOD, 0 is the most important and 256 the least. If all the
+        //voices are playing, the least important (then oldest) voice is stolen, as long as it isn't more important
+        //than the sound effect being played. Returns false if the sound effect couldn't be played
+        bool PlaySoundEffect(const string& filename, const string& extension, int priority = SOUND_EFFECT_DEFAULT_PRIORITY, float volume = 1.0f, float pan = 0.0f);
+
+        //Loads a sound effect ahead of time, so the first time it is played doesn't have to load it
+        void PreloadSoundEffect(const string& filename, const string& extension);
+
+        //Stops all the sound effect voices that are playing
+        void StopAllSoundEffects();
+
+        //Returns the number of sound effect voices that are currently playing
+        unsigned int GetNumberOfPlayingVoices();
+
+        //Returns wether FMOD is using the no sound output
+        bool IsNullOutput();
         
         //Used to determine if the AudioManager should be updated and drawn
         bool CanUpdate();
@@ -45,13 +79,17 @@ namespace GameDev2D
         
         //Handles events, we need to handle a resume event
         void HandleEvent(Event* event);
+        
+        //Releases a sound evicted by the ResourceManager, inherited from ResourceUnloader
+        void UnloadResource(ResourceType type, void* object);
     
     protected:
         //Used to load and unload sound, access by the Audio class
         FMOD::Sound* LoadSound(FMOD::System** system, const string& filename, const string& extension, bool streamed, bool looped);
         bool UnloadSound(FMOD::Sound* sound, const string& key);
         
-        //Conveniance method to register and unregister Audio objects
+        //Conveniance method to register and unregister Audio objects, an Audio object is only
+        //registered (and updated) while it has a delay or a tween running
         void RegisterAudio(Audio* audio);
         void UnregisterAudio(Audio* audio);
         
@@ -62,11 +100,27 @@ namespace GameDev2D
         friend class Audio;
     
     private:
+        //Returns the shared sound for a sound effect, it is loaded the first time
+        FMOD::Sound* GetSoundEffect(const string& filename, const string& extension);
+
+        //Returns the number of bytes of sample data a sound uses, tracked by the MemoryTracker
+        unsigned int GetSoundNumberOfBytes(FMOD::Sound* sound);
+
+        //Returns the index of the voice to steal for the priority, returns MAX_SOUND_EFFECT_VOICES if there isn't one
+        unsigned int GetVoiceToSteal(int priority);
+
+        //Releases the voice at the index, the last playing voice is moved into its slot
+        void ReleaseVoice(unsigned int index);
+
         //Member variables
         FMOD::System* m_System;
-        map<string, pair<FMOD::Sound*, unsigned int>> m_SoundMap;
         vector<FMOD::Sound*> m_Streams;
         vector<Audio*> m_AudioSources;
+        map<string, FMOD::Sound*> m_SoundEffects;
+        SoundEffectVoice m_Voices[MAX_SOUND_EFFECT_VOICES];
+        unsigned int m_NumberOfPlayingVoices;
+        unsigned int m_VoiceSequence;
+        bool m_IsNullOutput;
     };
 }
 
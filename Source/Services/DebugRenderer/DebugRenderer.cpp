@@ -0,0 +1,327 @@
+//
+//  DebugRenderer.cpp
+//  GameDev2D
+//
+
+#include "DebugRenderer.h"
+#include "../ServiceLocator.h"
+#include "../../Graphics/Core/Shader.h"
+#include "../../Graphics/Fonts/TrueTypeFont.h"
+#include "../../Graphics/Textures/Texture.h"
+#include "../../Graphics/Textures/TextureFrame.h"
+
+
+namespace GameDev2D
+{
+    DebugRenderer::DebugRenderer() : GameService("DebugRenderer"),
+        m_Font(nullptr),
+        m_LineVertexArrayObject(0),
+        m_LineVertexBufferObject(0),
+        m_TextVertexArrayObject(0),
+        m_TextVertexBufferObject(0)
+    {
+
+    }
+
+    DebugRenderer::~DebugRenderer()
+    {
+        //Release the font
+        if(m_Font != nullptr)
+        {
+            ServiceLocator::GetFontManager()->RemoveFont(m_Font);
+            m_Font = nullptr;
+        }
+
+        //Delete the VBOs and VAOs
+        if(m_LineVertexBufferObject != 0)
+        {
+            glDeleteBuffers(1, &m_LineVertexBufferObject);
+        }
+
+        if(m_LineVertexArrayObject != 0)
+        {
+            glDeleteVertexArrays(1, &m_LineVertexArrayObject);
+        }
+
+        if(m_TextVertexBufferObject != 0)
+        {
+            glDeleteBuffers(1, &m_TextVertexBufferObject);
+        }
+
+        if(m_TextVertexArrayObject != 0)
+        {
+            glDeleteVertexArrays(1, &m_TextVertexArrayObject);
+        }
+    }
+
+    void DebugRenderer::Draw()
+    {
+        Flush();
+    }
+
+    bool DebugRenderer::CanUpdate()
+    {
+        return false;
+    }
+
+    bool DebugRenderer::CanDraw()
+    {
+        return m_LineVertices.size() > 0 || m_TextVertices.size() > 0;
+    }
+
+    void DebugRenderer::DrawLine(vec2 aStart, vec2 aEnd, Color aColor)
+    {
+        const vec2 vertices[2] = { aStart, aEnd };
+        for(unsigned int i = 0; i < 2; i++)
+        {
+            m_LineVertices.push_back(vertices[i].x);
+            m_LineVertices.push_back(vertices[i].y);
+            m_LineVertices.push_back(aColor.Red());
+            m_LineVertices.push_back(aColor.Green());
+            m_LineVertices.push_back(aColor.Blue());
+            m_LineVertices.push_back(aColor.Alpha());
+        }
+    }
+
+    void DebugRenderer::DrawRect(vec2 aPosition, vec2 aSize, Color aColor)
+    {
+        vec2 topRight = aPosition + aSize;
+        DrawLine(aPosition, vec2(topRight.x, aPosition.y), aColor);
+        DrawLine(vec2(topRight.x, aPosition.y), topRight, aColor);
+        DrawLine(topRight, vec2(aPosition.x, topRight.y), aColor);
+        DrawLine(vec2(aPosition.x, topRight.y), aPosition, aColor);
+    }
+
+    void DebugRenderer::DrawText(const string& aText, vec2 aPosition, Color aColor, float aFontSize, vec2 aAnchorPoint)
+    {
+        //Is there any text to draw, and is the font's glyph atlas loaded
+        Texture* atlas = aText.length() > 0 ? GetFontAtlas() : nullptr;
+        if(atlas == nullptr)
+        {
+            return;
+        }
+
+        //The glyphs are scaled from the atlas' font size to the requested font size
+        float fontScale = aFontSize / (float)m_Font->GetFontSize();
+        float lineHeight = (float)m_Font->GetLineHeight();
+
+        //Measure the width of each line, the same way the Label does
+        m_LineWidths.clear();
+        m_LineWidths.push_back(0.0f);
+        float width = 0.0f;
+        for(unsigned int i = 0; i < aText.length(); i++)
+        {
+            if(aText.at(i) == '\n')
+            {
+                m_LineWidths.push_back(0.0f);
+                continue;
+            }
+
+            m_LineWidths.back() += m_Font->GetAdvanceXForCharacter(aText.at(i));
+            width = fmaxf(width, m_LineWidths.back());
+        }
+
+        //Calculate the origin of the first line, from the anchor point
+        vec2 size = vec2(width, lineHeight * m_LineWidths.size());
+        vec2 position = aPosition - size * fontScale * aAnchorPoint;
+        vec2 origin = vec2((width - m_LineWidths.at(0)) / 2.0f, (lineHeight - m_Font->GetBaseLine()) + lineHeight * (m_LineWidths.size() - 1));
+        unsigned int lineIndex = 0;
+
+        //Cycle through the characters and add a quad for each one
+        vec2 textureSize = vec2(atlas->GetSize());
+        for(unsigned int i = 0; i < aText.length(); i++)
+        {
+            char character = aText.at(i);
+
+            //Did we reach a new line? Center the next line
+            if(character == '\n')
+            {
+                lineIndex++;
+                origin.x = (width - m_LineWidths.at(lineIndex)) / 2.0f;
+                origin.y -= lineHeight;
+                continue;
+            }
+
+            //Calculate the character's bottom left corner and size, based on the x and y bearing
+            SourceFrame sourceFrame = m_Font->GetSourceFrameForCharacter(character);
+            vec2 corner = origin + vec2(m_Font->GetBearingXForCharacter(character), m_Font->GetBearingYForCharacter(character) - sourceFrame.size.y);
+            vec2 minimum = position + corner * fontScale;
+            vec2 maximum = minimum + sourceFrame.size * fontScale;
+
+            //Build the UV Coordinates, the same as the TextureFrame does
+            float x1 = sourceFrame.position.x / textureSize.x;
+            float y1 = 1.0f - ((sourceFrame.position.y + sourceFrame.size.y) / textureSize.y);
+            float x2 = (sourceFrame.position.x + sourceFrame.size.x) / textureSize.x;
+            float y2 = 1.0f - (sourceFrame.position.y / textureSize.y);
+
+            //The character's corners and uv coordinates, as two triangles
+            const vec4 vertices[DEBUG_RENDERER_TEXT_VERTICES_PER_CHARACTER] = { vec4(minimum.x, minimum.y, x1, y1), vec4(maximum.x, minimum.y, x2, y1), vec4(minimum.x, maximum.y, x1, y2),
+                                                                                 vec4(minimum.x, maximum.y, x1, y2), vec4(maximum.x, minimum.y, x2, y1), vec4(maximum.x, maximum.y, x2, y2) };
+            for(unsigned int j = 0; j < DEBUG_RENDERER_TEXT_VERTICES_PER_CHARACTER; j++)
+            {
+                m_TextVertices.push_back(vertices[j].x);
+                m_TextVertices.push_back(vertices[j].y);
+                m_TextVertices.push_back(vertices[j].z);
+                m_TextVertices.push_back(vertices[j].w);
+                m_TextVertices.push_back(aColor.Red());
+                m_TextVertices.push_back(aColor.Green());
+                m_TextVertices.push_back(aColor.Blue());
+                m_TextVertices.push_back(aColor.Alpha());
+            }
+
+            //Advance the origin
+            origin.x += m_Font->GetAdvanceXForCharacter(character);
+        }
+    }
+
+    void DebugRenderer::Flush()
+    {
+        //Draw the lines, then the text on top of them
+        if(m_LineVertices.size() > 0)
+        {
+            DrawLines();
+        }
+
+        if(m_TextVertices.size() > 0)
+        {
+            DrawCharacters();
+        }
+
+        //Clear the vertices, the capacity is kept for the next frame
+        m_LineVertices.clear();
+        m_TextVertices.clear();
+    }
+
+    void DebugRenderer::DrawLines()
+    {
+        //Safety check the shader, and that it passed validation when it was linked
+        Shader* shader = ServiceLocator::GetShaderManager()->GetPassthroughShader();
+        if(shader == nullptr || shader->IsValid() == false)
+        {
+            return;
+        }
+
+        //Use the shader
+        Graphics* graphics = ServiceLocator::GetGraphics();
+        shader->Use();
+
+        //If the VAO hasn't been generated yet, generate one and the VBO that goes with it
+        if(m_LineVertexArrayObject == 0)
+        {
+            glGenVertexArrays(1, &m_LineVertexArrayObject);
+            glGenBuffers(1, &m_LineVertexBufferObject);
+
+            //Bind the VAO and VBO
+            graphics->BindVertexArray(m_LineVertexArrayObject);
+            glBindBuffer(GL_ARRAY_BUFFER, m_LineVertexBufferObject);
+
+            //Set the shader's attributes, the vertex data is interleaved: x, y, r, g, b, a
+            GLsizei stride = sizeof(float) * DEBUG_RENDERER_LINE_FLOATS_PER_VERTEX;
+            int verticesIndex = shader->GetAttribute("a_vertices");
+            glEnableVertexAttribArray(verticesIndex);
+            glVertexAttribPointer(verticesIndex, 2, GL_FLOAT, GL_FALSE, stride, (void*)0);
+
+            int colorIndex = shader->GetAttribute("a_sourceColor");
+            glEnableVertexAttribArray(colorIndex);
+            glVertexAttribPointer(colorIndex, 4, GL_FLOAT, GL_FALSE, stride, (void*)(sizeof(float) * 2));
+        }
+        else
+        {
+            //Bind the VAO and VBO
+            graphics->BindVertexArray(m_LineVertexArrayObject);
+            glBindBuffer(GL_ARRAY_BUFFER, m_LineVertexBufferObject);
+        }
+
+        //Set the vertex buffer data
+        glBufferData(GL_ARRAY_BUFFER, sizeof(float) * m_LineVertices.size(), &m_LineVertices[0], GL_STREAM_DRAW);
+
+        //The vertices are already in world space, only the projection and view matrices are needed
+        mat4 viewProjection = graphics->GetViewProjectionMatrix();
+        glUniformMatrix4fv(shader->GetModelViewProjectionUniform(), 1, 0, &viewProjection[0][0]);
+        glVertexAttrib1f(shader->GetAttribute("a_pointSize"), 1.0f);
+
+        //Draw all the lines, the vertex array is left bound until another one is bound
+        graphics->EnableBlending();
+        graphics->AddDrawCall();
+        glDrawArrays(GL_LINES, 0, (GLsizei)(m_LineVertices.size() / DEBUG_RENDERER_LINE_FLOATS_PER_VERTEX));
+    }
+
+    void DebugRenderer::DrawCharacters()
+    {
+        //Safety check the shader, and that it passed validation when it was linked
+        Shader* shader = ServiceLocator::GetShaderManager()->GetPassthroughTextureShader();
+        if(shader == nullptr || shader->IsValid() == false)
+        {
+            return;
+        }
+
+        //Use the shader
+        Graphics* graphics = ServiceLocator::GetGraphics();
+        shader->Use();
+
+        //If the VAO hasn't been generated yet, generate one and the VBO that goes with it
+        if(m_TextVertexArrayObject == 0)
+        {
+            glGenVertexArrays(1, &m_TextVertexArrayObject);
+            glGenBuffers(1, &m_TextVertexBufferObject);
+
+            //Bind the VAO and VBO
+            graphics->BindVertexArray(m_TextVertexArrayObject);
+            glBindBuffer(GL_ARRAY_BUFFER, m_TextVertexBufferObject);
+
+            //Set the shader's attributes, the vertex data is interleaved: x, y, u, v, r, g, b, a
+            GLsizei stride = sizeof(float) * DEBUG_RENDERER_TEXT_FLOATS_PER_VERTEX;
+            int verticesIndex = shader->GetAttribute("a_vertices");
+            glEnableVertexAttribArray(verticesIndex);
+            glVertexAttribPointer(verticesIndex, 2, GL_FLOAT, GL_FALSE, stride, (void*)0);
+
+            int uvIndex = shader->GetAttribute("a_textureCoordinates");
+            glEnableVertexAttribArray(uvIndex);
+            glVertexAttribPointer(uvIndex, 2, GL_FLOAT, GL_FALSE, stride, (void*)(sizeof(float) * 2));
+
+            int colorIndex = shader->GetAttribute("a_textureColor");
+            glEnableVertexAttribArray(colorIndex);
+            glVertexAttribPointer(colorIndex, 4, GL_FLOAT, GL_FALSE, stride, (void*)(sizeof(float) * 4));
+        }
+        else
+        {
+            //Bind the VAO and VBO
+            graphics->BindVertexArray(m_TextVertexArrayObject);
+            glBindBuffer(GL_ARRAY_BUFFER, m_TextVertexBufferObject);
+        }
+
+        //Set the vertex buffer data
+        glBufferData(GL_ARRAY_BUFFER, sizeof(float) * m_TextVertices.size(), &m_TextVertices[0], GL_STREAM_DRAW);
+
+        //The vertices are already in world space, only the projection and view matrices are needed
+        mat4 viewProjection = graphics->GetViewProjectionMatrix();
+        glUniformMatrix4fv(shader->GetModelViewProjectionUniform(), 1, 0, &viewProjection[0][0]);
+        glUniform1i(shader->GetTextureUniform(), 0);
+
+        //Bind the glyph atlas
+        graphics->BindTexture(GetFontAtlas());
+
+        //Draw all the characters, the vertex array is left bound until another one is bound
+        graphics->EnableBlending();
+        graphics->AddDrawCall();
+        glDrawArrays(GL_TRIANGLES, 0, (GLsizei)(m_TextVertices.size() / DEBUG_RENDERER_TEXT_FLOATS_PER_VERTEX));
+    }
+
+    Texture* DebugRenderer::GetFontAtlas()
+    {
+        //Load the font the first time text is drawn
+        if(m_Font == nullptr)
+        {
+            m_Font = ServiceLocator::GetFontManager()->AddTrueTypeFont(DEBUG_RENDERER_FONT, "ttf", DEBUG_RENDERER_FONT_SIZE, CHARACTER_SET_ALPHA_NUMERIC_EXT);
+            if(m_Font == nullptr)
+            {
+                Error(false, "Failed to load the DebugRenderer's font: %s", DEBUG_RENDERER_FONT);
+                return nullptr;
+            }
+        }
+
+        //All the characters share the font's glyph atlas
+        TextureFrame* textureFrame = m_Font->GetTextureFrameForCharacter(' ');
+        return textureFrame != nullptr ? textureFrame->GetTexture() : nullptr;
+    }
+}
@@ -0,0 +1,82 @@
+//
+//  DebugRenderer.h
+//  GameDev2D
+//
+
+#ifndef __GameDev2D__DebugRenderer__
+#define __GameDev2D__DebugRenderer__
+
+#include "../GameService.h"
+#include "../../Graphics/Core/Color.h"
+
+
+using namespace std;
+using namespace glm;
+
+namespace GameDev2D
+{
+    //Local constants
+    const char* const DEBUG_RENDERER_FONT = "Ubuntu-B";
+    const unsigned int DEBUG_RENDERER_FONT_SIZE = 32;
+    const unsigned int DEBUG_RENDERER_LINE_FLOATS_PER_VERTEX = 6;
+    const unsigned int DEBUG_RENDERER_TEXT_FLOATS_PER_VERTEX = 8;
+    const unsigned int DEBUG_RENDERER_TEXT_VERTICES_PER_CHARACTER = 6;
+
+    //Forward Declarations
+    class Font;
+    class Texture;
+
+    //The DebugRenderer is an immediate mode renderer for debug data. Lines, rect outlines and text are added to a
+    //vertex buffer each frame, nothing is kept between frames. The text is drawn from a single font's glyph atlas
+    //and scaled to the requested font size, so everything that is added is drawn with two draw calls, one for the
+    //lines and one for the text. Flush() draws (and clears) what has been added, with the active Camera and
+    //RenderTarget, anything that isn't flushed by the end of the frame is drawn in the DebugRenderer's Draw().
+    class DebugRenderer : public GameService
+    {
+    public:
+        DebugRenderer();
+        ~DebugRenderer();
+
+        //Draws anything that wasn't flushed this frame
+        void Draw();
+
+        //Pure virtual method in GameService, needed to determine
+        //if we should update and draw this GameService
+        bool CanUpdate();
+        bool CanDraw();
+
+        //Adds a line, from the start position to the end position
+        void DrawLine(vec2 start, vec2 end, Color color);
+
+        //Adds a rect outline, the position is the bottom left corner of the rect
+        void DrawRect(vec2 position, vec2 size, Color color);
+
+        //Adds the text, the anchor point is relative to the text's size, new lines are centered
+        void DrawText(const string& text, vec2 position, Color color, float fontSize, vec2 anchorPoint = vec2(0.5f, 0.5f));
+
+        //Draws everything that has been added, with the active Camera and RenderTarget
+        void Flush();
+
+    private:
+        //Conveniance methods to draw the line and text vertices, each is a single draw call
+        void DrawLines();
+        void DrawCharacters();
+
+        //Returns the Texture of the font's glyph atlas, loads the font the first time text is added
+        Texture* GetFontAtlas();
+
+        //Member variables
+        Font* m_Font;
+        vector<float> m_LineVertices;
+        vector<float> m_TextVertices;
+        vector<float> m_LineWidths;
+
+        //VAO and VBO member variables
+        unsigned int m_LineVertexArrayObject;
+        unsigned int m_LineVertexBufferObject;
+        unsigned int m_TextVertexArrayObject;
+        unsigned int m_TextVertexBufferObject;
+    };
+}
+
+#endif /* defined(__GameDev2D__DebugRenderer__) */
@@ -7,35 +7,68 @@
 //
 
 #include "DebugUI.h"
+#include "PerformancePanel.h"
 #include "../../FrameworkConfig.h"
 #include "../ServiceLocator.h"
+#include "../DebugRenderer/DebugRenderer.h"
 #include "../InputManager/InputManager.h"
+#include "../Graphics/Graphics.h"
 #include "../../Platforms/PlatformLayer.h"
+#include "../../Core/MemoryTracker.h"
 #include "../../UI/Label/Label.h"
 #include "../../Events/Platform/ResizeEvent.h"
 #include "../../Events/Input/AccelerometerEvent.h"
 #include "../../Events/Input/GyroscopeEvent.h"
+#include "../../Events/Input/KeyEvent.h"
 
 
 #ifndef DEBUG_UI_FONT_COLOR
 #define DEBUG_UI_FONT_COLOR Color::BlackColor()
 #endif
 
+#ifndef DRAW_PERFORMANCE_PANEL
+#define DRAW_PERFORMANCE_PANEL 0
+#endif
+
+#ifndef PERFORMANCE_PANEL_TOGGLE_KEY
+#define PERFORMANCE_PANEL_TOGGLE_KEY KEY_CODE_F3
+#endif
+
 
 namespace GameDev2D
 {
     DebugUI::DebugUI() : GameService("DebugUI"),
-        m_FontColor(DEBUG_UI_FONT_COLOR)
+        m_FontColor(DEBUG_UI_FONT_COLOR),
+        m_PerformancePanel(nullptr),
+        m_LabelRefreshTime(0.0),
+        m_IsPerformancePanelVisible(DRAW_PERFORMANCE_PANEL == 1)
     {
+        //Create the performance panel, it samples every frame so its graphs are filled in when it is shown
+        m_PerformancePanel = new PerformancePanel();
+        
         //Add a watch value for the frames per second
         WatchValueUnsignedInt(ServiceLocator::GetPlatformLayer(), CastDebugCallbackUnsignedInt(PlatformLayer::GetFramesPerSecond));
         
+        //Add a watch value for the number of objects drawn and culled by the frustum culling
+        WatchValueString(ServiceLocator::GetGraphics(), CastDebugCallbackString(Graphics::CullingStatsFormatted));
+        
         //If the platform has memory tracking enabled, add a watch value
         if(ServiceLocator::GetPlatformLayer()->IsMemoryTrackingEnabled() == true)
         {
             WatchValueString(ServiceLocator::GetPlatformLayer(), CastDebugCallbackString(PlatformLayer::MemoryAllocatedFormatted));
         }
         
+        //Add a watch value for the memory allocated, and the allocations made each frame, by each memory tag
+    #if TRACK_MEMORY_TAGS
+        WatchValueString(ServiceLocator::GetPlatformLayer()->GetMemoryTracker(), CastDebugCallbackString(MemoryTracker::MemoryUsageFormatted));
+    #endif
+        
+        //Add a watch value for the frame arena's high-water mark
+        WatchValueString(ServiceLocator::GetFrameArena(), CastDebugCallbackString(FrameArena::ArenaUsageFormatted));
+        
+        //Add a watch value for the resident resources and the resource memory budget
+        WatchValueString(ServiceLocator::GetResourceManager(), CastDebugCallbackString(ResourceManager::ResourceUsageFormatted));
+        
         //If the platform has touch input, add a watch value
         if(ServiceLocator::GetPlatformLayer()->HasTouchInput() == true)
         {
@@ -52,6 +85,9 @@ namespace GameDev2D
         //Add an event listener for enabling/disabling the gyroscope (iOS)
         ServiceLocator::GetPlatformLayer()->AddEventListener(this, GYROSCOPE_ENABLED_EVENT);
         ServiceLocator::GetPlatformLayer()->AddEventListener(this, GYROSCOPE_DISABLED_EVENT);
+        
+        //Add an event listener for the key that toggles the performance panel
+        ServiceLocator::GetInputManager()->AddEventListener(this, KEYBOARD_EVENT);
     }
 
     DebugUI::~DebugUI()
@@ -62,6 +98,10 @@ namespace GameDev2D
         ServiceLocator::GetPlatformLayer()->RemoveEventListener(this, ACCELEROMETER_DISABLED_EVENT);
         ServiceLocator::GetPlatformLayer()->RemoveEventListener(this, GYROSCOPE_ENABLED_EVENT);
         ServiceLocator::GetPlatformLayer()->RemoveEventListener(this, GYROSCOPE_DISABLED_EVENT);
+        ServiceLocator::GetInputManager()->RemoveEventListener(this, KEYBOARD_EVENT);
+        
+        //Delete the performance panel
+        SafeDelete(m_PerformancePanel);
     
         //Cycle through and delete all the label objects
         for(unsigned int i = 0; i < m_Labels.size(); i++)
@@ -73,6 +113,18 @@ namespace GameDev2D
 
     void DebugUI::Update(double aDelta)
     {
+        //The watch values are only refreshed every interval, a label's texture is rebuilt each time its text changes
+        m_LabelRefreshTime += aDelta;
+        if(m_LabelRefreshTime < DEBUG_LABEL_REFRESH_INTERVAL)
+        {
+            for(unsigned int i = 0; i < m_Labels.size(); i++)
+            {
+                m_Labels.at(i).label->Update(aDelta);
+            }
+            return;
+        }
+        m_LabelRefreshTime = 0.0;
+        
         for(unsigned int i = 0; i < m_Labels.size(); i++)
         {
             if(m_Labels.at(i).callbackType == DebugCallbackTypeUnsignedInt)
@@ -124,6 +176,16 @@ namespace GameDev2D
         {
             m_Labels.at(i).label->Draw();
         }
+        
+        //The performance panel samples once a frame, whether it is visible or not
+        m_PerformancePanel->Sample();
+        
+        //Draw the performance panel, it is added to the DebugRenderer and flushed right away, with the default camera
+        if(m_IsPerformancePanelVisible == true)
+        {
+            m_PerformancePanel->Draw();
+            ServiceLocator::GetDebugRenderer()->Flush();
+        }
     }
 
     bool DebugUI::CanUpdate()
@@ -177,6 +239,17 @@ namespace GameDev2D
                 StopWatchingValueDVec3(ServiceLocator::GetInputManager(), CastDebugCallbackDVec3(InputManager::GetGyroscopeData));
             }
             break;
+            
+            case KEYBOARD_EVENT:
+            {
+                //Toggle the performance panel when the toggle key is pressed
+                KeyEvent* keyEvent = (KeyEvent*)aEvent;
+                if(keyEvent->GetKeyEventType() == KeyDown && keyEvent->GetKeyCode() == PERFORMANCE_PANEL_TOGGLE_KEY)
+                {
+                    SetPerformancePanelVisible(!m_IsPerformancePanelVisible);
+                }
+            }
+            break;
                 
             default:
                 break;
@@ -455,6 +528,16 @@ namespace GameDev2D
         }
     }
     
+    void DebugUI::SetPerformancePanelVisible(bool aIsVisible)
+    {
+        m_IsPerformancePanelVisible = aIsVisible;
+    }
+    
+    bool DebugUI::IsPerformancePanelVisible()
+    {
+        return m_IsPerformancePanelVisible;
+    }
+    
     void DebugUI::UpdateLabel(double aDelta, Label* aLabel, BaseObject* aCallbackObject, DebugCallbackUnsignedInt aCallbackMethodUnsignedInt)
     {
         if(aLabel != nullptr)
@@ -522,9 +605,15 @@ namespace GameDev2D
             stringstream labelStream;
             labelStream << labelText;
 
-            //
+            //If the number of lines changed, the labels below need to be moved
+            float height = aLabel->GetHeight();
             aLabel->SetText(labelStream.str());
             aLabel->Update(aDelta);
+            
+            if(aLabel->GetHeight() != height)
+            {
+                UpdateLayout();
+            }
         }
     }
     
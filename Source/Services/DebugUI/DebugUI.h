@@ -35,9 +35,11 @@ namespace GameDev2D
     const unsigned int DEBUG_FLOAT_DOUBLE_PRECISION = 3;
     const unsigned int DEBUG_LABEL_FONT_SIZE = 32;
     const float DEBUG_LABEL_SPACING = 5.0f;
+    const double DEBUG_LABEL_REFRESH_INTERVAL = 0.25;
 
     //Forward Declarations
     class Label;
+    class PerformancePanel;
 
     //DebugUI class, will display the Game's FPS and other relevant information on screen. You may
     //also register a function pointer for most datatype and it will display it on screen as well
@@ -97,6 +99,10 @@ namespace GameDev2D
         //Set the UI label color
         void SetLabelColor(Color color);
         
+        //Shows or hides the performance panel, it can also be toggled with the PERFORMANCE_PANEL_TOGGLE_KEY
+        void SetPerformancePanelVisible(bool isVisible);
+        bool IsPerformancePanelVisible();
+        
     private:
         //Enum to keep track of type of function pointer the debug data struct holds
         enum DebugCallbackType
@@ -323,6 +329,9 @@ namespace GameDev2D
         //Member variables
         vector<DebugData> m_Labels;
         Color m_FontColor;
+        PerformancePanel* m_PerformancePanel;
+        double m_LabelRefreshTime;
+        bool m_IsPerformancePanelVisible;
     };
 }
 
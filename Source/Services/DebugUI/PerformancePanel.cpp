@@ -0,0 +1,208 @@
+//
+//  PerformancePanel.cpp
+//  GameDev2D
+//
+
+#include "PerformancePanel.h"
+#include "../ServiceLocator.h"
+#include "../Graphics/Graphics.h"
+#include "../DebugRenderer/DebugRenderer.h"
+#include "../../Platforms/PlatformLayer.h"
+#include "../../Core/MemoryTracker.h"
+#include <algorithm>
+#include <stdio.h>
+
+
+namespace GameDev2D
+{
+    PerformancePanel::PerformancePanel() : BaseObject("PerformancePanel"),
+        m_SampleIndex(0),
+        m_NumberOfSamples(0),
+        m_NumberOfSamplesSinceRefresh(0),
+        m_LastSampleTime(0),
+        m_TextRefreshTime(0.0)
+    {
+        //Clear the samples
+        for(unsigned int i = 0; i < PerformanceSeriesCount; i++)
+        {
+            for(unsigned int j = 0; j < PERFORMANCE_PANEL_NUMBER_OF_SAMPLES; j++)
+            {
+                m_Samples[i][j] = 0.0f;
+            }
+            m_SampleTotals[i] = 0.0f;
+        }
+    }
+
+    PerformancePanel::~PerformancePanel()
+    {
+
+    }
+
+    void PerformancePanel::Sample()
+    {
+        //The frame time is the time between two samples, the first sample has nothing to compare to
+        unsigned long long time = ServiceLocator::GetPlatformLayer()->GetTimeNanoseconds();
+        if(m_LastSampleTime == 0)
+        {
+            m_LastSampleTime = time;
+            return;
+        }
+
+        float samples[PerformanceSeriesCount];
+        samples[PerformanceSeriesFrameTime] = (float)((double)(time - m_LastSampleTime) / 1000000.0);
+        samples[PerformanceSeriesUpdateTime] = (float)ServiceLocator::GetUpdateTime();
+        samples[PerformanceSeriesDrawTime] = (float)ServiceLocator::GetDrawTime();
+        m_LastSampleTime = time;
+
+        //The Graphics service's counters are for the last frame, the redundant texture binds were skipped
+        Graphics* graphics = ServiceLocator::GetGraphics();
+        samples[PerformanceSeriesDrawCalls] = (float)graphics->GetNumberOfDrawCalls();
+        samples[PerformanceSeriesTextureBinds] = (float)(graphics->GetNumberOfStateCalls(GraphicsStateCallTexture) - graphics->GetNumberOfRedundantStateCalls(GraphicsStateCallTexture));
+
+        //Add up the last frame's allocations of every memory tag
+        unsigned int allocations = 0;
+        for(unsigned int i = 0; i < MemoryTagCount; i++)
+        {
+            allocations += MemoryTracker::GetNumberOfFrameAllocations((MemoryTag)i);
+        }
+        samples[PerformanceSeriesAllocations] = (float)allocations;
+
+        //Add the samples to the ring buffers, overwriting the oldest samples
+        for(unsigned int i = 0; i < PerformanceSeriesCount; i++)
+        {
+            m_Samples[i][m_SampleIndex] = samples[i];
+            m_SampleTotals[i] += samples[i];
+        }
+        m_SampleIndex = (m_SampleIndex + 1) % PERFORMANCE_PANEL_NUMBER_OF_SAMPLES;
+        m_NumberOfSamples = m_NumberOfSamples < PERFORMANCE_PANEL_NUMBER_OF_SAMPLES ? m_NumberOfSamples + 1 : m_NumberOfSamples;
+        m_NumberOfSamplesSinceRefresh++;
+
+        //Is it time to refresh the text?
+        m_TextRefreshTime += samples[PerformanceSeriesFrameTime] / 1000.0;
+        if(m_TextRefreshTime >= PERFORMANCE_PANEL_TEXT_REFRESH_INTERVAL)
+        {
+            RefreshText();
+            m_TextRefreshTime = 0.0;
+        }
+    }
+
+    void PerformancePanel::Draw()
+    {
+        DebugRenderer* debugRenderer = ServiceLocator::GetDebugRenderer();
+
+        //The panel is in the top right corner, scaled by the platform's scale
+        float scale = ServiceLocator::GetPlatformLayer()->GetScale();
+        float padding = PERFORMANCE_PANEL_SPACING * scale;
+        float fontSize = PERFORMANCE_PANEL_FONT_SIZE * scale;
+        vec2 graphSize = vec2(PERFORMANCE_PANEL_WIDTH, PERFORMANCE_PANEL_GRAPH_HEIGHT) * scale;
+        vec2 position = vec2(ServiceLocator::GetPlatformLayer()->GetWidth() - padding - graphSize.x, ServiceLocator::GetPlatformLayer()->GetHeight() - padding);
+
+        //The frame time graph, with a line at the target frame time
+        debugRenderer->DrawText(m_TimesText, position, Color::WhiteColor(), fontSize, vec2(0.0f, 1.0f));
+        position.y -= fontSize + padding + graphSize.y;
+
+        float maximum = std::max(GetMaximumSample(PerformanceSeriesFrameTime), (float)PERFORMANCE_PANEL_TARGET_FRAME_TIME * 2.0f);
+        float target = graphSize.y * (float)PERFORMANCE_PANEL_TARGET_FRAME_TIME / maximum;
+        debugRenderer->DrawLine(vec2(position.x, position.y + target), vec2(position.x + graphSize.x, position.y + target), Color::RedColor(0.5f));
+        DrawGraph(position, graphSize, PerformanceSeriesFrameTime, maximum, Color::YellowColor());
+        position.y -= padding + graphSize.y;
+
+        //The update and draw times graph, both on the same scale
+        maximum = std::max(std::max(GetMaximumSample(PerformanceSeriesUpdateTime), GetMaximumSample(PerformanceSeriesDrawTime)), 1.0f);
+        DrawGraph(position, graphSize, PerformanceSeriesUpdateTime, maximum, Color::GreenColor());
+        DrawGraph(position, graphSize, PerformanceSeriesDrawTime, maximum, Color::CyanColor());
+
+        //The counters graph, all on the same scale
+        debugRenderer->DrawText(m_CountersText, vec2(position.x, position.y - padding), Color::WhiteColor(), fontSize, vec2(0.0f, 1.0f));
+        position.y -= fontSize + padding * 2.0f + graphSize.y;
+
+        maximum = std::max(GetMaximumSample(PerformanceSeriesDrawCalls), GetMaximumSample(PerformanceSeriesTextureBinds));
+        maximum = std::max(std::max(maximum, GetMaximumSample(PerformanceSeriesAllocations)), 1.0f);
+        DrawGraph(position, graphSize, PerformanceSeriesDrawCalls, maximum, Color::OrangeColor());
+        DrawGraph(position, graphSize, PerformanceSeriesTextureBinds, maximum, Color::BlueColor());
+        DrawGraph(position, graphSize, PerformanceSeriesAllocations, maximum, Color::RedColor());
+        position.y -= padding;
+
+        //Each service's times, with a bar showing the fraction of the target frame time the service takes
+        for(unsigned int i = 0; i < m_ServicesText.size() && i < m_Services.size(); i++)
+        {
+            debugRenderer->DrawText(m_ServicesText.at(i), position, Color::WhiteColor(), fontSize, vec2(0.0f, 1.0f));
+            position.y -= fontSize + padding * 0.5f;
+
+            double time = m_Services.at(i)->GetUpdateTime() + m_Services.at(i)->GetDrawTime();
+            float length = graphSize.x * (float)std::min(time / PERFORMANCE_PANEL_TARGET_FRAME_TIME, 1.0);
+            if(length > 0.0f)
+            {
+                debugRenderer->DrawLine(position, vec2(position.x + length, position.y), Color::GreenColor());
+            }
+            position.y -= padding * 0.5f;
+        }
+    }
+
+    void PerformancePanel::DrawGraph(vec2 aPosition, vec2 aSize, PerformanceSeries aSeries, float aMaximum, Color aColor)
+    {
+        DebugRenderer* debugRenderer = ServiceLocator::GetDebugRenderer();
+
+        //Draw the graph's outline
+        debugRenderer->DrawRect(aPosition, aSize, Color::GrayColor(0.5f));
+
+        //Draw a line between each pair of samples, the oldest sample is at the ring buffer's index once it is full
+        unsigned int oldest = m_NumberOfSamples < PERFORMANCE_PANEL_NUMBER_OF_SAMPLES ? 0 : m_SampleIndex;
+        float spacing = aSize.x / (float)(PERFORMANCE_PANEL_NUMBER_OF_SAMPLES - 1);
+        vec2 previous;
+
+        for(unsigned int i = 0; i < m_NumberOfSamples; i++)
+        {
+            float sample = std::min(m_Samples[aSeries][(oldest + i) % PERFORMANCE_PANEL_NUMBER_OF_SAMPLES], aMaximum);
+            vec2 point = vec2(aPosition.x + spacing * i, aPosition.y + aSize.y * sample / aMaximum);
+
+            if(i > 0)
+            {
+                debugRenderer->DrawLine(previous, point, aColor);
+            }
+            previous = point;
+        }
+    }
+
+    float PerformancePanel::GetMaximumSample(PerformanceSeries aSeries)
+    {
+        float maximum = 0.0f;
+        for(unsigned int i = 0; i < m_NumberOfSamples; i++)
+        {
+            maximum = std::max(maximum, m_Samples[aSeries][i]);
+        }
+        return maximum;
+    }
+
+    void PerformancePanel::RefreshText()
+    {
+        //Average the samples since the last refresh
+        float averages[PerformanceSeriesCount];
+        for(unsigned int i = 0; i < PerformanceSeriesCount; i++)
+        {
+            averages[i] = m_NumberOfSamplesSinceRefresh > 0 ? m_SampleTotals[i] / (float)m_NumberOfSamplesSinceRefresh : 0.0f;
+            m_SampleTotals[i] = 0.0f;
+        }
+        m_NumberOfSamplesSinceRefresh = 0;
+
+        char buffer[PERFORMANCE_PANEL_TEXT_BUFFER_SIZE];
+        float framesPerSecond = averages[PerformanceSeriesFrameTime] > 0.0f ? 1000.0f / averages[PerformanceSeriesFrameTime] : 0.0f;
+        snprintf(buffer, PERFORMANCE_PANEL_TEXT_BUFFER_SIZE, "Frame %.2fms (%.0f fps)  Update %.2fms  Draw %.2fms",
+                 averages[PerformanceSeriesFrameTime], framesPerSecond, averages[PerformanceSeriesUpdateTime], averages[PerformanceSeriesDrawTime]);
+        m_TimesText = buffer;
+
+        snprintf(buffer, PERFORMANCE_PANEL_TEXT_BUFFER_SIZE, "Draw calls %.0f  Texture binds %.0f  Allocations %.0f",
+                 averages[PerformanceSeriesDrawCalls], averages[PerformanceSeriesTextureBinds], averages[PerformanceSeriesAllocations]);
+        m_CountersText = buffer;
+
+        //The services are only added and removed at startup and shutdown, but get them again in case one was replaced
+        ServiceLocator::GetServices(m_Services);
+        m_ServicesText.resize(m_Services.size());
+
+        for(unsigned int i = 0; i < m_Services.size(); i++)
+        {
+            snprintf(buffer, PERFORMANCE_PANEL_TEXT_BUFFER_SIZE, "%s  %.2fms / %.2fms", m_Services.at(i)->GetType().c_str(), m_Services.at(i)->GetUpdateTime(), m_Services.at(i)->GetDrawTime());
+            m_ServicesText.at(i) = buffer;
+        }
+    }
+}
@@ -0,0 +1,85 @@
+//
+//  PerformancePanel.h
+//  GameDev2D
+//
+
+#ifndef __GameDev2D__PerformancePanel__
+#define __GameDev2D__PerformancePanel__
+
+#include "../../Core/BaseObject.h"
+#include "../../Graphics/Core/Color.h"
+
+
+using namespace std;
+using namespace glm;
+
+namespace GameDev2D
+{
+    //Local constants
+    const unsigned int PERFORMANCE_PANEL_NUMBER_OF_SAMPLES = 120;
+    const float PERFORMANCE_PANEL_WIDTH = 240.0f;
+    const float PERFORMANCE_PANEL_GRAPH_HEIGHT = 48.0f;
+    const float PERFORMANCE_PANEL_FONT_SIZE = 14.0f;
+    const float PERFORMANCE_PANEL_SPACING = 5.0f;
+    const double PERFORMANCE_PANEL_TEXT_REFRESH_INTERVAL = 0.25;
+    const double PERFORMANCE_PANEL_TARGET_FRAME_TIME = 1000.0 / 60.0;
+    const unsigned int PERFORMANCE_PANEL_TEXT_BUFFER_SIZE = 128;
+
+    //Forward declarations
+    class GameService;
+
+    //The values the PerformancePanel samples each frame, the times are in milliseconds
+    enum PerformanceSeries
+    {
+        PerformanceSeriesFrameTime = 0,
+        PerformanceSeriesUpdateTime,
+        PerformanceSeriesDrawTime,
+        PerformanceSeriesDrawCalls,
+        PerformanceSeriesTextureBinds,
+        PerformanceSeriesAllocations,
+        PerformanceSeriesCount
+    };
+
+    //The PerformancePanel is owned by the DebugUI, it graphs the last PERFORMANCE_PANEL_NUMBER_OF_SAMPLES frame times, update
+    //and draw times, draw calls, texture binds and allocations, and lists each GameService's update and draw times. Everything
+    //is drawn with the DebugRenderer's lines and text, so the panel only adds to the DebugRenderer's two draw calls. The samples
+    //are kept in fixed size ring buffers and the text is only formatted every PERFORMANCE_PANEL_TEXT_REFRESH_INTERVAL seconds
+    //(as the average of the samples since the last refresh), the panel doesn't allocate memory per frame.
+    class PerformancePanel : public BaseObject
+    {
+    public:
+        PerformancePanel();
+        ~PerformancePanel();
+
+        //Samples the last frame's values, called once a frame by the DebugUI even when the panel isn't visible
+        void Sample();
+
+        //Adds the panel's graphs and text to the DebugRenderer, the DebugUI flushes them
+        void Draw();
+
+    private:
+        //Adds a graph of a series' samples, oldest on the left, the maximum is the value at the top of the graph
+        void DrawGraph(vec2 position, vec2 size, PerformanceSeries series, float maximum, Color color);
+
+        //Returns the largest sample of a series
+        float GetMaximumSample(PerformanceSeries series);
+
+        //Formats the averages of the samples since the last refresh, and each GameService's times
+        void RefreshText();
+
+        //Member variables
+        float m_Samples[PerformanceSeriesCount][PERFORMANCE_PANEL_NUMBER_OF_SAMPLES];
+        float m_SampleTotals[PerformanceSeriesCount];
+        unsigned int m_SampleIndex;
+        unsigned int m_NumberOfSamples;
+        unsigned int m_NumberOfSamplesSinceRefresh;
+        unsigned long long m_LastSampleTime;
+        double m_TextRefreshTime;
+        vector<GameService*> m_Services;
+        string m_TimesText;
+        string m_CountersText;
+        vector<string> m_ServicesText;
+    };
+}
+
+#endif /* defined(__GameDev2D__PerformancePanel__) */
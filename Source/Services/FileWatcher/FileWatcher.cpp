@@ -0,0 +1,301 @@
+//
+//  FileWatcher.cpp
+//  GameDev2D
+//
+
+#include "FileWatcher.h"
+#include "../ServiceLocator.h"
+#include "../../Platforms/PlatformLayer.h"
+#include "../../Events/Platform/FileChangedEvent.h"
+#include <algorithm>
+#include <chrono>
+
+#if __linux__
+#include <sys/inotify.h>
+#include <poll.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+
+namespace GameDev2D
+{
+    FileWatcher::FileWatcher() : GameService("FileWatcher"),
+        m_HasChangedFiles(false),
+        m_IsRunning(false)
+    {
+#if __linux__
+        //Create the inotify instance, it is read without blocking once poll() says there are events
+        m_NotifyDescriptor = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        m_WakePipe[0] = -1;
+        m_WakePipe[1] = -1;
+
+        bool canWatchFiles = m_NotifyDescriptor >= 0 && pipe(m_WakePipe) == 0;
+        if(canWatchFiles == false)
+        {
+            Error(false, "Failed to create the inotify instance, files won't be watched");
+        }
+#else
+        bool canWatchFiles = true;
+#endif
+
+        //Start the watcher thread, it blocks until a watched file changes
+        if(canWatchFiles == true)
+        {
+            m_IsRunning = true;
+            m_WatcherThread = thread(&FileWatcher::RunWatcherThread, this);
+        }
+
+        //Add a shutdown event listener
+        ServiceLocator::GetPlatformLayer()->AddEventListener(this, SHUTDOWN_EVENT);
+    }
+
+    FileWatcher::~FileWatcher()
+    {
+        //Remove the shutdown event listener
+        ServiceLocator::GetPlatformLayer()->RemoveEventListener(this, SHUTDOWN_EVENT);
+
+        //Make sure the watcher thread has stopped
+        Shutdown();
+
+#if __linux__
+        //Close the inotify instance and the wake pipe, closing the inotify instance removes its watches
+        if(m_NotifyDescriptor >= 0)
+        {
+            close(m_NotifyDescriptor);
+        }
+        if(m_WakePipe[0] >= 0)
+        {
+            close(m_WakePipe[0]);
+            close(m_WakePipe[1]);
+        }
+#endif
+    }
+
+    void FileWatcher::WatchFile(const string& aPath)
+    {
+        lock_guard<mutex> lock(m_Mutex);
+
+        //Is the file already watched?
+        if(m_WatchedFiles.find(aPath) != m_WatchedFiles.end())
+        {
+            return;
+        }
+
+        //The modification time is what the polling compares against
+        m_WatchedFiles[aPath] = ServiceLocator::GetPlatformLayer()->GetModificationTimeForFileAtPath(aPath);
+
+#if __linux__
+        //Watch the file's directory rather than the file, editors often save by replacing the file and a
+        //watch on the file itself would be lost. Adding a directory that is already watched returns its descriptor
+        if(m_NotifyDescriptor >= 0)
+        {
+            size_t slash = aPath.find_last_of('/');
+            string directory = slash != string::npos ? aPath.substr(0, slash + 1) : "";
+            int watchDescriptor = inotify_add_watch(m_NotifyDescriptor, directory.length() > 0 ? directory.c_str() : ".", IN_CLOSE_WRITE | IN_MOVED_TO);
+
+            if(watchDescriptor < 0)
+            {
+                Error(false, "Failed to watch the directory of file: %s", aPath.c_str());
+                return;
+            }
+            m_WatchedDirectories[watchDescriptor] = directory;
+        }
+#endif
+    }
+
+    bool FileWatcher::IsWatchingFile(const string& aPath)
+    {
+        lock_guard<mutex> lock(m_Mutex);
+        return m_WatchedFiles.find(aPath) != m_WatchedFiles.end();
+    }
+
+    unsigned int FileWatcher::GetNumberOfWatchedFiles()
+    {
+        lock_guard<mutex> lock(m_Mutex);
+        return (unsigned int)m_WatchedFiles.size();
+    }
+
+    void FileWatcher::Shutdown()
+    {
+        //Has the file watcher already been shut down
+        {
+            lock_guard<mutex> lock(m_Mutex);
+            if(m_IsRunning == false)
+            {
+                return;
+            }
+            m_IsRunning = false;
+        }
+
+#if __linux__
+        //Wake the watcher thread up, it is blocked in poll()
+        char wake = 1;
+        if(write(m_WakePipe[1], &wake, 1) != 1)
+        {
+            Error(false, "Failed to wake the file watcher thread up");
+        }
+#else
+        m_WakeCondition.notify_all();
+#endif
+
+        //Wait for the watcher thread to finish
+        m_WatcherThread.join();
+
+        Log(VerbosityLevel_Debug, "The File Watcher has shut down");
+    }
+
+    void FileWatcher::Update(double aDelta)
+    {
+        //Take the changed files, so the mutex isn't locked while the events are dispatched
+        vector<string> changedFiles;
+        {
+            lock_guard<mutex> lock(m_Mutex);
+            changedFiles.swap(m_ChangedFiles);
+            m_HasChangedFiles = false;
+        }
+
+        //Dispatch an event for each file that changed
+        for(unsigned int i = 0; i < changedFiles.size(); i++)
+        {
+            DispatchEvent(new FileChangedEvent(changedFiles.at(i)));
+        }
+    }
+
+    bool FileWatcher::CanUpdate()
+    {
+        return m_HasChangedFiles == true;
+    }
+
+    bool FileWatcher::CanDraw()
+    {
+        return false;
+    }
+
+    void FileWatcher::HandleEvent(Event* aEvent)
+    {
+        switch (aEvent->GetEventCode())
+        {
+            case SHUTDOWN_EVENT:
+                Shutdown();
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    void FileWatcher::RunWatcherThread()
+    {
+#if __linux__
+        //Block until there are inotify events, or until the wake pipe is written to
+        while(true)
+        {
+            pollfd descriptors[2];
+            descriptors[0].fd = m_NotifyDescriptor;
+            descriptors[0].events = POLLIN;
+            descriptors[0].revents = 0;
+            descriptors[1].fd = m_WakePipe[0];
+            descriptors[1].events = POLLIN;
+            descriptors[1].revents = 0;
+
+            if(poll(descriptors, 2, -1) < 0)
+            {
+                //A signal interrupted the poll, wait again
+                if(errno == EINTR)
+                {
+                    continue;
+                }
+                break;
+            }
+
+            //Has the file watcher shut down?
+            if(descriptors[1].revents != 0)
+            {
+                break;
+            }
+
+            if((descriptors[0].revents & POLLIN) != 0)
+            {
+                ReadNotifyEvents();
+            }
+        }
+#else
+        //Poll the modification times every interval, until the file watcher shuts down
+        unique_lock<mutex> lock(m_Mutex);
+        while(m_IsRunning == true)
+        {
+            m_WakeCondition.wait_for(lock, chrono::milliseconds(FILE_WATCHER_POLL_INTERVAL_MILLISECONDS));
+            if(m_IsRunning == true)
+            {
+                lock.unlock();
+                PollModificationTimes();
+                lock.lock();
+            }
+        }
+#endif
+    }
+
+    void FileWatcher::AddChangedFile(const string& aPath)
+    {
+        //A file that is saved more than once before the next update only gets one event
+        if(find(m_ChangedFiles.begin(), m_ChangedFiles.end(), aPath) == m_ChangedFiles.end())
+        {
+            m_ChangedFiles.push_back(aPath);
+        }
+        m_HasChangedFiles = true;
+    }
+
+#if __linux__
+    void FileWatcher::ReadNotifyEvents()
+    {
+        //The buffer has to be aligned for the inotify events
+        char buffer[FILE_WATCHER_EVENT_BUFFER_SIZE] __attribute__((aligned(__alignof__(inotify_event))));
+
+        //Read the events until there are none left
+        ssize_t length = 0;
+        while((length = read(m_NotifyDescriptor, buffer, FILE_WATCHER_EVENT_BUFFER_SIZE)) > 0)
+        {
+            lock_guard<mutex> lock(m_Mutex);
+            for(char* pointer = buffer; pointer < buffer + length;)
+            {
+                const inotify_event* notifyEvent = (const inotify_event*)pointer;
+                pointer += sizeof(inotify_event) + notifyEvent->len;
+
+                //The event's name is the file in the watched directory, only the watched files are queued
+                map<int, string>::iterator it = m_WatchedDirectories.find(notifyEvent->wd);
+                if(notifyEvent->len > 0 && it != m_WatchedDirectories.end())
+                {
+                    string path = it->second + notifyEvent->name;
+                    if(m_WatchedFiles.find(path) != m_WatchedFiles.end())
+                    {
+                        AddChangedFile(path);
+                    }
+                }
+            }
+        }
+    }
+#else
+    void FileWatcher::PollModificationTimes()
+    {
+        //Copy the watched files, so the mutex isn't locked while the modification times are read
+        map<string, unsigned long long> watchedFiles;
+        {
+            lock_guard<mutex> lock(m_Mutex);
+            watchedFiles = m_WatchedFiles;
+        }
+
+        //A modification time of zero means the file is missing, it could be in the middle of being replaced
+        for(map<string, unsigned long long>::iterator it = watchedFiles.begin(); it != watchedFiles.end(); ++it)
+        {
+            unsigned long long modificationTime = ServiceLocator::GetPlatformLayer()->GetModificationTimeForFileAtPath(it->first);
+            if(modificationTime != 0 && modificationTime != it->second)
+            {
+                lock_guard<mutex> lock(m_Mutex);
+                m_WatchedFiles[it->first] = modificationTime;
+                AddChangedFile(it->first);
+            }
+        }
+    }
+#endif
+}
@@ -0,0 +1,92 @@
+//
+//  FileWatcher.h
+//  GameDev2D
+//
+
+#ifndef __GameDev2D__FileWatcher__
+#define __GameDev2D__FileWatcher__
+
+#include "../GameService.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+
+using namespace std;
+
+namespace GameDev2D
+{
+    //Local constants
+    const unsigned int FILE_WATCHER_EVENT_BUFFER_SIZE = 4096;
+
+    //The FileWatcher game service watches files for changes on disk and dispatches a FileChangedEvent on the main
+    //thread for each file that changed, it is used to hot-reload assets. On Linux the watched files' directories are
+    //watched with inotify, on the other platforms the files' modification times are polled every
+    //FILE_WATCHER_POLL_INTERVAL_MILLISECONDS. Either way the watching is done on the FileWatcher's own thread, it blocks
+    //for as long as nothing changes so it doesn't take a JobSystem worker. The FileWatcher is only updated when there
+    //are changes to dispatch, it doesn't cost anything per frame while the files are unchanged.
+    class FileWatcher : public GameService
+    {
+    public:
+        FileWatcher();
+        ~FileWatcher();
+
+        //Starts watching the file at the path, does nothing if the file is already watched
+        void WatchFile(const string& path);
+
+        //Returns wether the file at the path is being watched
+        bool IsWatchingFile(const string& path);
+
+        //Returns the number of watched files
+        unsigned int GetNumberOfWatchedFiles();
+
+        //Stops the watcher thread, the files stop being watched. Called on the shutdown event
+        void Shutdown();
+
+        //Dispatches a FileChangedEvent for each file that changed since the last update
+        void Update(double delta);
+
+        //Used to determine if the FileWatcher should be updated and drawn, it is only updated when files have changed
+        bool CanUpdate();
+        bool CanDraw();
+
+        //Used to handle the shutdown event
+        void HandleEvent(Event* event);
+
+    private:
+        //The watcher thread's loop, waits for the watched files to change until the FileWatcher is shut down
+        void RunWatcherThread();
+
+        //Queues a file that changed, called from the watcher thread with the mutex locked
+        void AddChangedFile(const string& path);
+
+#if __linux__
+        //Reads the inotify events and queues the watched files that changed
+        void ReadNotifyEvents();
+#else
+        //Compares the watched files' modification times with the last ones and queues the files that changed
+        void PollModificationTimes();
+#endif
+
+        //Member variables, the watched files (and their last modification time) and the changed files are guarded by the mutex
+        map<string, unsigned long long> m_WatchedFiles;
+        vector<string> m_ChangedFiles;
+        atomic<bool> m_HasChangedFiles;
+        thread m_WatcherThread;
+        mutex m_Mutex;
+        bool m_IsRunning;
+
+#if __linux__
+        //The inotify instance and the watched directories for each watch descriptor, the pipe wakes the watcher thread up when it shuts down
+        map<int, string> m_WatchedDirectories;
+        int m_NotifyDescriptor;
+        int m_WakePipe[2];
+#else
+        //Wakes the watcher thread up when it shuts down
+        condition_variable m_WakeCondition;
+#endif
+    };
+}
+
+#endif /* defined(__GameDev2D__FileWatcher__) */
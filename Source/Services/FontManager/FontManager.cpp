@@ -10,6 +10,7 @@
 #include "../ServiceLocator.h"
 #include "../../Platforms/PlatformLayer.h"
 #include "../../IO/File.h"
+#include <sstream>
 
 
 namespace GameDev2D
@@ -23,28 +24,18 @@ namespace GameDev2D
             Error(true, "The FreeType lib failed to initialize");
         }
         
-        //Register for the low memory warning
-        ServiceLocator::GetPlatformLayer()->AddEventListener(this, LOW_MEMORY_WARNING_EVENT);
+        //The ResourceManager deletes the evicted fonts through the FontManager
+        ServiceLocator::GetResourceManager()->SetResourceUnloader(ResourceTypeBitmapFont, this);
+        ServiceLocator::GetResourceManager()->SetResourceUnloader(ResourceTypeTrueTypeFont, this);
     }
 
     FontManager::~FontManager()
     {
-        //Remove the listener for the low memory warning
-        ServiceLocator::GetPlatformLayer()->RemoveEventListener(this, LOW_MEMORY_WARNING_EVENT);
-    
-        //Cycle through and release any existing system sounds
-        while(m_BitmapFontMap.size() > 0)
-        {
-            SafeDelete(m_BitmapFontMap.begin()->second.first);
-            m_BitmapFontMap.erase(m_BitmapFontMap.begin());
-        }
-        
-        //Cycle through and release any existing system sounds
-        while(m_TrueTypeFontMap.size() > 0)
-        {
-            SafeDelete(m_TrueTypeFontMap.begin()->second.first);
-            m_TrueTypeFontMap.erase(m_TrueTypeFontMap.begin());
-        }
+        //Unload all the fonts, the true type fonts have to be deleted before the FreeType library is freed
+        ServiceLocator::GetResourceManager()->UnloadResources(ResourceTypeBitmapFont);
+        ServiceLocator::GetResourceManager()->UnloadResources(ResourceTypeTrueTypeFont);
+        ServiceLocator::GetResourceManager()->SetResourceUnloader(ResourceTypeBitmapFont, nullptr);
+        ServiceLocator::GetResourceManager()->SetResourceUnloader(ResourceTypeTrueTypeFont, nullptr);
         
         //Free the FreeType library
         FT_Done_FreeType(m_FreeTypeLibrary);
@@ -59,11 +50,11 @@ namespace GameDev2D
             return nullptr;
         }
     
-        //Get the pair from the texture map
-        pair<BitmapFont*, unsigned int> fontPair = m_BitmapFontMap[aBitmapFile];
+        //Get the font's resource
+        Resource* resource = ServiceLocator::GetResourceManager()->GetResource(ResourceTypeBitmapFont, aBitmapFile);
         
-        //Is the texture pointer null?
-        if(fontPair.first == nullptr)
+        //Is the font resident?
+        if(resource == nullptr)
         {
             //Was .fnt appended to the filename? If it was, remove it
             string bitmapFile = aBitmapFile;
@@ -88,21 +79,18 @@ namespace GameDev2D
             BitmapFont* font = new BitmapFont(aBitmapFile);
             font->ParseXmlText(const_cast<char*>(fontFile.GetBuffer()));
 
-            //Set the font object, set the retain count to 1
-            fontPair.first = font;
-            fontPair.second = 1;
+            //Add the font's resource, set the reference count to 1. The font's pages are
+            //textures, their memory is counted by the TextureManager's resources
+            resource = ServiceLocator::GetResourceManager()->AddResource(ResourceTypeBitmapFont, aBitmapFile, font, 0, 1);
         }
         else
         {
             //Increment the reference count
-            fontPair.second++;
+            ServiceLocator::GetResourceManager()->AddReference(resource);
         }
-        
-        //Set the font map pair for the filename key
-        m_BitmapFontMap[aBitmapFile] = fontPair;
 
         //Return the font object
-        return fontPair.first;
+        return (BitmapFont*)resource->object;
     }
     
     TrueTypeFont* FontManager::AddTrueTypeFont(const string& aTrueTypeFile, const string& aExtension, unsigned int aFontSize, const string& aCharacterSet)
@@ -114,33 +102,20 @@ namespace GameDev2D
             return nullptr;
         }
     
-        //Cycle through the multimap and verify the font size is the same
-        pair<TrueTypeFont*, unsigned int>* foundPair = nullptr;
-        for(multimap<string, pair<TrueTypeFont*, unsigned int>>::iterator it = m_TrueTypeFontMap.find(aTrueTypeFile); it != m_TrueTypeFontMap.end(); ++it)
+        //If the font is already loaded at the font size, increment the reference count and return the font
+        string key = GetTrueTypeFontKey(aTrueTypeFile, aFontSize);
+        Resource* resource = ServiceLocator::GetResourceManager()->GetResource(ResourceTypeTrueTypeFont, key);
+        if(resource != nullptr)
         {
-            if(it->second.first->GetFontSize() == aFontSize && it->second.first->GetFontName() == aTrueTypeFile)
-            {
-                foundPair = &it->second;
-            }
-        }
-        
-        //If the font is already loaded, increment the reference count and return the font
-        if(foundPair != nullptr)
-        {
-            foundPair->second++;
-            return foundPair->first;
+            ServiceLocator::GetResourceManager()->AddReference(resource);
+            return (TrueTypeFont*)resource->object;
         }
 
         //Create a new true type font
         TrueTypeFont* font = new TrueTypeFont(m_FreeTypeLibrary, aTrueTypeFile, aExtension, aFontSize, aCharacterSet);
         
-        //Create a font pair and set the reference count to 1
-        pair<TrueTypeFont*, unsigned int> pair;
-        pair.first = font;
-        pair.second = 1;
-        
-        //Insert the true type font pair
-        m_TrueTypeFontMap.insert(make_pair(aTrueTypeFile, pair));
+        //Add the font's resource and set the reference count to 1
+        ServiceLocator::GetResourceManager()->AddResource(ResourceTypeTrueTypeFont, key, font, font->GetNumberOfBytes(), 1);
         
         //Return the true type font
         return font;
@@ -148,76 +123,27 @@ namespace GameDev2D
 
     bool FontManager::RemoveFont(Font* aFont)
     {
-        bool success = false;
-    
-        //Get the name attached to the shader
-        string name = aFont->GetFileName();
-    
-        //What type of font are we unloading
+        //Get the font's resource, based on the type of font
+        Resource* resource = nullptr;
         if(aFont->GetType() == "BitmapFont")
         {
-            //Get the pair from the bitmap font map
-            pair<BitmapFont*, unsigned int> fontPair = m_BitmapFontMap[name];
-            
-            //Is the font pointer null?
-            if(fontPair.first == aFont)
-            {
-                //Subract from the retain counter
-                fontPair.second--;
-                
-                //Has the counter reacher zero?
-                if(fontPair.second <= 0)
-                {
-                    fontPair.second = 0;
-                }
-    
-                //Set the bitmap font map pair for the name key
-                m_BitmapFontMap[name] = fontPair;
-
-                //Do we purge unused fonts immediately?
-                #if PURGE_UNUSED_FONTS_IMMEDIATELY
-                if(fontPair.second == 0)
-                {
-                    PurgeUnusedFonts();
-                }
-                #endif
-                
-                //Set the success flag to true
-                success = true;
-            }
+            resource = ServiceLocator::GetResourceManager()->GetResource(ResourceTypeBitmapFont, aFont->GetFileName());
         }
         else if(aFont->GetType() == "TrueTypeFont")
         {
-            //Cycle through the multimap and decrease the reference counter
-            for(multimap<string, pair<TrueTypeFont*, unsigned int>>::iterator it = m_TrueTypeFontMap.find(name); it != m_TrueTypeFontMap.end(); ++it)
-            {
-                //Did we find the font
-                if(it->second.first == aFont)
-                {
-                    //Subract from the retain counter
-                    it->second.second--;
-                
-                    //Has the counter reacher zero?
-                    if(it->second.second <= 0)
-                    {
-                       it->second.second = 0;
-                       
-                        #if PURGE_UNUSED_FONTS_IMMEDIATELY
-                        PurgeUnusedFonts();
-                        #endif
-                    }
-
-                    //Set the success flag to true
-                    success = true;
-                    
-                    //Break out of the loop
-                    break;
-                }
-            }
+            resource = ServiceLocator::GetResourceManager()->GetResource(ResourceTypeTrueTypeFont, GetTrueTypeFontKey(aFont->GetFileName(), aFont->GetFontSize()));
+        }
+        
+        //Safety check that the resource is the font
+        if(resource == nullptr || resource->object != aFont)
+        {
+            return false;
         }
         
-        //Return the success flag
-        return success;
+        //Subract from the reference count, if the purge unused fonts config is enabled the
+        //font is evicted immediately if the reference count reaches zero
+        ServiceLocator::GetResourceManager()->RemoveReference(resource, PURGE_UNUSED_FONTS_IMMEDIATELY == 1);
+        return true;
     }
 
     bool FontManager::CanUpdate()
@@ -230,54 +156,16 @@ namespace GameDev2D
         return false;
     }
     
-    void FontManager::HandleEvent(Event* aEvent)
+    void FontManager::UnloadResource(ResourceType aType, void* aObject)
     {
-        if(aEvent->GetEventCode() == LOW_MEMORY_WARNING_EVENT)
-        {
-            PurgeUnusedFonts();
-        }
+        Font* font = (Font*)aObject;
+        SafeDelete(font);
     }
     
-    void FontManager::PurgeUnusedFonts()
+    string FontManager::GetTrueTypeFontKey(const string& aTrueTypeFile, unsigned int aFontSize)
     {
-        //Cycle through and purge the unused Bitmap fonts
-        for(map<string, pair<BitmapFont*, unsigned int>>::iterator it = m_BitmapFontMap.begin(); it != m_BitmapFontMap.end();)
-        {
-            //If the reference count is zero we can delete the font
-            if(it->second.second == 0)
-            {
-                //Delete the font
-                SafeDelete(it->second.first);
-                
-                //Remove it from the font map
-                map<string, pair<BitmapFont*, unsigned int>>::iterator eraseIt = it;
-                ++it;
-                m_BitmapFontMap.erase(eraseIt);
-            }
-            else
-            {
-                it++;
-            }
-        }
-        
-        //Cycle through and purge the unused TrueType fonts
-        for(multimap<string, pair<TrueTypeFont*, unsigned int>>::iterator it = m_TrueTypeFontMap.begin(); it != m_TrueTypeFontMap.end();)
-        {
-            //If the reference count is zero we can delete the font
-            if(it->second.second == 0)
-            {
-                //Delete the font
-                SafeDelete(it->second.first);
-                
-                //Remove it from the font multimap
-                multimap<string, pair<TrueTypeFont*, unsigned int>>::iterator eraseIt = it;
-                ++it;
-                m_TrueTypeFontMap.erase(eraseIt);
-            }
-            else
-            {
-                it++;
-            }
-        }
+        stringstream keyStream;
+        keyStream << aTrueTypeFile << "-" << aFontSize;
+        return keyStream.str();
     }
-}
\ No newline at end of file
+}
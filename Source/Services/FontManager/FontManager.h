@@ -10,6 +10,7 @@
 #define __GameDev2D__FontManager__
 
 #include "../GameService.h"
+#include "../ResourceManager/ResourceManager.h"
 #include "../../Graphics/Fonts/BitmapFont.h"
 #include "../../Graphics/Fonts/TrueTypeFont.h"
 
@@ -23,9 +24,9 @@ namespace GameDev2D
 {
     //The FontManager leverages the FreeType font library to load truetype (.ttf) and open type (.otf) fonts.
     //The FontManager can also load Bitmap fonts that were created with 71Squared's Glyph Designer software.
-    //Available at (https://71squared.com/en/glyphdesigner) . The FontManager uses reference counting to ensure
-    //that the same font isn't loaded twice for BOTH TrueTypeFonts and BitmapFonts
-    class FontManager : public GameService
+    //Available at (https://71squared.com/en/glyphdesigner) . The FontManager uses the ResourceManager to reference count
+    //the fonts, to ensure that the same font isn't loaded twice for BOTH TrueTypeFonts and BitmapFonts
+    class FontManager : public GameService, public ResourceUnloader
     {
     public:
         FontManager();
@@ -44,19 +45,15 @@ namespace GameDev2D
         bool CanUpdate();
         bool CanDraw();
         
-        //Handles events, we need to handle a low memory event
-        void HandleEvent(Event* event);
+        //Deletes a font evicted by the ResourceManager, inherited from ResourceUnloader
+        void UnloadResource(ResourceType type, void* object);
         
     private:
-        //Will purge any fonts with a reference count of zero
-        void PurgeUnusedFonts();
+        //Returns the resource key for a true type font, the same font file can be loaded at different font sizes
+        string GetTrueTypeFontKey(const string& trueTypeFile, unsigned int fontSize);
         
         //The FreeType library used to load .ttf and .otf fonts
         FT_Library m_FreeTypeLibrary;
-
-        //Member variables
-        map<string, pair<BitmapFont*, unsigned int>> m_BitmapFontMap;
-        multimap<string, pair<TrueTypeFont*, unsigned int>> m_TrueTypeFontMap;
     };
 }
 
@@ -0,0 +1,84 @@
+//
+//  FrameAllocator.h
+//  GameDev2D
+//
+
+#ifndef __GameDev2D__FrameAllocator__
+#define __GameDev2D__FrameAllocator__
+
+#include "FrameArena.h"
+#include "../ServiceLocator.h"
+#include <type_traits>
+#include <vector>
+
+
+using namespace std;
+
+namespace GameDev2D
+{
+    //The FrameAllocator is an STL allocator that allocates from the ServiceLocator's FrameArena, a container that uses
+    //it doesn't allocate on the heap, but it must not be used after the end of the frame it was filled in. Reserve
+    //the container's capacity when it is known, the memory freed when a container grows is only reclaimed at the
+    //end of the frame.
+    template <class T> class FrameAllocator
+    {
+    public:
+        typedef T value_type;
+        typedef T* pointer;
+        typedef const T* const_pointer;
+        typedef T& reference;
+        typedef const T& const_reference;
+        typedef size_t size_type;
+        typedef ptrdiff_t difference_type;
+
+        template <class U> struct rebind
+        {
+            typedef FrameAllocator<U> other;
+        };
+
+        FrameAllocator() :
+            m_FrameArena(ServiceLocator::GetFrameArena())
+        {
+
+        }
+
+        template <class U> FrameAllocator(const FrameAllocator<U>& aFrameAllocator) :
+            m_FrameArena(aFrameAllocator.GetFrameArena())
+        {
+
+        }
+
+        T* allocate(size_t aCount)
+        {
+            return (T*)m_FrameArena->Allocate(aCount * sizeof(T), alignment_of<T>::value);
+        }
+
+        void deallocate(T* aPointer, size_t aCount)
+        {
+            m_FrameArena->Free(aPointer);
+        }
+
+        FrameArena* GetFrameArena() const
+        {
+            return m_FrameArena;
+        }
+
+    private:
+        FrameArena* m_FrameArena;
+    };
+
+    template <class T, class U> bool operator==(const FrameAllocator<T>& aFrameAllocatorA, const FrameAllocator<U>& aFrameAllocatorB)
+    {
+        return aFrameAllocatorA.GetFrameArena() == aFrameAllocatorB.GetFrameArena();
+    }
+
+    template <class T, class U> bool operator!=(const FrameAllocator<T>& aFrameAllocatorA, const FrameAllocator<U>& aFrameAllocatorB)
+    {
+        return aFrameAllocatorA.GetFrameArena() != aFrameAllocatorB.GetFrameArena();
+    }
+
+    //A vector that allocates from the FrameArena, for scratch data that only lives for a frame
+    template <class T> using FrameVector = vector<T, FrameAllocator<T>>;
+}
+
+#endif /* defined(__GameDev2D__FrameAllocator__) */
@@ -0,0 +1,130 @@
+//
+//  FrameArena.cpp
+//  GameDev2D
+//
+
+#include "FrameArena.h"
+#include <iomanip>
+#include <sstream>
+
+
+namespace GameDev2D
+{
+    FrameArena::FrameArena(size_t aCapacity) : GameService("FrameArena"),
+        m_Memory(nullptr),
+        m_Capacity(aCapacity),
+        m_Offset(0),
+        m_HighWaterMark(0),
+        m_NumberOfOverflows(0),
+        m_HasLoggedOverflow(false)
+    {
+        //Allocate the arena's memory, it is allocated once and reused every frame
+        m_Memory = (unsigned char*)::operator new(m_Capacity);
+    }
+
+    FrameArena::~FrameArena()
+    {
+        ::operator delete(m_Memory);
+        m_Memory = nullptr;
+    }
+
+    void* FrameArena::Allocate(size_t aSize, size_t aAlignment)
+    {
+        //Bump the offset, if another thread allocated in the meantime the exchange fails and the offset is reloaded
+        size_t offset = m_Offset.load(memory_order_relaxed);
+        while(true)
+        {
+            //Align the allocation's start, relative to the arena's memory
+            size_t address = (size_t)(m_Memory + offset);
+            size_t start = offset + ((aAlignment - (address % aAlignment)) % aAlignment);
+            size_t end = start + aSize;
+
+            //Does the allocation fit in the arena?
+            if(end > m_Capacity)
+            {
+                break;
+            }
+
+            if(m_Offset.compare_exchange_weak(offset, end, memory_order_relaxed) == true)
+            {
+                return m_Memory + start;
+            }
+        }
+
+        //The arena is full, allocate the memory on the heap
+        m_NumberOfOverflows++;
+        return ::operator new(aSize);
+    }
+
+    void FrameArena::Free(void* aPointer)
+    {
+        //Only the memory allocated on the heap is freed
+        if(aPointer != nullptr && Contains(aPointer) == false)
+        {
+            ::operator delete(aPointer);
+        }
+    }
+
+    bool FrameArena::Contains(void* aPointer)
+    {
+        return aPointer >= m_Memory && aPointer < m_Memory + m_Capacity;
+    }
+
+    void FrameArena::Reset()
+    {
+        //Keep track of the most bytes allocated in a frame
+        size_t bytesUsed = m_Offset.exchange(0);
+        if(bytesUsed > m_HighWaterMark)
+        {
+            m_HighWaterMark = bytesUsed;
+        }
+
+        //Log the first time the arena overflows, the capacity should be increased
+        if(m_NumberOfOverflows > 0 && m_HasLoggedOverflow == false)
+        {
+            Error(false, "The frame arena is full, %u allocations were made on the heap. Increase FRAME_ARENA_CAPACITY", m_NumberOfOverflows.load());
+            m_HasLoggedOverflow = true;
+        }
+    }
+
+    size_t FrameArena::GetCapacity()
+    {
+        return m_Capacity;
+    }
+
+    size_t FrameArena::GetBytesUsed()
+    {
+        return m_Offset;
+    }
+
+    size_t FrameArena::GetHighWaterMark()
+    {
+        return m_HighWaterMark;
+    }
+
+    unsigned int FrameArena::GetNumberOfOverflows()
+    {
+        return m_NumberOfOverflows;
+    }
+
+    void FrameArena::ArenaUsageFormatted(string& aFormatted)
+    {
+        stringstream arenaStream;
+        arenaStream << "Frame arena: " << fixed << setprecision(1) << (double)m_HighWaterMark / 1024.0 << "KB of " << (double)m_Capacity / 1024.0 << "KB";
+        if(m_NumberOfOverflows > 0)
+        {
+            arenaStream << " (" << m_NumberOfOverflows << " overflows)";
+        }
+        aFormatted = arenaStream.str();
+    }
+
+    bool FrameArena::CanUpdate()
+    {
+        return false;
+    }
+
+    bool FrameArena::CanDraw()
+    {
+        return false;
+    }
+}
@@ -0,0 +1,70 @@
+//
+//  FrameArena.h
+//  GameDev2D
+//
+
+#ifndef __GameDev2D__FrameArena__
+#define __GameDev2D__FrameArena__
+
+#include "../GameService.h"
+#include <atomic>
+
+
+using namespace std;
+
+namespace GameDev2D
+{
+    //Local constants
+    const size_t FRAME_ARENA_DEFAULT_ALIGNMENT = 16;
+
+    //The FrameArena game service is a linear (bump) allocator for transient data that only lives for a frame, such as
+    //scratch containers and vertex data that is uploaded right away. An allocation only moves an offset, nothing is freed
+    //until the PlatformLayer resets the arena at the end of Tick(), after that every allocation made from the arena is
+    //invalid. Allocating is thread-safe, so jobs can use the arena, as long as they are done before the frame ends.
+    //If the arena is full the memory is allocated on the heap instead, and an Error is logged the first time.
+    class FrameArena : public GameService
+    {
+    public:
+        FrameArena(size_t capacity);
+        ~FrameArena();
+
+        //Allocates memory from the arena, the memory is valid until the arena is reset
+        void* Allocate(size_t size, size_t alignment = FRAME_ARENA_DEFAULT_ALIGNMENT);
+
+        //Frees memory allocated by the arena, only the memory allocated on the heap (because the arena was full) is actually
+        //freed, the arena's memory is freed all at once by Reset()
+        void Free(void* pointer);
+
+        //Returns wether the pointer is in the arena's memory
+        bool Contains(void* pointer);
+
+        //Resets the arena, called by the PlatformLayer at the end of Tick()
+        void Reset();
+
+        //Returns the capacity of the arena, the bytes allocated this frame, and the most bytes allocated in a frame (in bytes)
+        size_t GetCapacity();
+        size_t GetBytesUsed();
+        size_t GetHighWaterMark();
+
+        //Returns the number of allocations that didn't fit in the arena since it was created
+        unsigned int GetNumberOfOverflows();
+
+        //Formats the arena's usage and high-water mark, used by the DebugUI
+        void ArenaUsageFormatted(string& formatted);
+
+        //Used to determine if the FrameArena should be updated and drawn
+        bool CanUpdate();
+        bool CanDraw();
+
+    private:
+        //Member variables
+        unsigned char* m_Memory;
+        size_t m_Capacity;
+        atomic<size_t> m_Offset;
+        size_t m_HighWaterMark;
+        atomic<unsigned int> m_NumberOfOverflows;
+        bool m_HasLoggedOverflow;
+    };
+}
+
+#endif /* defined(__GameDev2D__FrameArena__) */
@@ -12,7 +12,11 @@
 namespace GameDev2D
 {
     GameService::GameService(const string& aServiceName) : BaseObject(aServiceName), EventDispatcher(),
-      m_ServiceLocatorResponsibleForDeletion(false)
+      m_ServiceLocatorResponsibleForDeletion(false),
+      m_UpdateTime(0),
+      m_DrawTime(0),
+      m_LastFrameUpdateTime(0),
+      m_LastFrameDrawTime(0)
     {
       
     }
@@ -32,6 +36,16 @@ namespace GameDev2D
     
     }
 
+    double GameService::GetUpdateTime()
+    {
+      return (double)m_LastFrameUpdateTime / 1000000.0;
+    }
+
+    double GameService::GetDrawTime()
+    {
+      return (double)m_LastFrameDrawTime / 1000000.0;
+    }
+
     void GameService::SetServiceLocatorResponsibleForDeletion(bool aResponsibleForDeletion)
     {
       m_ServiceLocatorResponsibleForDeletion = aResponsibleForDeletion;
@@ -41,4 +55,23 @@ namespace GameDev2D
     {
       return m_ServiceLocatorResponsibleForDeletion;
     }
+
+    void GameService::AddUpdateTime(unsigned long long aNanoseconds)
+    {
+      m_UpdateTime += aNanoseconds;
+    }
+
+    void GameService::AddDrawTime(unsigned long long aNanoseconds)
+    {
+      m_DrawTime += aNanoseconds;
+    }
+
+    void GameService::EndFrame()
+    {
+      //Keep the frame's times, and reset the times for the next frame
+      m_LastFrameUpdateTime = m_UpdateTime;
+      m_LastFrameDrawTime = m_DrawTime;
+      m_UpdateTime = 0;
+      m_DrawTime = 0;
+    }
 }
\ No newline at end of file
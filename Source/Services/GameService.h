@@ -39,18 +39,33 @@ namespace GameDev2D
         //Abstract method used to determine if the inheriting GameService can be drawn
         virtual bool CanDraw() = 0;
         
+        //Returns the time (in milliseconds) the GameService took to update and to draw in the last frame,
+        //the times are measured by the ServiceLocator
+        double GetUpdateTime();
+        double GetDrawTime();
+        
     protected:
         //Used to keep track if the ServiceLocator is responsible for deleting the
         //GameService from memory
         void SetServiceLocatorResponsibleForDeletion(bool responsibleForDeletion);
         bool IsServiceLocatorResponsibleForDeletion();
         
+        //Used by the ServiceLocator to add the time (in nanoseconds) an update or a draw took this frame, and to keep
+        //the frame's times as the last frame's times at the end of the frame
+        void AddUpdateTime(unsigned long long nanoseconds);
+        void AddDrawTime(unsigned long long nanoseconds);
+        void EndFrame();
+        
         //The ServiceLocator needs to access the protected members
         friend class ServiceLocator;
         
     private:
         //Member variable
         bool m_ServiceLocatorResponsibleForDeletion;
+        unsigned long long m_UpdateTime;
+        unsigned long long m_DrawTime;
+        unsigned long long m_LastFrameUpdateTime;
+        unsigned long long m_LastFrameDrawTime;
     };
 }
 
@@ -28,8 +28,29 @@ namespace GameDev2D
         m_ViewportWidth(0),
         m_ViewportHeight(0),
         m_BoundTextureId(0),
-        m_BoundVertexArray(0)
+        m_BoundVertexArray(0),
+        m_CurrentProgram(0),
+        m_IsBlendingEnabled(false),
+        m_SourceBlending(GL_ONE),
+        m_DestinationBlending(GL_ZERO),
+        m_IsInstancingSupported(false),
+        m_IsInstancingEnabled(GRAPHICS_INSTANCED_RENDERING),
+        m_DrawnObjects(0),
+        m_CulledObjects(0),
+        m_LastFrameDrawnObjects(0),
+        m_LastFrameCulledObjects(0),
+        m_DrawCalls(0),
+        m_LastFrameDrawCalls(0)
     {
+        //Initialize the state call counters
+        for(unsigned int i = 0; i < GraphicsStateCallCount; i++)
+        {
+            m_StateCalls[i] = 0;
+            m_RedundantStateCalls[i] = 0;
+            m_LastFrameStateCalls[i] = 0;
+            m_LastFrameRedundantStateCalls[i] = 0;
+        }
+        
         #if TARGET_OS_IPHONE
         m_MainRenderTarget = new RenderTarget();
         SetActiveRenderTarget(m_MainRenderTarget);
@@ -37,6 +58,33 @@ namespace GameDev2D
         SetClearColor(m_ClearColor);
         #endif
         
+        //Determine if the open gl context supports instancing, desktop open gl needs
+        //version 3.3 (for glVertexAttribDivisor) and open gl es needs version 3.0
+        int majorVersion = 0;
+        int minorVersion = 0;
+        const char* version = (const char*)glGetString(GL_VERSION);
+        if(version != nullptr)
+        {
+            if(sscanf(version, "OpenGL ES %d.%d", &majorVersion, &minorVersion) == 2)
+            {
+                m_IsInstancingSupported = majorVersion >= 3;
+            }
+            else if(sscanf(version, "%d.%d", &majorVersion, &minorVersion) == 2)
+            {
+                m_IsInstancingSupported = majorVersion > 3 || (majorVersion == 3 && minorVersion >= 3);
+            }
+        }
+        
+        #if _WIN32
+        //On Windows the instancing functions are loaded as extensions, make sure they were found
+        if(glDrawArraysInstanced == nullptr || glVertexAttribDivisor == nullptr)
+        {
+            m_IsInstancingSupported = false;
+        }
+        #endif
+        
+        Log(VerbosityLevel_Graphics, "Instancing supported: %s", m_IsInstancingSupported == true ? "true" : "false");
+        
         //Create the default camera and set it as the active camera
         m_DefaultCamera = new Camera();
         m_ActiveCamera = m_DefaultCamera;
@@ -121,6 +169,12 @@ namespace GameDev2D
         return m_ActiveCamera->GetViewMatrix();
     }
     
+    mat4 Graphics::GetViewProjectionMatrix()
+    {
+        assert(m_ActiveCamera != nullptr);
+        return m_ActiveCamera->GetViewProjectionMatrix();
+    }
+    
     void Graphics::Resize(int aWidth, int aHeight)
     {
         #if TARGET_OS_IPHONE
@@ -268,6 +322,9 @@ namespace GameDev2D
     
     void Graphics::BindTexture(Texture* aTexture)
     {
+        //Count the state call
+        m_StateCalls[GraphicsStateCallTexture]++;
+    
         //Safety check the Texture object
         if(aTexture != nullptr)
         {
@@ -281,6 +338,10 @@ namespace GameDev2D
                 glBindTexture(GL_TEXTURE_2D, m_BoundTextureId);
                 Log(VerbosityLevel_Graphics, "Bind texture: %u", m_BoundTextureId);
             }
+            else
+            {
+                m_RedundantStateCalls[GraphicsStateCallTexture]++;
+            }
         }
         else
         {
@@ -297,12 +358,20 @@ namespace GameDev2D
     
     void Graphics::BindVertexArray(unsigned int aVertexArray)
     {
+        //Count the state call
+        m_StateCalls[GraphicsStateCallVertexArray]++;
+    
+        //Bind the vertex array (if its not already bound)
         if(aVertexArray != m_BoundVertexArray)
         {
             m_BoundVertexArray = aVertexArray;
             glBindVertexArray(m_BoundVertexArray);
             Log(VerbosityLevel_Graphics, "Bind vertex array: %u", aVertexArray);
         }
+        else
+        {
+            m_RedundantStateCalls[GraphicsStateCallVertexArray]++;
+        }
     }
     
     unsigned int Graphics::GetBoundVertexArray()
@@ -310,17 +379,179 @@ namespace GameDev2D
         return m_BoundVertexArray;
     }
     
+    void Graphics::UseProgram(unsigned int aProgram)
+    {
+        //Count the state call
+        m_StateCalls[GraphicsStateCallProgram]++;
+    
+        //Use the shader program (if its not already in use)
+        if(aProgram != m_CurrentProgram)
+        {
+            m_CurrentProgram = aProgram;
+            glUseProgram(m_CurrentProgram);
+            Log(VerbosityLevel_Graphics, "Use program: %u", aProgram);
+        }
+        else
+        {
+            m_RedundantStateCalls[GraphicsStateCallProgram]++;
+        }
+    }
+    
+    unsigned int Graphics::GetCurrentProgram()
+    {
+        return m_CurrentProgram;
+    }
+    
+    bool Graphics::IsInstancingSupported()
+    {
+        return m_IsInstancingSupported;
+    }
+    
+    void Graphics::SetInstancingEnabled(bool aIsInstancingEnabled)
+    {
+        m_IsInstancingEnabled = aIsInstancingEnabled;
+    }
+    
+    bool Graphics::IsInstancingEnabled()
+    {
+        return m_IsInstancingEnabled == true && m_IsInstancingSupported == true;
+    }
+    
     void Graphics::EnableBlending(GLenum aSourceBlending, GLenum aDestinationBlending)
     {
-        glBlendFunc(aSourceBlending, aDestinationBlending);
-        glEnable(GL_BLEND);
-        Log(VerbosityLevel_Graphics, "Blending enabled");
+        //Count the state call
+        m_StateCalls[GraphicsStateCallBlending]++;
+    
+        //Is the blending already enabled, with the same blend function
+        if(m_IsBlendingEnabled == true && m_SourceBlending == aSourceBlending && m_DestinationBlending == aDestinationBlending)
+        {
+            m_RedundantStateCalls[GraphicsStateCallBlending]++;
+            return;
+        }
+    
+        //Set the blend function, if it has changed
+        if(m_SourceBlending != aSourceBlending || m_DestinationBlending != aDestinationBlending)
+        {
+            m_SourceBlending = aSourceBlending;
+            m_DestinationBlending = aDestinationBlending;
+            glBlendFunc(m_SourceBlending, m_DestinationBlending);
+        }
+        
+        //Enable blending, if it isn't already enabled
+        if(m_IsBlendingEnabled == false)
+        {
+            m_IsBlendingEnabled = true;
+            glEnable(GL_BLEND);
+            Log(VerbosityLevel_Graphics, "Blending enabled");
+        }
     }
     
     void Graphics::DisableBlending()
     {
-        glDisable(GL_BLEND);
-        Log(VerbosityLevel_Graphics, "Blending disabled");
+        //Count the state call
+        m_StateCalls[GraphicsStateCallBlending]++;
+    
+        //Disable blending, if it isn't already disabled
+        if(m_IsBlendingEnabled == true)
+        {
+            m_IsBlendingEnabled = false;
+            glDisable(GL_BLEND);
+            Log(VerbosityLevel_Graphics, "Blending disabled");
+        }
+        else
+        {
+            m_RedundantStateCalls[GraphicsStateCallBlending]++;
+        }
+    }
+    
+    void Graphics::GetViewBounds(vec2& aMinimum, vec2& aMaximum)
+    {
+        assert(m_ActiveCamera != nullptr);
+        m_ActiveCamera->GetViewBounds(aMinimum, aMaximum);
+    }
+    
+    bool Graphics::IsInView(vec2 aMinimum, vec2 aMaximum)
+    {
+    #if GRAPHICS_FRUSTUM_CULLING
+        //Get the active camera's view bounds, the camera caches them
+        vec2 viewMinimum;
+        vec2 viewMaximum;
+        GetViewBounds(viewMinimum, viewMaximum);
+        
+        //Do the bounding boxes overlap
+        return aMinimum.x <= viewMaximum.x && aMaximum.x >= viewMinimum.x && aMinimum.y <= viewMaximum.y && aMaximum.y >= viewMinimum.y;
+    #else
+        return true;
+    #endif
+    }
+    
+    void Graphics::AddDrawnObjects(unsigned int aCount)
+    {
+        m_DrawnObjects += aCount;
+    }
+    
+    void Graphics::AddCulledObjects(unsigned int aCount)
+    {
+        m_CulledObjects += aCount;
+    }
+    
+    unsigned int Graphics::GetNumberOfDrawnObjects()
+    {
+        return m_LastFrameDrawnObjects;
+    }
+    
+    unsigned int Graphics::GetNumberOfCulledObjects()
+    {
+        return m_LastFrameCulledObjects;
+    }
+    
+    void Graphics::CullingStatsFormatted(string& aFormatted)
+    {
+        stringstream ss;
+        ss << "Drawn: " << m_LastFrameDrawnObjects << " Culled: " << m_LastFrameCulledObjects;
+        aFormatted = ss.str();
+    }
+    
+    void Graphics::AddDrawCall()
+    {
+        m_DrawCalls++;
+    }
+    
+    unsigned int Graphics::GetNumberOfDrawCalls()
+    {
+        return m_LastFrameDrawCalls;
+    }
+    
+    unsigned int Graphics::GetNumberOfStateCalls(GraphicsStateCall aStateCall)
+    {
+        return m_LastFrameStateCalls[aStateCall];
+    }
+    
+    unsigned int Graphics::GetNumberOfRedundantStateCalls(GraphicsStateCall aStateCall)
+    {
+        return m_LastFrameRedundantStateCalls[aStateCall];
+    }
+    
+    void Graphics::Draw()
+    {
+        //Keep the last frame's state call counters, and reset the counters for the new frame
+        for(unsigned int i = 0; i < GraphicsStateCallCount; i++)
+        {
+            m_LastFrameStateCalls[i] = m_StateCalls[i];
+            m_LastFrameRedundantStateCalls[i] = m_RedundantStateCalls[i];
+            m_StateCalls[i] = 0;
+            m_RedundantStateCalls[i] = 0;
+        }
+        
+        //Keep the last frame's culling counters, and reset the counters for the new frame
+        m_LastFrameDrawnObjects = m_DrawnObjects;
+        m_LastFrameCulledObjects = m_CulledObjects;
+        m_DrawnObjects = 0;
+        m_CulledObjects = 0;
+        
+        //Keep the last frame's draw call counter, and reset the counter for the new frame
+        m_LastFrameDrawCalls = m_DrawCalls;
+        m_DrawCalls = 0;
     }
     
     bool Graphics::CanUpdate()
@@ -330,6 +561,7 @@ namespace GameDev2D
     
     bool Graphics::CanDraw()
     {
-        return false;
+        //The Graphics service is drawn first every frame, which resets the state call counters
+        return true;
     }
 }
@@ -25,9 +25,20 @@ using namespace glm;
 
 namespace GameDev2D
 {
+    //Enum of the open gl state changes that the Graphics service caches and counts
+    enum GraphicsStateCall
+    {
+        GraphicsStateCallProgram = 0,
+        GraphicsStateCallBlending,
+        GraphicsStateCallVertexArray,
+        GraphicsStateCallTexture,
+        GraphicsStateCallCount
+    };
+
     //The Graphics game service is responsible for clearing the back buffer, managing
     //the active RenderTarget and Camera, resizing the viewport and backbuffer. Managing
-    //a clipping rect stack and the currently bound texture and vertex array object.
+    //a clipping rect stack and the currently bound texture and vertex array object. The shader program,
+    //blending, texture and vertex array state is cached so that redundant open gl calls are skipped.
     class Graphics : public GameService
     {
     public:
@@ -49,6 +60,10 @@ namespace GameDev2D
         mat4 GetProjectionMatrix();
         mat4 GetViewMatrix();
         
+        //Returns the active camera's projection matrix multiplied by its view matrix, the camera
+        //caches the result until one of its matrices is reset
+        mat4 GetViewProjectionMatrix();
+        
         //Used to resize the back buffer size
         void Resize(int width, int height);
         
@@ -96,9 +111,57 @@ namespace GameDev2D
         //Returns the currently bound vertex array
         unsigned int GetBoundVertexArray();
         
+        //Uses an open gl shader program
+        void UseProgram(unsigned int program);
+        
+        //Returns the shader program currently in use
+        unsigned int GetCurrentProgram();
+        
+        //Returns wether the open gl context supports instanced drawing (glDrawArraysInstanced and glVertexAttribDivisor)
+        bool IsInstancingSupported();
+        
+        //Enables or disables the instanced rendering path, batched quads fall back to the
+        //CPU transformed vertex buffer path when instancing is disabled or isn't supported
+        void SetInstancingEnabled(bool isInstancingEnabled);
+        
+        //Returns wether batched quads will be drawn with instancing
+        bool IsInstancingEnabled();
+        
         //Enables and disables open gl alpha blending
         void EnableBlending(GLenum sourceBlending = GL_SRC_ALPHA, GLenum destinationBlending = GL_ONE_MINUS_SRC_ALPHA);
         void DisableBlending();
+        
+        //Returns the world space bounding box of the active camera's view
+        void GetViewBounds(vec2& minimum, vec2& maximum);
+        
+        //Returns wether a world space bounding box overlaps the active camera's view, always
+        //returns true if frustum culling is disabled. Doesn't count the object as drawn or culled
+        bool IsInView(vec2 minimum, vec2 maximum);
+        
+        //Used to count the objects (and tiles) that were drawn and culled this frame
+        void AddDrawnObjects(unsigned int count);
+        void AddCulledObjects(unsigned int count);
+        
+        //Returns the number of objects that were drawn and culled in the last frame
+        unsigned int GetNumberOfDrawnObjects();
+        unsigned int GetNumberOfCulledObjects();
+        
+        //Returns a formatted string of the drawn and culled objects in the last frame, used by the DebugUI
+        void CullingStatsFormatted(string& formatted);
+        
+        //Used to count the open gl draw calls made this frame
+        void AddDrawCall();
+        
+        //Returns the number of open gl draw calls made in the last frame
+        unsigned int GetNumberOfDrawCalls();
+        
+        //Returns the number of calls made for a state in the last frame, and how many of those calls
+        //were redundant and skipped because the state was already set
+        unsigned int GetNumberOfStateCalls(GraphicsStateCall stateCall);
+        unsigned int GetNumberOfRedundantStateCalls(GraphicsStateCall stateCall);
+        
+        //Called before the other services are drawn each frame, resets the state call, draw call and culling counters
+        void Draw();
 
         //Used to determine if the Graphics should be updated and drawn
         bool CanUpdate();
@@ -128,6 +191,32 @@ namespace GameDev2D
         unsigned int m_BoundTextureId;
         unsigned int m_BoundVertexArray;
         
+        //Members for the current shader program and blending state
+        unsigned int m_CurrentProgram;
+        bool m_IsBlendingEnabled;
+        GLenum m_SourceBlending;
+        GLenum m_DestinationBlending;
+        
+        //Instanced rendering members
+        bool m_IsInstancingSupported;
+        bool m_IsInstancingEnabled;
+        
+        //State call counters for the current frame and the last frame
+        unsigned int m_StateCalls[GraphicsStateCallCount];
+        unsigned int m_RedundantStateCalls[GraphicsStateCallCount];
+        unsigned int m_LastFrameStateCalls[GraphicsStateCallCount];
+        unsigned int m_LastFrameRedundantStateCalls[GraphicsStateCallCount];
+        
+        //Culling counters for the current frame and the last frame
+        unsigned int m_DrawnObjects;
+        unsigned int m_CulledObjects;
+        unsigned int m_LastFrameDrawnObjects;
+        unsigned int m_LastFrameCulledObjects;
+        
+        //Draw call counters for the current frame and the last frame
+        unsigned int m_DrawCalls;
+        unsigned int m_LastFrameDrawCalls;
+        
         //Scissor stack to keep track of multiple clipping rects
         vector<pair<vec2, vec2>> m_ScissorStack;
     };
@@ -0,0 +1,428 @@
+//
+//  JobSystem.cpp
+//  GameDev2D
+//
+
+#include "JobSystem.h"
+#include "../ServiceLocator.h"
+#include "../../Platforms/PlatformLayer.h"
+#include <chrono>
+
+
+namespace GameDev2D
+{
+    JobCounter::JobCounter() :
+        m_Count(0)
+    {
+
+    }
+
+    bool JobCounter::IsDone()
+    {
+        return m_Count == 0;
+    }
+
+    unsigned int JobCounter::GetCount()
+    {
+        return m_Count;
+    }
+
+    JobSystem::JobSystem(unsigned int aNumberOfWorkerThreads) : GameService("JobSystem"),
+        m_Queues(nullptr),
+        m_NumberOfQueues(0),
+        m_NumberOfQueuedJobs(0),
+        m_NumberOfActiveWorkerThreads(0),
+        m_IsRunning(true)
+    {
+        //Use one less than the number of hardware threads, the main thread runs jobs too. The number of hardware threads can be unknown (zero)
+        if(aNumberOfWorkerThreads == 0)
+        {
+            unsigned int numberOfHardwareThreads = thread::hardware_concurrency();
+            aNumberOfWorkerThreads = numberOfHardwareThreads > 1 ? numberOfHardwareThreads - 1 : 0;
+        }
+
+        //Create a queue for each worker thread, and one for the main thread (and any other thread)
+        m_NumberOfQueues = aNumberOfWorkerThreads + 1;
+        m_Queues = new JobQueue[m_NumberOfQueues];
+        m_NumberOfActiveWorkerThreads = aNumberOfWorkerThreads;
+
+        //Start the worker threads, they wait until there is a job to run
+        {
+            lock_guard<mutex> lock(m_Mutex);
+            for(unsigned int i = 0; i < aNumberOfWorkerThreads; i++)
+            {
+                m_WorkerThreads.push_back(thread(&JobSystem::RunWorkerThread, this, i));
+                m_WorkerThreadIds.push_back(m_WorkerThreads.back().get_id());
+            }
+        }
+
+        Log(VerbosityLevel_Debug, "The Job System started %u worker threads", aNumberOfWorkerThreads);
+
+        //Add a shutdown event listener
+        ServiceLocator::GetPlatformLayer()->AddEventListener(this, SHUTDOWN_EVENT);
+
+        #if LOG_JOB_SYSTEM_SCALING_BENCHMARK
+        RunScalingBenchmark();
+        #endif
+    }
+
+    JobSystem::~JobSystem()
+    {
+        //Remove the shutdown event listener
+        ServiceLocator::GetPlatformLayer()->RemoveEventListener(this, SHUTDOWN_EVENT);
+
+        //Make sure the worker threads have stopped
+        Shutdown();
+
+        //Delete the job queues
+        SafeDeleteArray(m_Queues);
+    }
+
+    void JobSystem::Run(JobFunction aFunction, void* aData, JobCounter* aCounter, JobCounter* aDependency)
+    {
+        //Set the job's data
+        Job job;
+        job.function = aFunction;
+        job.data = aData;
+        job.counter = aCounter;
+
+        //The counter is incremented before the job can run
+        if(aCounter != nullptr)
+        {
+            aCounter->m_Count++;
+        }
+
+        //If the dependency isn't done, the job is queued when it is
+        if(aDependency != nullptr)
+        {
+            lock_guard<mutex> lock(aDependency->m_Mutex);
+            if(aDependency->m_Count > 0)
+            {
+                aDependency->m_DependentJobs.push_back(job);
+                return;
+            }
+        }
+
+        QueueJob(job);
+    }
+
+    void JobSystem::WaitForCounter(JobCounter* aCounter)
+    {
+        //Safety check the counter
+        if(aCounter == nullptr)
+        {
+            return;
+        }
+
+        //Run jobs while waiting, the jobs the counter is waiting on could be queued on this thread
+        unsigned int threadIndex = GetThreadIndex();
+        while(aCounter->IsDone() == false)
+        {
+            Job job;
+            if(TakeJob(threadIndex, job) == true)
+            {
+                RunJob(job);
+            }
+            else
+            {
+                this_thread::yield();
+            }
+        }
+
+        //The last job decrements the counter while holding its lock, wait for it to let go before the counter can be deleted
+        lock_guard<mutex> lock(aCounter->m_Mutex);
+    }
+
+    void JobSystem::ParallelFor(unsigned int aCount, ParallelForFunction aFunction, void* aData, unsigned int aBatchSize)
+    {
+        //Safety check the count
+        if(aCount == 0)
+        {
+            return;
+        }
+
+        //Split the range into a few batches per thread, so the threads that finish early can steal the rest
+        if(aBatchSize == 0)
+        {
+            unsigned int numberOfBatches = GetNumberOfThreads() * JOB_SYSTEM_BATCHES_PER_THREAD;
+            aBatchSize = (aCount + numberOfBatches - 1) / numberOfBatches;
+        }
+        unsigned int numberOfBatches = (aCount + aBatchSize - 1) / aBatchSize;
+
+        //A single batch isn't worth queueing
+        if(numberOfBatches == 1)
+        {
+            aFunction(aData, 0, aCount);
+            return;
+        }
+
+        //Queue a job for each batch and help run them
+        vector<ParallelForBatch> batches(numberOfBatches);
+        JobCounter counter;
+        for(unsigned int i = 0; i < numberOfBatches; i++)
+        {
+            batches.at(i).function = aFunction;
+            batches.at(i).data = aData;
+            batches.at(i).startIndex = i * aBatchSize;
+            batches.at(i).endIndex = std::min(batches.at(i).startIndex + aBatchSize, aCount);
+            Run(&JobSystem::RunParallelForBatch, &batches.at(i), &counter);
+        }
+
+        WaitForCounter(&counter);
+    }
+
+    unsigned int JobSystem::GetNumberOfWorkerThreads()
+    {
+        return (unsigned int)m_WorkerThreads.size();
+    }
+
+    unsigned int JobSystem::GetNumberOfThreads()
+    {
+        return m_NumberOfActiveWorkerThreads + 1;
+    }
+
+    void JobSystem::SetNumberOfActiveWorkerThreads(unsigned int aNumberOfActiveWorkerThreads)
+    {
+        {
+            lock_guard<mutex> lock(m_Mutex);
+            m_NumberOfActiveWorkerThreads = std::min(aNumberOfActiveWorkerThreads, (unsigned int)m_WorkerThreads.size());
+        }
+        m_WorkCondition.notify_all();
+    }
+
+    void JobSystem::RunScalingBenchmark()
+    {
+        //Each job writes its result, so the arithmetic can't be optimized away
+        vector<double> results(JOB_SYSTEM_BENCHMARK_NUMBER_OF_JOBS);
+        unsigned int numberOfActiveWorkerThreads = m_NumberOfActiveWorkerThreads;
+        double singleThreadDuration = 0.0;
+
+        //Run the same jobs with the main thread only, then with each additional worker thread
+        for(unsigned int i = 0; i <= GetNumberOfWorkerThreads(); i++)
+        {
+            SetNumberOfActiveWorkerThreads(i);
+
+            //The platform layer's ticks are in milliseconds, the steady clock is more precise
+            chrono::steady_clock::time_point start = chrono::steady_clock::now();
+            JobCounter counter;
+            for(unsigned int j = 0; j < results.size(); j++)
+            {
+                Run(&JobSystem::RunBenchmarkJob, &results.at(j), &counter);
+            }
+            WaitForCounter(&counter);
+            double duration = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+            if(i == 0)
+            {
+                singleThreadDuration = duration;
+            }
+
+            double speedUp = duration > 0.0 ? singleThreadDuration / duration : 0.0;
+            Log(VerbosityLevel_Profiling, "Job System benchmark: %u threads ran %u jobs in %.2fms (%.2fx)", i + 1, (unsigned int)results.size(), duration, speedUp);
+        }
+
+        //Restore the number of active worker threads
+        SetNumberOfActiveWorkerThreads(numberOfActiveWorkerThreads);
+    }
+
+    void JobSystem::Shutdown()
+    {
+        //Has the job system already been shut down
+        {
+            lock_guard<mutex> lock(m_Mutex);
+            if(m_IsRunning == false)
+            {
+                return;
+            }
+
+            //Every worker thread helps run the remaining jobs before stopping
+            m_IsRunning = false;
+            m_NumberOfActiveWorkerThreads = (unsigned int)m_WorkerThreads.size();
+        }
+        m_WorkCondition.notify_all();
+
+        //Wait for the worker threads to finish
+        for(unsigned int i = 0; i < m_WorkerThreads.size(); i++)
+        {
+            m_WorkerThreads.at(i).join();
+        }
+        m_WorkerThreads.clear();
+        m_WorkerThreadIds.clear();
+
+        //Run the jobs that are left, without worker threads
+        Job job;
+        while(TakeJob(m_NumberOfQueues - 1, job) == true)
+        {
+            RunJob(job);
+        }
+
+        Log(VerbosityLevel_Debug, "The Job System has shut down");
+    }
+
+    bool JobSystem::CanUpdate()
+    {
+        return false;
+    }
+
+    bool JobSystem::CanDraw()
+    {
+        return false;
+    }
+
+    void JobSystem::HandleEvent(Event* aEvent)
+    {
+        switch (aEvent->GetEventCode())
+        {
+            case SHUTDOWN_EVENT:
+                Shutdown();
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    void JobSystem::RunWorkerThread(unsigned int aThreadIndex)
+    {
+        while(true)
+        {
+            //Run a job if the thread is active and there is one to take
+            Job job;
+            if(aThreadIndex < m_NumberOfActiveWorkerThreads && TakeJob(aThreadIndex, job) == true)
+            {
+                RunJob(job);
+                continue;
+            }
+
+            //Wait for a job, or for the job system to shut down
+            unique_lock<mutex> lock(m_Mutex);
+            while(m_IsRunning == true && (m_NumberOfQueuedJobs == 0 || aThreadIndex >= m_NumberOfActiveWorkerThreads))
+            {
+                m_WorkCondition.wait(lock);
+            }
+
+            //The queues are emptied before the worker threads stop
+            if(m_IsRunning == false && m_NumberOfQueuedJobs == 0)
+            {
+                break;
+            }
+        }
+    }
+
+    void JobSystem::QueueJob(const Job& aJob)
+    {
+        //Once the job system is shut down, jobs run immediately. Without worker threads (a single core) a queued job would
+        //only run when a thread waits for it, a job that is polled rather than waited for would never run
+        bool shouldQueue = false;
+        {
+            //The count is incremented before the job is queued, so a worker thread never waits while there is a job queued
+            lock_guard<mutex> lock(m_Mutex);
+            shouldQueue = m_IsRunning == true && m_NumberOfQueues > 1;
+            if(shouldQueue == true)
+            {
+                m_NumberOfQueuedJobs++;
+            }
+        }
+
+        if(shouldQueue == false)
+        {
+            Job job = aJob;
+            RunJob(job);
+            return;
+        }
+
+        //Queue the job on the calling thread's queue and wake a worker thread up
+        JobQueue& queue = m_Queues[GetThreadIndex()];
+        {
+            lock_guard<mutex> lock(queue.queueMutex);
+            queue.jobs.push_back(aJob);
+        }
+        m_WorkCondition.notify_one();
+    }
+
+    bool JobSystem::TakeJob(unsigned int aThreadIndex, Job& aJob)
+    {
+        //Take the last job queued on the thread's own queue
+        {
+            JobQueue& queue = m_Queues[aThreadIndex];
+            lock_guard<mutex> lock(queue.queueMutex);
+            if(queue.jobs.empty() == false)
+            {
+                aJob = queue.jobs.back();
+                queue.jobs.pop_back();
+                m_NumberOfQueuedJobs--;
+                return true;
+            }
+        }
+
+        //Steal the oldest job from another thread's queue
+        for(unsigned int i = 1; i < m_NumberOfQueues; i++)
+        {
+            JobQueue& queue = m_Queues[(aThreadIndex + i) % m_NumberOfQueues];
+            lock_guard<mutex> lock(queue.queueMutex);
+            if(queue.jobs.empty() == false)
+            {
+                aJob = queue.jobs.front();
+                queue.jobs.pop_front();
+                m_NumberOfQueuedJobs--;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void JobSystem::RunJob(Job& aJob)
+    {
+        //Run the job
+        aJob.function(aJob.data);
+
+        //Decrement the counter, once it is done its dependent jobs can be queued
+        if(aJob.counter != nullptr)
+        {
+            vector<Job> dependentJobs;
+            {
+                lock_guard<mutex> lock(aJob.counter->m_Mutex);
+                aJob.counter->m_Count--;
+                if(aJob.counter->m_Count == 0)
+                {
+                    dependentJobs.swap(aJob.counter->m_DependentJobs);
+                }
+            }
+
+            for(unsigned int i = 0; i < dependentJobs.size(); i++)
+            {
+                QueueJob(dependentJobs.at(i));
+            }
+        }
+    }
+
+    unsigned int JobSystem::GetThreadIndex()
+    {
+        thread::id threadId = this_thread::get_id();
+        for(unsigned int i = 0; i < m_WorkerThreadIds.size(); i++)
+        {
+            if(m_WorkerThreadIds.at(i) == threadId)
+            {
+                return i;
+            }
+        }
+        return m_NumberOfQueues - 1;
+    }
+
+    void JobSystem::RunParallelForBatch(void* aBatch)
+    {
+        ParallelForBatch* batch = (ParallelForBatch*)aBatch;
+        batch->function(batch->data, batch->startIndex, batch->endIndex);
+    }
+
+    void JobSystem::RunBenchmarkJob(void* aResult)
+    {
+        double result = 0.0;
+        for(unsigned int i = 1; i <= JOB_SYSTEM_BENCHMARK_JOB_ITERATIONS; i++)
+        {
+            result += std::sqrt((double)i);
+        }
+        *(double*)aResult = result;
+    }
+}
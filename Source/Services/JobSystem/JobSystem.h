@@ -0,0 +1,159 @@
+//
+//  JobSystem.h
+//  GameDev2D
+//
+
+#ifndef __GameDev2D__JobSystem__
+#define __GameDev2D__JobSystem__
+
+#include "../GameService.h"
+#include "../../Events/EventHandler.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <deque>
+
+
+using namespace std;
+
+namespace GameDev2D
+{
+    //Function pointers for a job, and for a batch of a parallel-for (from the start index, up to but not including the end index)
+    typedef void (*JobFunction)(void* data);
+    typedef void (*ParallelForFunction)(void* data, unsigned int startIndex, unsigned int endIndex);
+
+    //Local constants
+    const unsigned int JOB_SYSTEM_DEFAULT_BATCH_SIZE = 0;//Zero splits a parallel-for into a few batches per thread
+    const unsigned int JOB_SYSTEM_BATCHES_PER_THREAD = 4;
+    const unsigned int JOB_SYSTEM_BENCHMARK_NUMBER_OF_JOBS = 256;
+    const unsigned int JOB_SYSTEM_BENCHMARK_JOB_ITERATIONS = 100000;
+
+    //Forward declarations
+    class JobCounter;
+
+    //A job is a function and its data, the counter (if there is one) is decremented once the job has run
+    struct Job
+    {
+        JobFunction function;
+        void* data;
+        JobCounter* counter;
+    };
+
+    //A job counter counts the jobs that haven't finished running, it is used to wait for a group of
+    //jobs and to make jobs depend on a group of jobs. A counter must outlive the jobs it counts.
+    class JobCounter
+    {
+    public:
+        JobCounter();
+
+        //Returns true once every job the counter counts has finished running
+        bool IsDone();
+
+        //Returns the number of jobs that haven't finished running
+        unsigned int GetCount();
+
+    private:
+        //The job system increments and decrements the count and queues the dependent jobs
+        friend class JobSystem;
+
+        //Member variables
+        atomic<unsigned int> m_Count;
+        mutex m_Mutex;
+        vector<Job> m_DependentJobs;
+    };
+
+    //The JobSystem game service runs jobs on a worker thread per core, the thread that calls Run() or
+    //WaitForCounter() is treated as one more worker. Each thread has its own job queue, a thread runs the
+    //last job it queued first and when its queue is empty it steals the oldest job from another thread's
+    //queue. It is the engine's only thread pool, the asset loading, path finding and simulation should
+    //queue jobs on it rather than creating threads of their own.
+    class JobSystem : public GameService
+    {
+    public:
+        //Creates the worker threads, zero creates one less than the number of hardware threads
+        JobSystem(unsigned int numberOfWorkerThreads = 0);
+        ~JobSystem();
+
+        //Queues a job, the counter (optional) is incremented and then decremented once the job has run. The job only
+        //starts once the dependency counter (optional) is done. Once the job system is shut down, or if it doesn't have any
+        //worker threads, jobs run immediately
+        void Run(JobFunction function, void* data, JobCounter* counter = nullptr, JobCounter* dependency = nullptr);
+
+        //Runs jobs until the counter is done, the calling thread helps rather than blocking
+        void WaitForCounter(JobCounter* counter);
+
+        //Splits the range into batches and runs them as jobs, returns once every batch has run. A batch size
+        //of zero splits the range into a few batches per thread
+        void ParallelFor(unsigned int count, ParallelForFunction function, void* data, unsigned int batchSize = JOB_SYSTEM_DEFAULT_BATCH_SIZE);
+
+        //Returns the number of worker threads, and the number of threads that run jobs (the workers and the main thread)
+        unsigned int GetNumberOfWorkerThreads();
+        unsigned int GetNumberOfThreads();
+
+        //Limits the number of worker threads that take jobs, used to measure how the jobs scale with the number of cores
+        void SetNumberOfActiveWorkerThreads(unsigned int numberOfActiveWorkerThreads);
+
+        //Runs the same batch of jobs with 0 to N worker threads and logs the time each run took and its speed up
+        void RunScalingBenchmark();
+
+        //Stops the worker threads once they have run the jobs that are queued, called on the shutdown event
+        void Shutdown();
+
+        //Used to determine if the JobSystem should be updated and drawn
+        bool CanUpdate();
+        bool CanDraw();
+
+        //Used to handle the shutdown event
+        void HandleEvent(Event* event);
+
+    private:
+        //A thread's job queue, the owner pushes and pops at the back and the other threads steal from the front
+        struct JobQueue
+        {
+            mutex queueMutex;
+            deque<Job> jobs;
+        };
+
+        //The worker threads' loop, runs jobs until the job system is shut down
+        void RunWorkerThread(unsigned int threadIndex);
+
+        //Queues a job on the calling thread's queue, and wakes a worker thread up
+        void QueueJob(const Job& job);
+
+        //Takes a job from the thread's own queue or steals one from another thread, returns false if there are none
+        bool TakeJob(unsigned int threadIndex, Job& job);
+
+        //Runs the job and decrements its counter, queueing the counter's dependent jobs when it is done
+        void RunJob(Job& job);
+
+        //Returns the calling thread's index, the worker threads come first and any other thread uses the last queue
+        unsigned int GetThreadIndex();
+
+        //The parallel-for batches are run as jobs
+        struct ParallelForBatch
+        {
+            ParallelForFunction function;
+            void* data;
+            unsigned int startIndex;
+            unsigned int endIndex;
+        };
+        static void RunParallelForBatch(void* batch);
+
+        //The benchmark's job, a fixed amount of arithmetic
+        static void RunBenchmarkJob(void* result);
+
+        //Member variables
+        vector<thread> m_WorkerThreads;
+        vector<thread::id> m_WorkerThreadIds;
+        JobQueue* m_Queues;
+        unsigned int m_NumberOfQueues;
+        atomic<unsigned int> m_NumberOfQueuedJobs;
+        atomic<unsigned int> m_NumberOfActiveWorkerThreads;
+        mutex m_Mutex;
+        condition_variable m_WorkCondition;
+        bool m_IsRunning;
+    };
+}
+
+#endif /* defined(__GameDev2D__JobSystem__) */
@@ -0,0 +1,68 @@
+//
+//  ResourceHandle.h
+//  GameDev2D
+//
+
+#ifndef __GameDev2D__ResourceHandle__
+#define __GameDev2D__ResourceHandle__
+
+#include "ResourceManager.h"
+
+
+using namespace std;
+
+namespace GameDev2D
+{
+    //The ResourceHandle is a typed handle to a resource in the ResourceManager, it only holds the resource's hashed id.
+    //The handle doesn't hold a reference, the resource can be evicted once its reference count reaches zero, after
+    //that Get() returns null and the state is unloaded. Check the state before using a resource that is loading.
+    template <class T> class ResourceHandle
+    {
+    public:
+        ResourceHandle() :
+            m_ResourceManager(nullptr),
+            m_Id(0)
+        {
+
+        }
+
+        ResourceHandle(ResourceManager* aResourceManager, ResourceId aId) :
+            m_ResourceManager(aResourceManager),
+            m_Id(aId)
+        {
+
+        }
+
+        //Returns the resource's object, returns null if the resource isn't loaded
+        T* Get() const
+        {
+            Resource* resource = m_ResourceManager != nullptr ? m_ResourceManager->GetResource(m_Id) : nullptr;
+            return resource != nullptr && resource->state == ResourceStateLoaded ? (T*)resource->object : nullptr;
+        }
+
+        //Returns the resource's load state
+        ResourceState GetState() const
+        {
+            return m_ResourceManager != nullptr ? m_ResourceManager->GetResourceState(m_Id) : ResourceStateUnloaded;
+        }
+
+        //Returns wether the resource is loaded
+        bool IsLoaded() const
+        {
+            return GetState() == ResourceStateLoaded;
+        }
+
+        //Returns the resource's hashed id
+        ResourceId GetId() const
+        {
+            return m_Id;
+        }
+
+    private:
+        //Member variables
+        ResourceManager* m_ResourceManager;
+        ResourceId m_Id;
+    };
+}
+
+#endif /* defined(__GameDev2D__ResourceHandle__) */
@@ -0,0 +1,306 @@
+//
+//  ResourceManager.cpp
+//  GameDev2D
+//
+
+#include "ResourceManager.h"
+#include "../ServiceLocator.h"
+#include "../../Platforms/PlatformLayer.h"
+#include <iomanip>
+#include <sstream>
+
+
+namespace GameDev2D
+{
+    ResourceManager::ResourceManager(size_t aMemoryBudget) : GameService("ResourceManager"),
+        m_MemoryBudget(aMemoryBudget),
+        m_NumberOfBytesResident(0),
+        m_NumberOfEvictions(0)
+    {
+        //The managers set their unloaders when they are created
+        for(unsigned int i = 0; i < ResourceTypeCount; i++)
+        {
+            m_ResourceUnloaders[i] = nullptr;
+        }
+
+        //Register for the low memory event
+        ServiceLocator::GetPlatformLayer()->AddEventListener(this, LOW_MEMORY_WARNING_EVENT);
+    }
+
+    ResourceManager::~ResourceManager()
+    {
+        //Remove the listener for the low memory event
+        ServiceLocator::GetPlatformLayer()->RemoveEventListener(this, LOW_MEMORY_WARNING_EVENT);
+
+        //The managers unload their resources when they are deleted, if there are resources left their unloaders are gone
+        if(m_Resources.size() > 0)
+        {
+            Error(false, "%u resources were never unloaded, the manager that loaded them must unload them", (unsigned int)m_Resources.size());
+        }
+
+        //Delete the remaining resource structs
+        for(unordered_map<ResourceId, Resource*>::iterator it = m_Resources.begin(); it != m_Resources.end(); ++it)
+        {
+            SafeDelete(it->second);
+        }
+        m_Resources.clear();
+        m_UnusedResources.clear();
+    }
+
+    ResourceId ResourceManager::GetResourceId(ResourceType aType, const string& aKey)
+    {
+        //FNV-1a hash of the key, the type is hashed first so the same key can be used by different types
+        ResourceId id = 14695981039346656037ULL;
+        id ^= (unsigned char)aType;
+        id *= 1099511628211ULL;
+
+        for(size_t i = 0; i < aKey.length(); i++)
+        {
+            id ^= (unsigned char)aKey[i];
+            id *= 1099511628211ULL;
+        }
+        return id;
+    }
+
+    void ResourceManager::SetResourceUnloader(ResourceType aType, ResourceUnloader* aResourceUnloader)
+    {
+        m_ResourceUnloaders[aType] = aResourceUnloader;
+    }
+
+    Resource* ResourceManager::AddResource(ResourceType aType, const string& aKey, void* aObject, size_t aNumberOfBytes, unsigned int aReferenceCount, ResourceState aState)
+    {
+        //If this assert is hit, the resource was already added (or two keys hashed to the same id)
+        ResourceId id = GetResourceId(aType, aKey);
+        assert(m_Resources.find(id) == m_Resources.end());
+
+        //Safety check that the id isn't used
+        if(m_Resources.find(id) != m_Resources.end())
+        {
+            Error(false, "Failed to add resource: %s, its id is already used by resource: %s", aKey.c_str(), m_Resources[id]->key.c_str());
+            return nullptr;
+        }
+
+        //Create the resource
+        Resource* resource = new Resource();
+        resource->id = id;
+        resource->type = aType;
+        resource->key = aKey;
+        resource->object = aObject;
+        resource->numberOfBytes = aState == ResourceStateLoaded ? aNumberOfBytes : 0;
+        resource->referenceCount = aReferenceCount;
+        resource->state = aState;
+        resource->isUnused = false;
+        m_Resources[id] = resource;
+
+        //Make room for the resource, then add it to the unused resources if it isn't used
+        m_NumberOfBytesResident += resource->numberOfBytes;
+        EvictUnusedResources(m_MemoryBudget);
+
+        if(resource->referenceCount == 0 && resource->state == ResourceStateLoaded)
+        {
+            AddUnusedResource(resource);
+        }
+
+        return resource;
+    }
+
+    Resource* ResourceManager::GetResource(ResourceId aId)
+    {
+        unordered_map<ResourceId, Resource*>::iterator it = m_Resources.find(aId);
+        return it != m_Resources.end() ? it->second : nullptr;
+    }
+
+    Resource* ResourceManager::GetResource(ResourceType aType, const string& aKey)
+    {
+        return GetResource(GetResourceId(aType, aKey));
+    }
+
+    ResourceState ResourceManager::GetResourceState(ResourceId aId)
+    {
+        Resource* resource = GetResource(aId);
+        return resource != nullptr ? resource->state : ResourceStateUnloaded;
+    }
+
+    void ResourceManager::SetResourceLoaded(Resource* aResource, size_t aNumberOfBytes)
+    {
+        //Set the resource as loaded
+        aResource->state = ResourceStateLoaded;
+        aResource->numberOfBytes = aNumberOfBytes;
+
+        //Make room for the resource, then add it to the unused resources if it isn't used
+        m_NumberOfBytesResident += aNumberOfBytes;
+        EvictUnusedResources(m_MemoryBudget);
+
+        if(aResource->referenceCount == 0)
+        {
+            AddUnusedResource(aResource);
+        }
+    }
+
+    void ResourceManager::ResizeResource(Resource* aResource, size_t aNumberOfBytes)
+    {
+        //Replace the resource's size in the resident bytes
+        m_NumberOfBytesResident -= aResource->numberOfBytes;
+        m_NumberOfBytesResident += aNumberOfBytes;
+        aResource->numberOfBytes = aNumberOfBytes;
+
+        //Make room for the resource, if it grew
+        EvictUnusedResources(m_MemoryBudget);
+    }
+
+    void ResourceManager::AddReference(Resource* aResource)
+    {
+        //The resource is used again, it can't be evicted
+        if(aResource->isUnused == true)
+        {
+            RemoveUnusedResource(aResource);
+        }
+
+        aResource->referenceCount++;
+    }
+
+    void ResourceManager::RemoveReference(Resource* aResource, bool aEvictImmediately)
+    {
+        //Safety check the reference count
+        if(aResource->referenceCount == 0)
+        {
+            return;
+        }
+
+        //Has the reference count reached zero? Only loaded resources can be evicted
+        aResource->referenceCount--;
+        if(aResource->referenceCount == 0 && aResource->state == ResourceStateLoaded)
+        {
+            if(aEvictImmediately == true)
+            {
+                UnloadResource(aResource);
+                m_NumberOfEvictions++;
+            }
+            else
+            {
+                AddUnusedResource(aResource);
+                EvictUnusedResources(m_MemoryBudget);
+            }
+        }
+    }
+
+    void ResourceManager::UnloadResource(Resource* aResource)
+    {
+        //Remove the resource from the unused resources
+        if(aResource->isUnused == true)
+        {
+            RemoveUnusedResource(aResource);
+        }
+
+        //Delete the resource's object, if this assert is hit the resource's type doesn't have an unloader
+        ResourceUnloader* resourceUnloader = m_ResourceUnloaders[aResource->type];
+        assert(resourceUnloader != nullptr);
+
+        if(resourceUnloader != nullptr && aResource->object != nullptr)
+        {
+            resourceUnloader->UnloadResource(aResource->type, aResource->object);
+        }
+
+        //Remove the resource
+        m_NumberOfBytesResident -= aResource->numberOfBytes;
+        m_Resources.erase(aResource->id);
+        SafeDelete(aResource);
+    }
+
+    void ResourceManager::UnloadResources(ResourceType aType)
+    {
+        //Gather the resources first, unloading a resource erases it from the map
+        vector<Resource*> resources;
+        for(unordered_map<ResourceId, Resource*>::iterator it = m_Resources.begin(); it != m_Resources.end(); ++it)
+        {
+            if(it->second->type == aType)
+            {
+                resources.push_back(it->second);
+            }
+        }
+
+        for(unsigned int i = 0; i < resources.size(); i++)
+        {
+            UnloadResource(resources.at(i));
+        }
+    }
+
+    void ResourceManager::EvictUnusedResources(size_t aNumberOfBytes)
+    {
+        //The least recently used resource is at the back of the unused resources
+        while(m_NumberOfBytesResident > aNumberOfBytes && m_UnusedResources.empty() == false)
+        {
+            Resource* resource = m_UnusedResources.back();
+            Log(VerbosityLevel_Debug, "Evicted resource: %s (%llu bytes)", resource->key.c_str(), (unsigned long long)resource->numberOfBytes);
+
+            UnloadResource(resource);
+            m_NumberOfEvictions++;
+        }
+    }
+
+    void ResourceManager::SetMemoryBudget(size_t aMemoryBudget)
+    {
+        m_MemoryBudget = aMemoryBudget;
+        EvictUnusedResources(m_MemoryBudget);
+    }
+
+    size_t ResourceManager::GetMemoryBudget()
+    {
+        return m_MemoryBudget;
+    }
+
+    size_t ResourceManager::GetNumberOfBytesResident()
+    {
+        return m_NumberOfBytesResident;
+    }
+
+    unsigned int ResourceManager::GetNumberOfResources()
+    {
+        return (unsigned int)m_Resources.size();
+    }
+
+    unsigned int ResourceManager::GetNumberOfUnusedResources()
+    {
+        return (unsigned int)m_UnusedResources.size();
+    }
+
+    void ResourceManager::ResourceUsageFormatted(string& aFormatted)
+    {
+        stringstream resourceStream;
+        resourceStream << "Resources: " << fixed << setprecision(1) << (double)m_NumberOfBytesResident / (1024.0 * 1024.0) << "MB of " << (double)m_MemoryBudget / (1024.0 * 1024.0) << "MB";
+        resourceStream << " (" << m_Resources.size() << " resident, " << m_UnusedResources.size() << " unused, " << m_NumberOfEvictions << " evicted)";
+        aFormatted = resourceStream.str();
+    }
+
+    bool ResourceManager::CanUpdate()
+    {
+        return false;
+    }
+
+    bool ResourceManager::CanDraw()
+    {
+        return false;
+    }
+
+    void ResourceManager::HandleEvent(Event* aEvent)
+    {
+        if(aEvent->GetEventCode() == LOW_MEMORY_WARNING_EVENT)
+        {
+            EvictUnusedResources((size_t)(m_MemoryBudget * RESOURCE_MANAGER_LOW_MEMORY_BUDGET_SCALE));
+        }
+    }
+
+    void ResourceManager::AddUnusedResource(Resource* aResource)
+    {
+        //The most recently used resource is at the front
+        m_UnusedResources.push_front(aResource);
+        aResource->unusedIterator = m_UnusedResources.begin();
+        aResource->isUnused = true;
+    }
+
+    void ResourceManager::RemoveUnusedResource(Resource* aResource)
+    {
+        m_UnusedResources.erase(aResource->unusedIterator);
+        aResource->isUnused = false;
+    }
+}
@@ -0,0 +1,148 @@
+//
+//  ResourceManager.h
+//  GameDev2D
+//
+
+#ifndef __GameDev2D__ResourceManager__
+#define __GameDev2D__ResourceManager__
+
+#include "../GameService.h"
+#include <list>
+#include <unordered_map>
+
+
+using namespace std;
+
+namespace GameDev2D
+{
+    //The hashed id of a resource, based on its type and key
+    typedef unsigned long long ResourceId;
+
+    //The types of resources, each type is loaded by a different manager
+    enum ResourceType
+    {
+        ResourceTypeTexture = 0,
+        ResourceTypeBitmapFont,
+        ResourceTypeTrueTypeFont,
+        ResourceTypeShader,
+        ResourceTypeSound,
+        ResourceTypeCount
+    };
+
+    //The load state of a resource, a resource that isn't resident is unloaded
+    enum ResourceState
+    {
+        ResourceStateUnloaded = 0,
+        ResourceStateLoading,
+        ResourceStateLoaded
+    };
+
+    //Local constants
+    const float RESOURCE_MANAGER_LOW_MEMORY_BUDGET_SCALE = 0.5f;
+
+    //A resident resource, the object is owned by the ResourceManager and is deleted by the type's ResourceUnloader
+    struct Resource
+    {
+        ResourceId id;
+        ResourceType type;
+        string key;
+        void* object;
+        size_t numberOfBytes;
+        unsigned int referenceCount;
+        ResourceState state;
+        bool isUnused;
+        list<Resource*>::iterator unusedIterator;
+    };
+
+    //The ResourceUnloader deletes the resources of a type, the manager that loads the type implements it
+    class ResourceUnloader
+    {
+    public:
+        virtual ~ResourceUnloader() {}
+
+        //Deletes the resource's object
+        virtual void UnloadResource(ResourceType type, void* object) = 0;
+    };
+
+    //The ResourceManager game service keeps track of the resources loaded by the TextureManager, FontManager, ShaderManager and
+    //AudioManager. Resources are looked up by a hashed id and are reference counted, a resource with a reference count of zero
+    //isn't deleted right away, it is kept resident in case it is used again. When the resident resources exceed the memory
+    //budget the unused resources are evicted, least recently used first. A low memory warning evicts the unused resources
+    //until the resident resources are within a fraction of the budget
+    class ResourceManager : public GameService
+    {
+    public:
+        ResourceManager(size_t memoryBudget);
+        ~ResourceManager();
+
+        //Returns the hashed id for the resource type and key
+        static ResourceId GetResourceId(ResourceType type, const string& key);
+
+        //Sets the unloader for a resource type, the unloader is used to delete the evicted resources
+        void SetResourceUnloader(ResourceType type, ResourceUnloader* unloader);
+
+        //Adds a resource with a reference count, returns the resource. If the resource is loading its object is set when it finishes
+        Resource* AddResource(ResourceType type, const string& key, void* object, size_t numberOfBytes, unsigned int referenceCount, ResourceState state = ResourceStateLoaded);
+
+        //Returns the resident resource for the id or the type and key, returns null if the resource isn't resident
+        Resource* GetResource(ResourceId id);
+        Resource* GetResource(ResourceType type, const string& key);
+
+        //Returns the load state of the resource for the id
+        ResourceState GetResourceState(ResourceId id);
+
+        //Sets a loading resource's size and sets it as loaded, if it isn't used it can be evicted from now on
+        void SetResourceLoaded(Resource* resource, size_t numberOfBytes);
+
+        //Sets the size of a loaded resource, used when a resource is reloaded. If the resource grew, the unused resources
+        //are evicted to stay within the memory budget, the resource itself can be evicted if it is unused
+        void ResizeResource(Resource* resource, size_t numberOfBytes);
+
+        //Increments and decrements the reference count of a resource. When the reference count reaches zero the resource
+        //becomes the most recently used unused resource, or is evicted right away if evictImmediately is true
+        void AddReference(Resource* resource);
+        void RemoveReference(Resource* resource, bool evictImmediately = false);
+
+        //Unloads a resource, or all the resources of a type, whatever their reference count is. Used when a resource fails
+        //to load and by the managers when they are deleted
+        void UnloadResource(Resource* resource);
+        void UnloadResources(ResourceType type);
+
+        //Evicts the unused resources, least recently used first, until the resident resources are within the number of bytes
+        void EvictUnusedResources(size_t numberOfBytes);
+
+        //Sets the memory budget (in bytes), the unused resources are evicted if the resident resources exceed it
+        void SetMemoryBudget(size_t memoryBudget);
+        size_t GetMemoryBudget();
+
+        //Returns the number of bytes the resident resources use, and the number of resident and unused resources
+        size_t GetNumberOfBytesResident();
+        unsigned int GetNumberOfResources();
+        unsigned int GetNumberOfUnusedResources();
+
+        //Formats the resident resources, the budget and the number of evictions, used by the DebugUI
+        void ResourceUsageFormatted(string& formatted);
+
+        //Used to determine if the ResourceManager should be updated and drawn
+        bool CanUpdate();
+        bool CanDraw();
+
+        //Handles events, we need to handle a low memory event
+        void HandleEvent(Event* event);
+
+    private:
+        //Adds and removes a resource from the unused resources
+        void AddUnusedResource(Resource* resource);
+        void RemoveUnusedResource(Resource* resource);
+
+        //Member variables
+        unordered_map<ResourceId, Resource*> m_Resources;
+        list<Resource*> m_UnusedResources;
+        ResourceUnloader* m_ResourceUnloaders[ResourceTypeCount];
+        size_t m_MemoryBudget;
+        size_t m_NumberOfBytesResident;
+        unsigned int m_NumberOfEvictions;
+    };
+}
+
+#endif /* defined(__GameDev2D__ResourceManager__) */
@@ -45,6 +45,9 @@ namespace GameDev2D
         //Set the active and root scene to null
         m_RootScene = nullptr;
         
+        //Stop preloading scenes, the scenes are deleted by their owners
+        m_PreloadScenes.clear();
+        
         //Clear the active scenes vector
         m_ActiveScenes.clear();
         
@@ -97,6 +100,9 @@ namespace GameDev2D
             //Otherwise load the active scene
             LoadActiveScene();
         }
+        
+        //Load the preloading scenes in the background
+        LoadPreloadScenes();
     }
     
     void SceneManager::UpdateScene(Scene* aScene, double aDelta)
@@ -203,6 +209,37 @@ namespace GameDev2D
         }
     }
     
+    void SceneManager::LoadPreloadScenes()
+    {
+        //Load one step of each preloading scene, the last scene preloaded is loaded first, a scene that
+        //preloads another scene in its LoadContent() method usually needs it to finish loading first
+        double startTime = ServiceLocator::GetPlatformLayer()->GetElapsedTime();
+        vector<Scene*> preloadScenes = m_PreloadScenes;
+        for(int i = (int)preloadScenes.size() - 1; i >= 0; i--)
+        {
+            //Is the preload budget used up?
+            double elapsed = ServiceLocator::GetPlatformLayer()->GetElapsedTime() - startTime;
+            if(elapsed * 1000.0 >= SCENE_PRELOAD_BUDGET_MILLISECONDS)
+            {
+                break;
+            }
+            
+            //Make sure the scene is still preloading, a scene's LoadContent() method can cancel another scene's preload
+            Scene* scene = preloadScenes.at(i);
+            if(find(m_PreloadScenes.begin(), m_PreloadScenes.end(), scene) == m_PreloadScenes.end())
+            {
+                continue;
+            }
+            
+            //Load the scene's next step, once the scene is loaded it is no longer preloaded
+            if(scene->LoadContent() >= 1.0f)
+            {
+                scene->SetIsLoaded(true);
+                CancelPreload(scene);
+            }
+        }
+    }
+    
     bool SceneManager::IsActiveSceneLoaded()
     {
         //Cycle through the active scenes and make sure all the active scene's are loaded
@@ -368,22 +405,30 @@ namespace GameDev2D
     
     void SceneManager::PreloadScene(Scene* aScene)
     {
-        //Safety check the Scene pointer
-        if(aScene != nullptr)
+        //Safety check the Scene pointer, and that it isn't loaded or preloading already
+        if(aScene != nullptr && aScene->IsLoaded() == false)
         {
-            bool loaded = false;
-            
-            //Load the scene until it is loaded
-            while (loaded == false)
+            if(find(m_PreloadScenes.begin(), m_PreloadScenes.end(), aScene) == m_PreloadScenes.end())
             {
-                loaded = aScene->LoadContent() == 1.0f;
+                m_PreloadScenes.push_back(aScene);
             }
-            
-            //Set that the scene has been loaded
-            aScene->SetIsLoaded(true);
         }
     }
     
+    void SceneManager::CancelPreload(Scene* aScene)
+    {
+        vector<Scene*>::iterator it = find(m_PreloadScenes.begin(), m_PreloadScenes.end(), aScene);
+        if(it != m_PreloadScenes.end())
+        {
+            m_PreloadScenes.erase(it);
+        }
+    }
+    
+    bool SceneManager::IsSceneLoaded(Scene* aScene)
+    {
+        return aScene != nullptr && aScene->IsLoaded() == true;
+    }
+    
     bool SceneManager::IsActiveScene(Scene* aScene)
     {
         if(aScene != nullptr)
@@ -464,6 +509,12 @@ namespace GameDev2D
         //Set the active scenes vector
         m_ActiveScenes = m_Scenes.back();
         
+        //The active scenes are loaded by LoadActiveScene(), if they were still preloading
+        for(unsigned int i = 0; i < m_ActiveScenes.size(); i++)
+        {
+            CancelPreload(m_ActiveScenes.at(i));
+        }
+        
         //
         sort(m_ActiveScenes.begin(), m_ActiveScenes.end(), SceneManager::SortActiveScenes);
         
@@ -72,10 +72,18 @@ namespace GameDev2D
         void RemoveScene(Scene* scene);
         void RemoveScene(const string& name);
         
-        //Call this method to preload a Scene to avoid an unwanted loading scene, its recommended
-        //to only call this in another Scene's LoadContent() method to avoid a frame rate hiccup
+        //Call this method to preload a Scene to avoid an unwanted loading scene. The Scene is loaded in the background,
+        //the SceneManager calls its LoadContent() method once each frame (within SCENE_PRELOAD_BUDGET_MILLISECONDS for
+        //all the preloading scenes), while the active scenes keep updating and drawing. A preloaded Scene that is pushed
+        //is shown without the LoadingUI, if it is pushed before it is loaded it finishes loading behind the LoadingUI
         void PreloadScene(Scene* scene);
         
+        //Stops preloading a Scene, called when a Scene is deleted
+        void CancelPreload(Scene* scene);
+        
+        //Returns wether the Scene's content is loaded
+        bool IsSceneLoaded(Scene* scene);
+        
         //Returns wether the scene pointer is part of the active scenes vector
         bool IsActiveScene(Scene* scene);
         
@@ -97,6 +105,9 @@ namespace GameDev2D
         void LoadActiveScene();
         bool IsActiveSceneLoaded();
         
+        //Loads a step of the preloading scenes' content, until the preload budget is used up
+        void LoadPreloadScenes();
+        
         //Event Handling method
         void HandleEvent(Event* event);
 
@@ -107,6 +118,7 @@ namespace GameDev2D
         //Member variables
         vector<vector<Scene*>> m_Scenes;
         vector<Scene*> m_ActiveScenes;
+        vector<Scene*> m_PreloadScenes;
         Scene* m_RootScene;
         Timer* m_TransitionTimer;
         TransitionState m_TransitionState;
@@ -25,6 +25,15 @@ namespace GameDev2D
     FontManager* ServiceLocator::s_FontManager = nullptr;
     LoadingUI* ServiceLocator::s_LoadingUI = nullptr;
     DebugUI* ServiceLocator::s_DebugUI = nullptr;
+    DebugRenderer* ServiceLocator::s_DebugRenderer = nullptr;
+    JobSystem* ServiceLocator::s_JobSystem = nullptr;
+    FrameArena* ServiceLocator::s_FrameArena = nullptr;
+    ResourceManager* ServiceLocator::s_ResourceManager = nullptr;
+    FileWatcher* ServiceLocator::s_FileWatcher = nullptr;
+    unsigned long long ServiceLocator::s_UpdateTime = 0;
+    unsigned long long ServiceLocator::s_DrawTime = 0;
+    unsigned long long ServiceLocator::s_LastFrameUpdateTime = 0;
+    unsigned long long ServiceLocator::s_LastFrameDrawTime = 0;
     
     
     void ServiceLocator::SetPlatformLayer(PlatformLayer* aPlatformLayer)
@@ -34,6 +43,10 @@ namespace GameDev2D
     
     void ServiceLocator::LoadDefaultServices()
     {
+        AddService(new FrameArena(FRAME_ARENA_CAPACITY));
+        AddService(new JobSystem(JOB_SYSTEM_NUMBER_OF_WORKER_THREADS));
+        AddService(new ResourceManager(RESOURCE_MEMORY_BUDGET));
+        AddService(new FileWatcher());
         AddService(new ShaderManager());
         AddService(new TextureManager());
         AddService(new Graphics());
@@ -41,6 +54,7 @@ namespace GameDev2D
         AddService(new AudioManager());
         AddService(new FontManager());
         AddService(new SceneManager());
+        AddService(new DebugRenderer());
         AddService(new LoadingUI());
         AddService(new DebugUI());
     }
@@ -90,6 +104,31 @@ namespace GameDev2D
         AddService((GameService**)&s_DebugUI, aDebugUI, aResponsibleForDeletion);
     }
     
+    void ServiceLocator::AddService(DebugRenderer* aDebugRenderer, bool aResponsibleForDeletion)
+    {
+        AddService((GameService**)&s_DebugRenderer, aDebugRenderer, aResponsibleForDeletion);
+    }
+    
+    void ServiceLocator::AddService(JobSystem* aJobSystem, bool aResponsibleForDeletion)
+    {
+        AddService((GameService**)&s_JobSystem, aJobSystem, aResponsibleForDeletion);
+    }
+    
+    void ServiceLocator::AddService(FrameArena* aFrameArena, bool aResponsibleForDeletion)
+    {
+        AddService((GameService**)&s_FrameArena, aFrameArena, aResponsibleForDeletion);
+    }
+    
+    void ServiceLocator::AddService(ResourceManager* aResourceManager, bool aResponsibleForDeletion)
+    {
+        AddService((GameService**)&s_ResourceManager, aResourceManager, aResponsibleForDeletion);
+    }
+    
+    void ServiceLocator::AddService(FileWatcher* aFileWatcher, bool aResponsibleForDeletion)
+    {
+        AddService((GameService**)&s_FileWatcher, aFileWatcher, aResponsibleForDeletion);
+    }
+    
     PlatformLayer* ServiceLocator::GetPlatformLayer()
     {
         return s_PlatformLayer;
@@ -149,17 +188,65 @@ namespace GameDev2D
         return s_DebugUI;
     }
     
+    DebugRenderer* ServiceLocator::GetDebugRenderer()
+    {
+        assert(s_DebugRenderer != nullptr);
+        return s_DebugRenderer;
+    }
+    
+    JobSystem* ServiceLocator::GetJobSystem()
+    {
+        assert(s_JobSystem != nullptr);
+        return s_JobSystem;
+    }
+    
+    FrameArena* ServiceLocator::GetFrameArena()
+    {
+        assert(s_FrameArena != nullptr);
+        return s_FrameArena;
+    }
+    
+    ResourceManager* ServiceLocator::GetResourceManager()
+    {
+        assert(s_ResourceManager != nullptr);
+        return s_ResourceManager;
+    }
+    
+    FileWatcher* ServiceLocator::GetFileWatcher()
+    {
+        assert(s_FileWatcher != nullptr);
+        return s_FileWatcher;
+    }
+    
     void ServiceLocator::RemoveService(GameService* aService)
     {
         if(aService != nullptr)
         {
+            //The service is passed in by value, find the static variable that references it, it's cleared once the service
+            //is deleted so the service isn't used after it has been removed
+            GameService** services[] = { (GameService**)&s_Graphics, (GameService**)&s_TextureManager, (GameService**)&s_ShaderManager,
+                                         (GameService**)&s_InputManager, (GameService**)&s_AudioManager, (GameService**)&s_SceneManager,
+                                         (GameService**)&s_FontManager, (GameService**)&s_LoadingUI, (GameService**)&s_DebugUI,
+                                         (GameService**)&s_DebugRenderer, (GameService**)&s_JobSystem, (GameService**)&s_FrameArena,
+                                         (GameService**)&s_ResourceManager, (GameService**)&s_FileWatcher };
+            GameService** serviceToClear = nullptr;
+            for(unsigned int i = 0; i < sizeof(services) / sizeof(services[0]); i++)
+            {
+                if(*services[i] == aService)
+                {
+                    serviceToClear = services[i];
+                    break;
+                }
+            }
+            
             if(aService->IsServiceLocatorResponsibleForDeletion() == true)
             {
                 SafeDelete(aService);
             }
-            else
+            
+            if(serviceToClear != nullptr)
             {
-                aService = nullptr;
+                *serviceToClear = nullptr;
             }
         }
     }
@@ -168,54 +255,146 @@ namespace GameDev2D
     {
         RemoveService(s_DebugUI);
         RemoveService(s_LoadingUI);
+        RemoveService(s_DebugRenderer);
         RemoveService(s_SceneManager);
         RemoveService(s_FontManager);
         RemoveService(s_AudioManager);
         RemoveService(s_InputManager);
-        RemoveService(s_Graphics);
+        
+        //The texture and shader managers are removed before the graphics service, deleting a texture or a shader resets the graphics service's cached bindings
         RemoveService(s_TextureManager);
         RemoveService(s_ShaderManager);
+        RemoveService(s_Graphics);
+        
+        //The file watcher is removed after the managers, they stop listening for its events when they are deleted
+        RemoveService(s_FileWatcher);
+        
+        //The resource manager is removed after the managers, they unload their resources when they are deleted
+        RemoveService(s_ResourceManager);
+        
+        //The job system is removed last, the other services can still be waiting on jobs
+        RemoveService(s_JobSystem);
+        
+        //The frame arena is removed after the job system, the jobs can allocate from it
+        RemoveService(s_FrameArena);
     }
     
     void ServiceLocator::UpdateServices(double aDelta)
     {
+        //The services can be updated more than once a frame, the times are added up
+        unsigned long long start = s_PlatformLayer->GetTimeNanoseconds();
+        
         UpdateService(s_Graphics, aDelta);
         UpdateService(s_TextureManager, aDelta);
         UpdateService(s_ShaderManager, aDelta);
         UpdateService(s_InputManager, aDelta);
         UpdateService(s_AudioManager, aDelta);
         UpdateService(s_SceneManager, aDelta);
+        UpdateService(s_DebugRenderer, aDelta);
         UpdateService(s_FontManager, aDelta);
         UpdateService(s_LoadingUI, aDelta);
         UpdateService(s_DebugUI, aDelta);
+        UpdateService(s_JobSystem, aDelta);
+        UpdateService(s_FrameArena, aDelta);
+        UpdateService(s_ResourceManager, aDelta);
+        UpdateService(s_FileWatcher, aDelta);
+        
+        s_UpdateTime += s_PlatformLayer->GetTimeNanoseconds() - start;
     }
     
     void ServiceLocator::UpdateService(GameService* aService, double aDelta)
     {
         if(aService != nullptr && aService->CanUpdate() == true)
         {
+            unsigned long long start = s_PlatformLayer->GetTimeNanoseconds();
             aService->Update(aDelta);
+            aService->AddUpdateTime(s_PlatformLayer->GetTimeNanoseconds() - start);
         }
     }
     
     void ServiceLocator::DrawServices()
     {
+        unsigned long long start = s_PlatformLayer->GetTimeNanoseconds();
+        
         DrawService(s_Graphics);
         DrawService(s_TextureManager);
         DrawService(s_ShaderManager);
         DrawService(s_InputManager);
         DrawService(s_AudioManager);
         DrawService(s_SceneManager);
+        DrawService(s_DebugRenderer);
         DrawService(s_FontManager);
         DrawService(s_LoadingUI);
         DrawService(s_DebugUI);
+        DrawService(s_JobSystem);
+        DrawService(s_FrameArena);
+        DrawService(s_ResourceManager);
+        DrawService(s_FileWatcher);
+        
+        //The services are drawn once a frame, keep the frame's update and draw times and reset them for the next frame
+        s_DrawTime += s_PlatformLayer->GetTimeNanoseconds() - start;
+        s_LastFrameUpdateTime = s_UpdateTime;
+        s_LastFrameDrawTime = s_DrawTime;
+        s_UpdateTime = 0;
+        s_DrawTime = 0;
+        
+        EndServiceFrame(s_Graphics);
+        EndServiceFrame(s_TextureManager);
+        EndServiceFrame(s_ShaderManager);
+        EndServiceFrame(s_InputManager);
+        EndServiceFrame(s_AudioManager);
+        EndServiceFrame(s_SceneManager);
+        EndServiceFrame(s_DebugRenderer);
+        EndServiceFrame(s_FontManager);
+        EndServiceFrame(s_LoadingUI);
+        EndServiceFrame(s_DebugUI);
+        EndServiceFrame(s_JobSystem);
+        EndServiceFrame(s_FrameArena);
+        EndServiceFrame(s_ResourceManager);
+        EndServiceFrame(s_FileWatcher);
     }
     
     void ServiceLocator::DrawService(GameService* aService)
     {
         if(aService != nullptr && aService->CanDraw() == true)
         {
+            unsigned long long start = s_PlatformLayer->GetTimeNanoseconds();
             aService->Draw();
+            aService->AddDrawTime(s_PlatformLayer->GetTimeNanoseconds() - start);
+        }
+    }
+    
+    void ServiceLocator::EndServiceFrame(GameService* aService)
+    {
+        if(aService != nullptr)
+        {
+            aService->EndFrame();
+        }
+    }
+    
+    double ServiceLocator::GetUpdateTime()
+    {
+        return (double)s_LastFrameUpdateTime / 1000000.0;
+    }
+    
+    double ServiceLocator::GetDrawTime()
+    {
+        return (double)s_LastFrameDrawTime / 1000000.0;
+    }
+    
+    void ServiceLocator::GetServices(vector<GameService*>& aServices)
+    {
+        GameService* services[] = { s_Graphics, s_TextureManager, s_ShaderManager, s_InputManager, s_AudioManager, s_SceneManager, s_DebugRenderer,
+                                    s_FontManager, s_LoadingUI, s_DebugUI, s_JobSystem, s_FrameArena, s_ResourceManager, s_FileWatcher };
+        
+        //Only the services that have been added are returned
+        aServices.clear();
+        for(unsigned int i = 0; i < sizeof(services) / sizeof(GameService*); i++)
+        {
+            if(services[i] != nullptr)
+            {
+                aServices.push_back(services[i]);
+            }
         }
     }
     
@@ -19,7 +19,12 @@
 #include "FontManager/FontManager.h"
 #include "AudioManager/AudioManager.h"
 #include "DebugUI/DebugUI.h"
+#include "DebugRenderer/DebugRenderer.h"
 #include "LoadingUI/LoadingUI.h"
+#include "JobSystem/JobSystem.h"
+#include "FrameArena/FrameArena.h"
+#include "ResourceManager/ResourceManager.h"
+#include "FileWatcher/FileWatcher.h"
 
 
 namespace GameDev2D
@@ -41,6 +46,14 @@ namespace GameDev2D
         //Methods that are called from the PlatformLayer to Update and Draw all the services
         static void UpdateServices(double delta);
         static void DrawServices();
+        
+        //Returns the time (in milliseconds) all the services took to update and to draw in the last frame,
+        //each GameService's own times are returned by its GetUpdateTime() and GetDrawTime() methods
+        static double GetUpdateTime();
+        static double GetDrawTime();
+        
+        //Returns the services in the order they are updated, used by the DebugUI to show each service's times
+        static void GetServices(vector<GameService*>& services);
 
         //Setter methods to add each GameService to the ServiceLocator
         static void AddService(Graphics* graphics, bool responsibleForDeletion = true);
@@ -52,6 +65,11 @@ namespace GameDev2D
         static void AddService(FontManager* fontManager, bool responsibleForDeletion = true);
         static void AddService(LoadingUI* loadingUI, bool responsibleForDeletion = true);
         static void AddService(DebugUI* debugUI, bool responsibleForDeletion = true);
+        static void AddService(DebugRenderer* debugRenderer, bool responsibleForDeletion = true);
+        static void AddService(JobSystem* jobSystem, bool responsibleForDeletion = true);
+        static void AddService(FrameArena* frameArena, bool responsibleForDeletion = true);
+        static void AddService(ResourceManager* resourceManager, bool responsibleForDeletion = true);
+        static void AddService(FileWatcher* fileWatcher, bool responsibleForDeletion = true);
         
         //Getter methods to access the ServiceLocator's GameServices
         static PlatformLayer* GetPlatformLayer();
@@ -64,6 +82,11 @@ namespace GameDev2D
         static FontManager* GetFontManager();
         static LoadingUI* GetLoadingUI();
         static DebugUI* GetDebugUI();
+        static DebugRenderer* GetDebugRenderer();
+        static JobSystem* GetJobSystem();
+        static FrameArena* GetFrameArena();
+        static ResourceManager* GetResourceManager();
+        static FileWatcher* GetFileWatcher();
         
         //Removes a specific service from the ServiceLocator
         static void RemoveService(GameService* service);
@@ -75,6 +98,9 @@ namespace GameDev2D
         //Conveniance methods to Update and Draw an individual GameService
         static void UpdateService(GameService* service, double aDelta);
         static void DrawService(GameService* aService);
+        
+        //Conveniance method to keep a GameService's update and draw times at the end of the frame
+        static void EndServiceFrame(GameService* service);
 
         //Conveniance method to add an individual GameService
         static void AddService(GameService** serviceToSet, GameService* serviceRef, bool responsibleForDeletion);
@@ -90,6 +116,17 @@ namespace GameDev2D
         static FontManager* s_FontManager;
         static LoadingUI* s_LoadingUI;
         static DebugUI* s_DebugUI;
+        static DebugRenderer* s_DebugRenderer;
+        static JobSystem* s_JobSystem;
+        static FrameArena* s_FrameArena;
+        static ResourceManager* s_ResourceManager;
+        static FileWatcher* s_FileWatcher;
+        
+        //Static variables for the services' update and draw times, for the current frame and the last frame
+        static unsigned long long s_UpdateTime;
+        static unsigned long long s_DrawTime;
+        static unsigned long long s_LastFrameUpdateTime;
+        static unsigned long long s_LastFrameDrawTime;
     };
 }
 #endif /* defined(__GameDev2D__ServiceLocator__) */
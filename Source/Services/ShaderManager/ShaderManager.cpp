@@ -16,6 +16,9 @@ namespace GameDev2D
 {
     ShaderManager::ShaderManager() : GameService("ShaderManager")
     {
+        //The ResourceManager deletes the shaders through the ShaderManager
+        ServiceLocator::GetResourceManager()->SetResourceUnloader(ResourceTypeShader, this);
+        
         //Load the pass through shader
         vector<string> attributes;
         attributes.push_back("a_vertices");
@@ -29,16 +32,25 @@ namespace GameDev2D
         attributes.push_back("a_textureCoordinates");
         attributes.push_back("a_textureColor");
         LoadShader("passThrough-tex", attributes);
+        
+        //Load the instanced texture pass through shader, it shares the texture pass through fragment shader.
+        //The model matrix is split into four column attributes, so that each attribute takes one location
+        attributes.clear();
+        attributes.push_back("a_vertices");
+        attributes.push_back("a_instanceModel0");
+        attributes.push_back("a_instanceModel1");
+        attributes.push_back("a_instanceModel2");
+        attributes.push_back("a_instanceModel3");
+        attributes.push_back("a_instanceSourceFrame");
+        attributes.push_back("a_instanceColor");
+        LoadShader("passThrough-tex-instanced", "passThrough-tex", attributes);
     }
 
     ShaderManager::~ShaderManager()
     {
         //Unload all the shaders
-        while(m_ShaderMap.size() > 0)
-        {
-            SafeDelete(m_ShaderMap.begin()->second);
-            m_ShaderMap.erase(m_ShaderMap.begin());
-        }
+        ServiceLocator::GetResourceManager()->UnloadResources(ResourceTypeShader);
+        ServiceLocator::GetResourceManager()->SetResourceUnloader(ResourceTypeShader, nullptr);
     }
 
     Shader* ShaderManager::LoadShader(const string& aShader, vector<string> aAttributes)
@@ -62,8 +74,8 @@ namespace GameDev2D
         //Check to see if they v and f are the same
         string key = aVertexShader == aFragmentShader ? aVertexShader : aVertexShader + aFragmentShader;
 
-        //Get the pair from the texture map
-        Shader* shader = m_ShaderMap[key];
+        //Get the shader, if it is already loaded
+        Shader* shader = GetShader(key);
         
         //Is the shader pointer null?
         if(shader == nullptr)
@@ -170,7 +182,7 @@ namespace GameDev2D
             }
             
             //Create a new shader with the vertex and fragment shaders
-            Shader* shader = new Shader(vertexSource, fragmentSource);
+            shader = new Shader(vertexSource, fragmentSource);
             shader->SetKey(key);
             
             //Cycle through the attributes and add them to the shader
@@ -182,8 +194,8 @@ namespace GameDev2D
             //Link the shader
             shader->Link();
             
-            //Set the shader map pair for the filename key
-            m_ShaderMap[key] = shader;
+            //Add the shader's resource, the ShaderManager holds the only reference to it
+            ServiceLocator::GetResourceManager()->AddResource(ResourceTypeShader, key, shader, 0, 1);
             
             //Free the memory for the vertex and fragment sources
             free(vertexSource);
@@ -196,18 +208,18 @@ namespace GameDev2D
 
     Shader* ShaderManager::GetShader(const string& aShader)
     {
-        //Get the shader for the key
-        Shader* shader = m_ShaderMap[aShader];
+        //Get the shader's resource for the key
+        Resource* resource = ServiceLocator::GetResourceManager()->GetResource(ResourceTypeShader, aShader);
 
         //Return the shader object
-        return shader;
+        return resource != nullptr ? (Shader*)resource->object : nullptr;
     }
     
     Shader* ShaderManager::GetShader(const string& aVertexShader, const string& aFragmentShader)
     {
         if(aVertexShader == aFragmentShader)
         {
-            GetShader(aVertexShader);
+            return GetShader(aVertexShader);
         }
         return GetShader(string(aVertexShader + aFragmentShader));
     }
@@ -222,6 +234,11 @@ namespace GameDev2D
         return GetShader("passThrough-tex");
     }
 
+    Shader* ShaderManager::GetPassthroughTextureInstancedShader()
+    {
+        return GetShader("passThrough-tex-instanced", "passThrough-tex");
+    }
+
     bool ShaderManager::CanUpdate()
     {
         return false;
@@ -231,4 +248,10 @@ namespace GameDev2D
     {
         return false;
     }
+    
+    void ShaderManager::UnloadResource(ResourceType aType, void* aObject)
+    {
+        Shader* shader = (Shader*)aObject;
+        SafeDelete(shader);
+    }
 }
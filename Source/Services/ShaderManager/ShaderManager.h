@@ -10,6 +10,7 @@
 #define __GameDev2D__ShaderManager__
 
 #include "../GameService.h"
+#include "../ResourceManager/ResourceManager.h"
 #include "../../Graphics/Core/Shader.h"
 
 
@@ -17,9 +18,10 @@ using namespace std;
 
 namespace GameDev2D
 {
-    //The ShaderManager uses reference counting to ensure that the same shader isn't loaded twice.
-    //It has two default passthrough shader, one for basic geometry the other for textures.
-    class ShaderManager : public GameService
+    //The ShaderManager uses the ResourceManager to ensure that the same shader isn't loaded twice, the ShaderManager holds
+    //a reference to every shader so they are never evicted. It has three default passthrough shader, one for basic geometry,
+    //one for textures and one for instanced textures.
+    class ShaderManager : public GameService, public ResourceUnloader
     {
     public:
         ShaderManager();
@@ -39,13 +41,15 @@ namespace GameDev2D
         Shader* GetPassthroughShader();
         Shader* GetPassthroughTextureShader();
         
+        //Instanced texture passthrough shader, the model matrix, source frame and color are per instance attributes
+        Shader* GetPassthroughTextureInstancedShader();
+        
         //Tells the ServiceLocator wether to Update and Draw this Game Service
         bool CanUpdate();
         bool CanDraw();
         
-    private:
-        //Member variables
-        map<string, Shader*> m_ShaderMap;
+        //Deletes a shader unloaded by the ResourceManager, inherited from ResourceUnloader
+        void UnloadResource(ResourceType type, void* object);
     };
 }
 
@@ -10,8 +10,11 @@
 #include "../ServiceLocator.h"
 #include "../../Graphics/Textures/Texture.h"
 #include "../../Graphics/Textures/TextureFrame.h"
+#include "../../IO/AtlasFile.h"
+#include "../../Events/Platform/FileChangedEvent.h"
 #include "../../Platforms/PlatformLayer.h"
 #include "../../Graphics/OpenGL.h"
+#include <algorithm>
 
 
 namespace GameDev2D
@@ -19,24 +22,45 @@ namespace GameDev2D
     TextureManager::TextureManager() : GameService("TextureManager"),
         m_PlaceHolder(nullptr)
     {
-        //Register for the low memory event
-        ServiceLocator::GetPlatformLayer()->AddEventListener(this, LOW_MEMORY_WARNING_EVENT);
+        //The ResourceManager deletes the evicted textures through the TextureManager
+        ServiceLocator::GetResourceManager()->SetResourceUnloader(ResourceTypeTexture, this);
+        
+#if HOT_RELOAD_TEXTURES
+        //Listen for the watched textures and atlases changing on disk
+        ServiceLocator::GetFileWatcher()->AddEventListener(this, FILE_CHANGED_EVENT);
+#endif
     }
     
     TextureManager::~TextureManager()
     {
-        //Remove the listener for the low memory event
-        ServiceLocator::GetPlatformLayer()->RemoveEventListener(this, LOW_MEMORY_WARNING_EVENT);
+#if HOT_RELOAD_TEXTURES
+        //Remove the file changed event listener
+        ServiceLocator::GetFileWatcher()->RemoveEventListener(this, FILE_CHANGED_EVENT);
+#endif
+        
+        //Discard the textures that are still being preloaded, the jobs must be done before the textures are deleted. The
+        //textures aren't uploaded or watched, the FileWatcher and the PlatformLayer are already shutting down, the loading
+        //textures are deleted with the rest of the textures below
+        while(m_TexturePreloads.size() > 0)
+        {
+            TexturePreload* texturePreload = m_TexturePreloads.begin()->second;
+            ServiceLocator::GetJobSystem()->WaitForCounter(&texturePreload->counter);
+
+            for(map<string, SourceFrame*>::iterator it = texturePreload->atlasFrames.begin(); it != texturePreload->atlasFrames.end(); ++it)
+            {
+                SafeDelete(it->second);
+            }
+
+            m_TexturePreloads.erase(m_TexturePreloads.begin());
+            SafeDelete(texturePreload);
+        }
     
         //Delete the placeholder texture
         SafeDelete(m_PlaceHolder);
         
         //Unload all the textures
-        while(m_TextureMap.size() > 0)
-        {
-            SafeDelete(m_TextureMap.begin()->second.first);
-            m_TextureMap.erase(m_TextureMap.begin());
-        }
+        ServiceLocator::GetResourceManager()->UnloadResources(ResourceTypeTexture);
+        ServiceLocator::GetResourceManager()->SetResourceUnloader(ResourceTypeTexture, nullptr);
 
         //Unload the atlas data
         while (m_AtlasKeys.size() > 0)
@@ -63,6 +87,9 @@ namespace GameDev2D
             return;
         }
         
+        //If the texture is being preloaded, finish preloading it
+        FinishTexturePreload(aFilename);
+        
         //Append the filename to the directory
         string filename = string(aFilename);
         
@@ -92,45 +119,61 @@ namespace GameDev2D
             return;
         }
     
-        //Get the pair from the texture map
-        pair<Texture*, unsigned int> texturePair = m_TextureMap[aFilename];
+        //Get the texture's resource
+        Resource* resource = ServiceLocator::GetResourceManager()->GetResource(ResourceTypeTexture, aFilename);
         
-        //Is the texture pointer null?
-        if(texturePair.first == nullptr)
+        //Is the texture resident?
+        if(resource == nullptr)
         {
-            //Create a new texture object, set the retain count to 1
-            texturePair.first = new Texture(aFilename);
-            texturePair.second = 1;
+            //Create a new texture object
+            Texture* texture = new Texture(aFilename);
             
             //Load the texture from the path
-            if(texturePair.first->LoadFromPath(path) == false)
+            if(texture->LoadFromPath(path) == false)
             {
                 //Delete the texture
-                SafeDelete(texturePair.first);
+                SafeDelete(texture);
                 
                 //Log and error and return out of this method
                 Error("Failed to load texture: %s", aFilename.c_str());
                 return;
             }
+            
+            //Add the texture's resource, set the reference count to 1
+            resource = ServiceLocator::GetResourceManager()->AddResource(ResourceTypeTexture, aFilename, texture, texture->GetNumberOfBytes(), 1);
+            
+            //Watch the png file, so the texture can be hot-reloaded
+            WatchFile(path, aFilename);
         }
         else
         {
             //Increment the reference count
-            texturePair.second++;
+            ServiceLocator::GetResourceManager()->AddReference(resource);
         }
         
-        //Set the texture map pair for the filename key
-        m_TextureMap[aFilename] = texturePair;
-        
         //Set the texture frame's texture
         if(aTextureFrame != nullptr)
         {
-            aTextureFrame->SetTexture(texturePair.first, true);
+            aTextureFrame->SetTexture((Texture*)resource->object, true);
+            
+#if HOT_RELOAD_TEXTURES
+            //Keep track of the texture frame, it is updated when the texture is hot-reloaded
+            m_TextureFrames[aFilename].push_back(aTextureFrame);
+#endif
         }
     }
     
     bool TextureManager::RemoveTexture(TextureFrame* aTextureFrame)
     {
+#if HOT_RELOAD_TEXTURES
+        //Stop keeping track of the texture frame
+        map<string, vector<TextureFrame*>>::iterator it = m_TextureFrames.find(aTextureFrame->GetFilename());
+        if(it != m_TextureFrames.end())
+        {
+            it->second.erase(remove(it->second.begin(), it->second.end(), aTextureFrame), it->second.end());
+        }
+#endif
+        
         return RemoveTexture(aTextureFrame->GetFilename());
     }
     
@@ -138,32 +181,15 @@ namespace GameDev2D
     {
         bool success = false;
     
-        //Get the pair from the texture map
-        pair<Texture*, unsigned int> texturePair = m_TextureMap[aFilename];
+        //Get the texture's resource
+        Resource* resource = ServiceLocator::GetResourceManager()->GetResource(ResourceTypeTexture, aFilename);
         
-        //Is the texture pointer null?
-        if(texturePair.first != nullptr)
+        //Is the texture resident?
+        if(resource != nullptr)
         {
-            //Subract from the retain counter
-            texturePair.second--;
-            
-            //Has the counter reacher zero?
-            if(texturePair.second <= 0)
-            {
-                texturePair.second = 0;
-            }
-
-            //Set the texture map pair for the filename key
-            m_TextureMap[aFilename] = texturePair;
-            
-            //If the purge unused texture congif is enabled, purge the texture
-            //immediately if the retain count reaches zero
-            #if PURGE_UNUSED_TEXTURES_IMMEDIATELY
-            if(texturePair.second == 0)
-            {
-                PurgeUnusedTextures();
-            }
-            #endif
+            //Subract from the reference count, if the purge unused texture config is enabled the
+            //texture is evicted immediately if the reference count reaches zero
+            ServiceLocator::GetResourceManager()->RemoveReference(resource, PURGE_UNUSED_TEXTURES_IMMEDIATELY == 1);
             
             //Set the success flag to true
             success = true;
@@ -172,8 +198,69 @@ namespace GameDev2D
         return success;
     }
 
+    ResourceHandle<Texture> TextureManager::PreloadTexture(const string& aFilename, const string& aDirectory)
+    {
+        //Is the texture already loaded or being preloaded?
+        if(ServiceLocator::GetResourceManager()->GetResource(ResourceTypeTexture, aFilename) != nullptr)
+        {
+            return GetTextureHandle(aFilename);
+        }
+        
+        //Was .png appended to the filename? If it was, remove it
+        string filename = string(aFilename);
+        size_t found = filename.find(".png");
+        if(found != std::string::npos)
+        {
+            filename.erase(found, 4);
+        }
+        
+        //Get the path for the texture, if the image doesn't exist AddTexture() will load the placeholder
+        string path = ServiceLocator::GetPlatformLayer()->GetPathForResourceInDirectory(filename.c_str(), "png", aDirectory.c_str());
+        if(ServiceLocator::GetPlatformLayer()->DoesFileExistAtPath(path) == false)
+        {
+            return GetTextureHandle(aFilename);
+        }
+        
+        //Create the texture preload
+        TexturePreload* texturePreload = new TexturePreload();
+        texturePreload->texture = new Texture(aFilename);
+        texturePreload->path = path;
+        texturePreload->isDecoded = false;
+        
+        //If the texture has an atlas json file that hasn't been loaded, it is parsed by the job as well
+        if(m_AtlasKeys.find(aFilename) == m_AtlasKeys.end())
+        {
+            string atlasPath = ServiceLocator::GetPlatformLayer()->GetPathForResourceInDirectory(filename.c_str(), "json", aDirectory.c_str());
+            if(ServiceLocator::GetPlatformLayer()->DoesFileExistAtPath(atlasPath) == true)
+            {
+                texturePreload->atlasPath = atlasPath;
+            }
+        }
+        
+        //Add the texture's resource, it is loading until the OpenGL texture is generated
+        ServiceLocator::GetResourceManager()->AddResource(ResourceTypeTexture, aFilename, texturePreload->texture, 0, 0, ResourceStateLoading);
+        
+        //Queue the job that decodes the texture
+        m_TexturePreloads[aFilename] = texturePreload;
+        ServiceLocator::GetJobSystem()->Run(&TextureManager::DecodeTexturePreload, texturePreload, &texturePreload->counter);
+        return GetTextureHandle(aFilename);
+    }
+    
+    ResourceHandle<Texture> TextureManager::GetTextureHandle(const string& aFilename)
+    {
+        return ResourceHandle<Texture>(ServiceLocator::GetResourceManager(), ResourceManager::GetResourceId(ResourceTypeTexture, aFilename));
+    }
+    
+    bool TextureManager::IsTexturePreloading(const string& aFilename)
+    {
+        return GetTextureHandle(aFilename).GetState() == ResourceStateLoading;
+    }
+
     SourceFrame* TextureManager::LoadAtlasFrame(const string& aFilename, const string& aAtlasKey, const string& aDirectory)
     {
+        //If the atlas is being preloaded, finish preloading it
+        FinishTexturePreload(aFilename);
+        
         //Get the pair from the texture map
         map<string, SourceFrame*> atlasFrames = m_AtlasKeys[aFilename];
         SourceFrame* sourceFrame = atlasFrames[aAtlasKey];
@@ -201,50 +288,21 @@ namespace GameDev2D
             //If the json files exists, load the atlas frae
             if (doesExist == true)
             {
-                //Open the input stream
-                ifstream inputStream;
-                inputStream.open(jsonPath.c_str(), std::ifstream::in);
-
                 //Parse the json data
-                Json::Value root;
-                Json::Reader reader;
-                if (reader.parse(inputStream, root, false) == true)
+                if (LoadAtlas(jsonPath, atlasFrames) == true)
                 {
-                    //Get the frames
-                    const Json::Value frames = root["frames"];
-
-                    //Cycle through the frames and parse the frame data
-                    for (unsigned int index = 0; index < frames.size(); ++index)
-                    {
-                        //Safety check the filename
-                        if (frames[index]["filename"].isString() == true)
-                        {
-                            //Get the atlas key
-                            string atlasKey = string(frames[index]["filename"].asString());
-
-                            //Load the source frame
-                            SourceFrame* frame = LoadFrame(frames[index]["frame"]);
-                            atlasFrames[atlasKey] = frame;
-
-                            //If the atlaskey matches set the source frame pointer
-                            if (atlasKey == aAtlasKey)
-                            {
-                                sourceFrame = frame;
-                            }
-                        }
-                    }
-
-                    //Set the atlas 
+                    //Set the source frame pointer and the atlas
+                    sourceFrame = atlasFrames[aAtlasKey];
                     m_AtlasKeys[aFilename] = atlasFrames;
+                    
+                    //Watch the json file, so the atlas can be hot-reloaded
+                    WatchFile(jsonPath, aFilename);
                 }
                 else
                 {
                     //The json file does not exist, log an error
                     Error(false, "Failed to parse JSON file: %s for atlas key: %s", aFilename.c_str(), aAtlasKey.c_str());
                 }
-
-                //Close the input stream
-                inputStream.close();
             }
             else
             {
@@ -257,58 +315,242 @@ namespace GameDev2D
         return sourceFrame;
     }
 
-    SourceFrame* TextureManager::LoadFrame(const Json::Value& aFrame)
+    bool TextureManager::LoadAtlas(const string& aJsonPath, map<string, SourceFrame*>& aAtlasFrames)
     {
-        //Get the values from the frame
-        unsigned int x = aFrame["x"].asInt();
-        unsigned int y = aFrame["y"].asInt();
-        unsigned int width = aFrame["w"].asInt();
-        unsigned int height = aFrame["h"].asInt();
-
-        //Return the source frame
-        SourceFrame* sourceFrame = new SourceFrame((float)x, (float)y, (float)width, (float)height);
-        return sourceFrame;
+        //Load the atlas json, or its binary cache if it is up to date
+        AtlasFile atlasFile(aJsonPath);
+        if (atlasFile.IsLoaded() == true)
+        {
+            //Cycle through the frames and create the source frames
+            for (unsigned int index = 0; index < atlasFile.GetNumberOfFrames(); ++index)
+            {
+                const AtlasFrameData& frame = atlasFile.GetFrame(index);
+                aAtlasFrames[atlasFile.GetKey(index)] = new SourceFrame(frame.x, frame.y, frame.width, frame.height);
+            }
+        }
+        return atlasFile.IsLoaded();
     }
     
-    bool TextureManager::CanUpdate()
+    void TextureManager::DecodeTexturePreload(void* aTexturePreload)
     {
-        return false;
+        TexturePreload* texturePreload = (TexturePreload*)aTexturePreload;
+        
+        //Decode the png image, the OpenGL texture is generated on the main thread
+        texturePreload->isDecoded = texturePreload->texture->DecodeFromPath(texturePreload->path);
+        
+        //Parse the atlas json, if there is one
+        if(texturePreload->atlasPath.length() > 0)
+        {
+            LoadAtlas(texturePreload->atlasPath, texturePreload->atlasFrames);
+        }
     }
     
-    bool TextureManager::CanDraw()
+    void TextureManager::FinishTexturePreload(TexturePreload* aTexturePreload)
     {
-        return false;
+        //Wait for the job to decode the texture, the main thread runs jobs while it waits
+        ServiceLocator::GetJobSystem()->WaitForCounter(&aTexturePreload->counter);
+        
+        //Get the texture's filename
+        string filename = aTexturePreload->texture->GetFilename();
+        
+        //Generate the OpenGL texture, the reference count is zero until a TextureFrame adds the texture
+        Resource* resource = ServiceLocator::GetResourceManager()->GetResource(ResourceTypeTexture, filename);
+        if(aTexturePreload->isDecoded == true)
+        {
+            aTexturePreload->texture->UploadImageData();
+            ServiceLocator::GetResourceManager()->SetResourceLoaded(resource, aTexturePreload->texture->GetNumberOfBytes());
+            WatchFile(aTexturePreload->path, filename);
+        }
+        else
+        {
+            Error(false, "Failed to preload texture: %s", filename.c_str());
+            ServiceLocator::GetResourceManager()->UnloadResource(resource);
+        }
+        
+        //Set the atlas, if it was parsed
+        if(aTexturePreload->atlasFrames.size() > 0)
+        {
+            m_AtlasKeys[filename] = aTexturePreload->atlasFrames;
+            WatchFile(aTexturePreload->atlasPath, filename);
+        }
+        
+        //Remove the texture preload
+        m_TexturePreloads.erase(filename);
+        SafeDelete(aTexturePreload);
     }
     
-    void TextureManager::HandleEvent(Event* aEvent)
+    void TextureManager::FinishTexturePreload(const string& aFilename)
     {
-        if(aEvent->GetEventCode() == LOW_MEMORY_WARNING_EVENT)
+        map<string, TexturePreload*>::iterator it = m_TexturePreloads.find(aFilename);
+        if(it != m_TexturePreloads.end())
         {
-            PurgeUnusedTextures();
+            FinishTexturePreload(it->second);
         }
     }
     
-    void TextureManager::PurgeUnusedTextures()
+    void TextureManager::WatchFile(const string& aPath, const string& aFilename)
     {
-        //Cycle through the texture map and purge any textures with a reference count of zero
-        for(map<string, pair<Texture*, unsigned int>>::iterator it = m_TextureMap.begin(); it != m_TextureMap.end();)
+#if HOT_RELOAD_TEXTURES
+        m_WatchedFiles[aPath] = aFilename;
+        ServiceLocator::GetFileWatcher()->WatchFile(aPath);
+#endif
+    }
+    
+    void TextureManager::HotReloadFile(const string& aPath)
+    {
+        //Get the filename of the texture the file belongs to
+        map<string, string>::iterator it = m_WatchedFiles.find(aPath);
+        if(it == m_WatchedFiles.end())
+        {
+            return;
+        }
+        string filename = it->second;
+        
+        //If the texture is being preloaded, finish preloading it
+        FinishTexturePreload(filename);
+        
+        //Get the texture, if it isn't resident it will be loaded from the changed file the next time it is used
+        Resource* resource = ServiceLocator::GetResourceManager()->GetResource(ResourceTypeTexture, filename);
+        Texture* texture = resource != nullptr && resource->state == ResourceStateLoaded ? (Texture*)resource->object : nullptr;
+        uvec2 previousTextureSize = texture != nullptr ? texture->GetSize() : uvec2(0, 0);
+        
+        //Is the file the atlas json or the png image?
+        size_t found = aPath.rfind(".json");
+        if(found != std::string::npos && found == aPath.length() - 5)
         {
-            //Is the reference count zero
-            if(it->second.second == 0)
+            if(ReloadAtlas(aPath, filename) == false)
             {
-                //Delete the texture object
-                SafeDelete(it->second.first);
+                return;
+            }
+        }
+        else
+        {
+            //Safety check the texture
+            if(texture == nullptr)
+            {
+                return;
+            }
+            
+            //Reload the texture in place, the texture's resource and the texture frames keep pointing to it
+            if(texture->ReloadFromPath(aPath) == false)
+            {
+                Error(false, "Failed to hot-reload texture: %s, the current texture is kept", filename.c_str());
+                return;
+            }
+        }
+        
+        //Update the texture frames using the texture, an atlas frame is updated to its reloaded source frame
+        map<string, vector<TextureFrame*>>::iterator frames = m_TextureFrames.find(filename);
+        map<string, map<string, SourceFrame*>>::iterator atlas = m_AtlasKeys.find(filename);
+        unsigned int numberOfTextureFrames = 0;
+        
+        if(texture != nullptr && frames != m_TextureFrames.end())
+        {
+            for(unsigned int i = 0; i < frames->second.size(); i++)
+            {
+                TextureFrame* textureFrame = frames->second.at(i);
+                SourceFrame* atlasFrame = nullptr;
                 
-                //Erase the pointer from the texture map
-                map<string, pair<Texture*, unsigned int>>::iterator eraseIt = it;
-                ++it;
-                m_TextureMap.erase(eraseIt);
+                //Safety check that the atlas key is still in the atlas, if it isn't the texture frame keeps its source frame
+                string atlasKey = textureFrame->GetAtlasKey();
+                if(atlasKey != "" && atlas != m_AtlasKeys.end())
+                {
+                    map<string, SourceFrame*>::iterator atlasFrameIt = atlas->second.find(atlasKey);
+                    atlasFrame = atlasFrameIt != atlas->second.end() ? atlasFrameIt->second : nullptr;
+                }
+                
+                textureFrame->ReloadSourceFrame(atlasFrame, previousTextureSize);
+                numberOfTextureFrames++;
+            }
+        }
+        
+        Log(VerbosityLevel_Debug, "Hot-reloaded: %s, %u texture frames updated", aPath.c_str(), numberOfTextureFrames);
+        
+        //Update the texture's size in the resource manager last, the texture could be evicted if it is unused
+        if(texture != nullptr)
+        {
+            ServiceLocator::GetResourceManager()->ResizeResource(resource, texture->GetNumberOfBytes());
+        }
+    }
+    
+    bool TextureManager::ReloadAtlas(const string& aJsonPath, const string& aFilename)
+    {
+        //Parse the atlas json file again
+        map<string, SourceFrame*> reloadedFrames;
+        if(LoadAtlas(aJsonPath, reloadedFrames) == false)
+        {
+            Error(false, "Failed to hot-reload atlas: %s, the current atlas is kept", aJsonPath.c_str());
+            return false;
+        }
+        
+        //Copy the reloaded frames into the existing source frames, the new atlas keys are added. The atlas keys
+        //that were removed from the json are kept, the texture frames that use them keep their source frame
+        map<string, SourceFrame*>& atlasFrames = m_AtlasKeys[aFilename];
+        for(map<string, SourceFrame*>::iterator it = reloadedFrames.begin(); it != reloadedFrames.end(); ++it)
+        {
+            map<string, SourceFrame*>::iterator atlasFrame = atlasFrames.find(it->first);
+            if(atlasFrame != atlasFrames.end() && atlasFrame->second != nullptr)
+            {
+                *atlasFrame->second = *it->second;
+                SafeDelete(it->second);
             }
             else
             {
-                it++;
+                atlasFrames[it->first] = it->second;
             }
         }
+        return true;
+    }
+    
+    void TextureManager::Update(double aDelta)
+    {
+        //Generate the OpenGL textures for the decoded textures, until the upload budget is used up
+        double startTime = ServiceLocator::GetPlatformLayer()->GetElapsedTime();
+        map<string, TexturePreload*>::iterator it = m_TexturePreloads.begin();
+        while(it != m_TexturePreloads.end())
+        {
+            //Get the texture preload and advance the iterator, finishing the preload erases it from the map
+            TexturePreload* texturePreload = it->second;
+            ++it;
+            
+            //Only finish the preloads that have been decoded, finishing the others would wait for their job
+            if(texturePreload->counter.IsDone() == true)
+            {
+                FinishTexturePreload(texturePreload);
+                
+                //Is the upload budget used up?
+                double elapsed = ServiceLocator::GetPlatformLayer()->GetElapsedTime() - startTime;
+                if(elapsed * 1000.0 >= TEXTURE_UPLOAD_BUDGET_MILLISECONDS)
+                {
+                    break;
+                }
+            }
+        }
+    }
+    
+    bool TextureManager::CanUpdate()
+    {
+        return m_TexturePreloads.size() > 0;
+    }
+    
+    bool TextureManager::CanDraw()
+    {
+        return false;
+    }
+    
+    void TextureManager::UnloadResource(ResourceType aType, void* aObject)
+    {
+        Texture* texture = (Texture*)aObject;
+        SafeDelete(texture);
+    }
+    
+    void TextureManager::HandleEvent(Event* aEvent)
+    {
+        if(aEvent->GetEventCode() == FILE_CHANGED_EVENT)
+        {
+            FileChangedEvent* fileChangedEvent = (FileChangedEvent*)aEvent;
+            HotReloadFile(fileChangedEvent->GetPath());
+        }
     }
     
     Texture* TextureManager::GetPlaceHolder()
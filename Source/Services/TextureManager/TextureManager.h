@@ -10,8 +10,9 @@
 #define __GameDev2D__TextureManager__
 
 #include "../GameService.h"
+#include "../JobSystem/JobSystem.h"
+#include "../ResourceManager/ResourceHandle.h"
 #include "../../Graphics/Textures/TextureFrame.h"
-#include "json.h"
 
 using namespace std;
 
@@ -20,18 +21,47 @@ namespace GameDev2D
     //Forward declarations
     class Texture;
 
-    //The TextureManager uses reference counting to ensure that the same texture isn't loaded twice.
-    //It will also generate a default checkerboard texture if the texture being loaded doesn't exist.
-    class TextureManager : public GameService
+    //A texture that is being preloaded, the png image and the atlas json (if there is one) are decoded by a job
+    struct TexturePreload
+    {
+        Texture* texture;
+        string path;
+        string atlasPath;
+        map<string, SourceFrame*> atlasFrames;
+        bool isDecoded;
+        JobCounter counter;
+    };
+
+    //The TextureManager uses the ResourceManager to reference count the textures, to ensure that the same texture isn't
+    //loaded twice, unused textures stay resident until the ResourceManager evicts them. It will also generate a default
+    //checkerboard texture if the texture being loaded doesn't exist.
+    //Textures can be preloaded, the png image is decoded on the JobSystem and the OpenGL textures are
+    //generated in Update(), a few at a time within TEXTURE_UPLOAD_BUDGET_MILLISECONDS each frame.
+    //If HOT_RELOAD_TEXTURES is enabled, the loaded textures and atlas json files are watched by the FileWatcher. When one
+    //changes on disk the texture (or atlas) is reloaded in place and the TextureFrames using it are updated, the Sprites
+    //and TextureFrames don't have to be recreated.
+    class TextureManager : public GameService, public ResourceUnloader
     {
     public:
         TextureManager();
         ~TextureManager();
         
         //Loads a texture (if its not already loaded) and increments the reference count if it is loaded.
-        //If the texture doesn't exist a default checkerboard texture is loaded
+        //If the texture doesn't exist a default checkerboard texture is loaded. If the texture is being
+        //preloaded, this waits for the preload to finish
         void AddTexture(const string& filename, const string& directory, TextureFrame* textureFrame = nullptr);
         
+        //Preloads a texture and its atlas json (if there is one) in the background, the reference count isn't
+        //incremented, the texture is added as an unused texture. Does nothing if the texture is already loaded.
+        //Returns the texture's handle, it is loading until the OpenGL texture has been generated
+        ResourceHandle<Texture> PreloadTexture(const string& filename, const string& directory);
+        
+        //Returns the handle for a texture, the texture doesn't have to be loaded
+        ResourceHandle<Texture> GetTextureHandle(const string& filename);
+        
+        //Returns wether the texture is still being preloaded, scenes can wait for it before creating their sprites
+        bool IsTexturePreloading(const string& filename);
+        
         //Decerements the reference count of a texture
         bool RemoveTexture(TextureFrame* textureFrame);
         bool RemoveTexture(const string& filename);
@@ -39,27 +69,50 @@ namespace GameDev2D
         //Conveniance methods to load a TextureFrame from a texture atlas
         SourceFrame* LoadAtlasFrame(const string& filename, const string& atlasKey, const string& directory);
         
-        //Used to determine if the FontManager should be updated and drawn
+        //Generates the OpenGL textures for the preloaded textures that have been decoded
+        void Update(double delta);
+        
+        //Used to determine if the TextureManager should be updated and drawn
         bool CanUpdate();
         bool CanDraw();
         
-        //Handles events, we need to handle a low memory event
+        //Deletes a texture evicted by the ResourceManager, inherited from ResourceUnloader
+        void UnloadResource(ResourceType type, void* object);
+        
+        //Handles events, we need to handle the file changed event to hot-reload the textures
         void HandleEvent(Event* event);
         
     private:
-        //
-        SourceFrame* LoadFrame(const Json::Value& frame);
-
-        //Will purge any textures with a reference count of zero
-        void PurgeUnusedTextures();
+        //Loads the frames of a texture atlas json file, doesn't use any member variables so it can be called from a job
+        static bool LoadAtlas(const string& jsonPath, map<string, SourceFrame*>& atlasFrames);
+        
+        //The preload job, decodes the png image and parses the atlas json
+        static void DecodeTexturePreload(void* texturePreload);
+        
+        //Waits for a preload's job, generates the OpenGL texture and adds the texture and atlas frames
+        void FinishTexturePreload(TexturePreload* texturePreload);
+        
+        //Finishes the preload for a filename, if the texture is being preloaded
+        void FinishTexturePreload(const string& filename);
         
+        //Watches a texture's png or atlas json file, if hot-reloading is enabled
+        void WatchFile(const string& path, const string& filename);
+        
+        //Reloads the texture or atlas for a watched file that changed, then updates the texture's TextureFrames
+        void HotReloadFile(const string& path);
+        
+        //Reloads a texture atlas json file, the reloaded frames are copied into the existing source frames
+        bool ReloadAtlas(const string& jsonPath, const string& filename);
+
         //Conveniance method to load and return the placeholder checkerboard texture
         //in the event a texture being loaded doesn't exist
         Texture* GetPlaceHolder();
         
         //Member variables
-        map<string, pair<Texture*, unsigned int>> m_TextureMap;
         map<string, map<string, SourceFrame*>> m_AtlasKeys;
+        map<string, TexturePreload*> m_TexturePreloads;
+        map<string, vector<TextureFrame*>> m_TextureFrames;
+        map<string, string> m_WatchedFiles;
         Texture* m_PlaceHolder;
     };
 }
@@ -955,16 +955,16 @@ namespace GameDev2D
     void Button::ResetModelMatrix()
     {
         //Translate the anchor, then translate the position
-        mat4 anchor = translate(mat4(1.0f), vec3(-GetWidth() * GetWorldScale().x * m_AnchorPoint.x, -GetHeight() * GetWorldScale().y * m_AnchorPoint.y, 0.0f));
-        mat4 viewTranslate = translate(anchor, vec3(GetWorldPosition().x, GetWorldPosition().y, 0.0f));
+        mat4 anchor = translate(mat4(1.0f), vec3(-GetWidth() * GetRenderScale().x * m_AnchorPoint.x, -GetHeight() * GetRenderScale().y * m_AnchorPoint.y, 0.0f));
+        mat4 viewTranslate = translate(anchor, vec3(GetRenderPosition().x, GetRenderPosition().y, 0.0f));
 
         //Calculate the rotation based on the anchor point
-        mat4 halfTranslate1 = translate(viewTranslate, vec3(GetWidth() * GetWorldScale().x * m_AnchorPoint.x, GetHeight() * GetWorldScale().y * m_AnchorPoint.y, 0.0f));
-        mat4 viewRotation = rotate(halfTranslate1, GetWorldAngle(), vec3(0.0f, 0.0f, 1.0f));
-        mat4 halfTranslate2 = translate(viewRotation, vec3(-GetWidth() * GetWorldScale().x * m_AnchorPoint.x, -GetHeight() * GetWorldScale().y * m_AnchorPoint.y, 0.0f));
+        mat4 halfTranslate1 = translate(viewTranslate, vec3(GetWidth() * GetRenderScale().x * m_AnchorPoint.x, GetHeight() * GetRenderScale().y * m_AnchorPoint.y, 0.0f));
+        mat4 viewRotation = rotate(halfTranslate1, GetRenderAngle(), vec3(0.0f, 0.0f, 1.0f));
+        mat4 halfTranslate2 = translate(viewRotation, vec3(-GetWidth() * GetRenderScale().x * m_AnchorPoint.x, -GetHeight() * GetRenderScale().y * m_AnchorPoint.y, 0.0f));
         
         //Lastly the scale
-        m_ModelMatrix = scale(halfTranslate2, vec3(GetWorldScale().x, GetWorldScale().y, 0.0f));
+        m_ModelMatrix = scale(halfTranslate2, vec3(GetRenderScale().x, GetRenderScale().y, 0.0f));
         
         //Lastly, reset the GameObject's model matrix, this resets the model matrix of the children
         GameObject::ResetModelMatrix();
@@ -184,29 +184,33 @@ namespace GameDev2D
             ResetModelMatrix();
         }
     
-        //Is the render target null
-        if(m_RenderTarget != nullptr)
-        {
-            //Draw the render target
-            m_RenderTarget->GetTextureFrame()->Draw(m_ModelMatrix);
-        }
-        else
+        //Only draw the text if the Label is inside the camera's view
+        if(IsInView() == true)
         {
-            //Draw the text with out the render target
-            DrawText();
+            //Is the render target null
+            if(m_RenderTarget != nullptr)
+            {
+                //Draw the render target
+                m_RenderTarget->GetTextureFrame()->Draw(m_ModelMatrix);
+            }
+            else
+            {
+                //Draw the text with out the render target
+                DrawText();
+            }
+            
+            //Draw a debug label rect
+            #if DRAW_LABEL_RECT
+            Rect rect(GetWorldPosition().x, GetWorldPosition().y, GetWidth(), GetHeight());
+            rect.SetIsFilled(false);
+            rect.SetColor(DRAW_LABEL_RECT_COLOR);
+            rect.SetAnchorPoint(GetAnchorPoint());
+            rect.SetLocalAngle(GetWorldAngle());
+            rect.SetLocalScale(GetWorldScale());
+            rect.Draw();
+            #endif
         }
         
-        //Draw a debug label rect
-        #if DRAW_LABEL_RECT
-        Rect rect(GetWorldPosition().x, GetWorldPosition().y, GetWidth(), GetHeight());
-        rect.SetIsFilled(false);
-        rect.SetColor(DRAW_LABEL_RECT_COLOR);
-        rect.SetAnchorPoint(GetAnchorPoint());
-        rect.SetLocalAngle(GetWorldAngle());
-        rect.SetLocalScale(GetWorldScale());
-        rect.Draw();
-        #endif
-        
         //Draw the GameObject, which draws all the children
         GameObject::Draw();
     }
@@ -441,16 +445,19 @@ namespace GameDev2D
     void Label::ResetModelMatrix()
     {
         //Translate the anchor, then translate the position
-        mat4 anchor = translate(mat4(1.0f), vec3(-GetWidth() * GetWorldScale().x * GetAnchorPoint().x, -GetHeight() * GetWorldScale().y * GetAnchorPoint().y, 0.0f));
-        mat4 viewTranslate = translate(anchor, vec3(GetWorldPosition().x, GetWorldPosition().y, 0.0f));
+        mat4 anchor = translate(mat4(1.0f), vec3(-GetWidth() * GetRenderScale().x * GetAnchorPoint().x, -GetHeight() * GetRenderScale().y * GetAnchorPoint().y, 0.0f));
+        mat4 viewTranslate = translate(anchor, vec3(GetRenderPosition().x, GetRenderPosition().y, 0.0f));
 
         //Calculate the rotation based on the anchor point
-        mat4 halfTranslate1 = translate(viewTranslate, vec3(GetWidth() * GetWorldScale().x * GetAnchorPoint().x, GetHeight() * GetWorldScale().y * GetAnchorPoint().y, 0.0f));
-        mat4 viewRotation = rotate(halfTranslate1, GetWorldAngle(), vec3(0.0f, 0.0f, 1.0f));
-        mat4 halfTranslate2 = translate(viewRotation, vec3(-GetWidth() * GetWorldScale().x * GetAnchorPoint().x, -GetHeight() * GetWorldScale().y * GetAnchorPoint().y, 0.0f));
+        mat4 halfTranslate1 = translate(viewTranslate, vec3(GetWidth() * GetRenderScale().x * GetAnchorPoint().x, GetHeight() * GetRenderScale().y * GetAnchorPoint().y, 0.0f));
+        mat4 viewRotation = rotate(halfTranslate1, GetRenderAngle(), vec3(0.0f, 0.0f, 1.0f));
+        mat4 halfTranslate2 = translate(viewRotation, vec3(-GetWidth() * GetRenderScale().x * GetAnchorPoint().x, -GetHeight() * GetRenderScale().y * GetAnchorPoint().y, 0.0f));
         
         //Lastly the scale
-        m_ModelMatrix = scale(halfTranslate2, vec3(GetWorldScale().x, GetWorldScale().y, 0.0f));
+        m_ModelMatrix = scale(halfTranslate2, vec3(GetRenderScale().x, GetRenderScale().y, 0.0f));
+        
+        //Cache the world bounds, used to cull the Label when it is outside the camera's view
+        ResetBounds(vec2(0.0f, 0.0f), vec2(GetWidth(), GetHeight()));
         
         //Reset the model matrix
         GameObject::ResetModelMatrix();
@@ -10,6 +10,7 @@
 #define __GameDev2D__Label__
 
 #include "../../Core/GameObject.h"
+#include "../../Core/MemoryTracker.h"
 #include "../../Graphics/Fonts/TrueTypeFont.h"
 #include "../../Graphics/Fonts/BitmapFont.h"
 #include "../../Graphics/Core/Color.h"
@@ -40,7 +41,7 @@ namespace GameDev2D
     //spacing can all be animated, with easing applied. Label's created with Bitmap fonts must
     //use the 'Glyph Designer' software, see the BitmapFont header file for more info. Internally
     //the Label renders the text to a render target to ensure there is only 1 draw call instead of several
-    class Label : public GameObject
+    class Label : public GameObject, public MemoryTracked<MemoryTag_Labels>
     {
     public:
         //Contructs a Label using a BitmapFont, the font size can NOT be specified
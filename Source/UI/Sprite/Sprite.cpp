@@ -8,6 +8,7 @@
 
 #include "Sprite.h"
 #include "../../Graphics/Textures/TextureFrame.h"
+#include "../../IO/AtlasFile.h"
 #include "../../Services/ServiceLocator.h"
 #include "../../Platforms/PlatformLayer.h"
 
@@ -207,23 +208,102 @@ namespace GameDev2D
             ResetModelMatrix();
         }
         
-        //Draw the current frame
-        m_Frames.at(m_FrameIndex)->Draw(m_ModelMatrix);
-        
-        #if DRAW_SPRITE_RECT
-        Rect rect(GetWorldPosition().x, GetWorldPosition().y, GetWidth(), GetHeight());
-        rect.SetIsFilled(false);
-        rect.SetColor(DRAW_SPRITE_RECT_COLOR);
-        rect.SetAnchorPoint(GetAnchorPoint());
-        rect.SetLocalAngle(GetWorldAngle());
-        rect.SetLocalScale(GetWorldScale());
-        rect.Draw();
-        #endif
+        //Draw the current frame, if it is inside the camera's view
+        if(IsInView() == true)
+        {
+            m_Frames.at(m_FrameIndex)->Draw(m_ModelMatrix);
+            
+            #if DRAW_SPRITE_RECT
+            Rect rect(GetWorldPosition().x, GetWorldPosition().y, GetWidth(), GetHeight());
+            rect.SetIsFilled(false);
+            rect.SetColor(DRAW_SPRITE_RECT_COLOR);
+            rect.SetAnchorPoint(GetAnchorPoint());
+            rect.SetLocalAngle(GetWorldAngle());
+            rect.SetLocalScale(GetWorldScale());
+            rect.Draw();
+            #endif
+        }
         
-        //Draw the GameObject, this will draw any children
+        //Draw the GameObject, this will draw any children, they are culled on their own
         GameObject::Draw();
     }
     
+    void Sprite::DrawBatch(const vector<vec2>& aPositions, const vector<float>& aAngles)
+    {
+        //If this assert is hit, there isn't an angle for every position
+        assert(aPositions.size() == aAngles.size());
+    
+        //Safety check the texture frame
+        if(m_Frames.size() == 0)
+        {
+            Error(false, "Failed to draw sprite batch, there aren't any frames to draw");
+            return;
+        }
+        
+        //Safety check the shader
+        if(m_Shader == nullptr)
+        {
+            Error(false, "Failed to draw sprite batch, the shader is null");
+            return;
+        }
+        
+        //The anchor offset and scale are the same for every copy in the batch
+        vec3 anchor = vec3(GetWidth() * GetWorldScale().x * m_AnchorPoint.x, GetHeight() * GetWorldScale().y * m_AnchorPoint.y, 0.0f);
+        vec3 spriteScale = vec3(GetWorldScale().x, GetWorldScale().y, 0.0f);
+        
+        //Calculate the model matrix for each copy, the same way ResetModelMatrix() does
+        m_BatchModelMatrices.resize(aPositions.size());
+        for(unsigned int i = 0; i < aPositions.size(); i++)
+        {
+            mat4 viewTranslate = translate(mat4(1.0f), vec3(aPositions.at(i).x, aPositions.at(i).y, 0.0f));
+            mat4 viewRotation = rotate(viewTranslate, aAngles.at(i), vec3(0.0f, 0.0f, 1.0f));
+            mat4 anchorTranslate = translate(viewRotation, -anchor);
+            m_BatchModelMatrices.at(i) = scale(anchorTranslate, spriteScale);
+        }
+        
+        //Draw the current frame for all the model matrices
+        m_Frames.at(m_FrameIndex)->DrawBatch(m_BatchModelMatrices);
+    }
+    
+    void Sprite::DrawBatch(const vector<vec2>& aPositions, const vector<float>& aAngles, const vector<SourceFrame>& aSourceFrames)
+    {
+        //If this assert is hit, there isn't an angle and a source frame for every position
+        assert(aPositions.size() == aAngles.size());
+        assert(aPositions.size() == aSourceFrames.size());
+    
+        //Safety check the texture frame
+        if(m_Frames.size() == 0)
+        {
+            Error(false, "Failed to draw sprite batch, there aren't any frames to draw");
+            return;
+        }
+        
+        //Safety check the shader
+        if(m_Shader == nullptr)
+        {
+            Error(false, "Failed to draw sprite batch, the shader is null");
+            return;
+        }
+        
+        //The scale is the same for every copy in the batch, the anchor offset depends on each copy's source frame size
+        vec2 worldScale = vec2(GetWorldScale().x, GetWorldScale().y);
+        vec3 spriteScale = vec3(worldScale.x, worldScale.y, 0.0f);
+        
+        //Calculate the model matrix for each copy, the same way ResetModelMatrix() does
+        m_BatchModelMatrices.resize(aPositions.size());
+        for(unsigned int i = 0; i < aPositions.size(); i++)
+        {
+            vec2 anchor = aSourceFrames.at(i).size * worldScale * m_AnchorPoint;
+            mat4 viewTranslate = translate(mat4(1.0f), vec3(aPositions.at(i).x, aPositions.at(i).y, 0.0f));
+            mat4 viewRotation = rotate(viewTranslate, aAngles.at(i), vec3(0.0f, 0.0f, 1.0f));
+            mat4 anchorTranslate = translate(viewRotation, -vec3(anchor.x, anchor.y, 0.0f));
+            m_BatchModelMatrices.at(i) = scale(anchorTranslate, spriteScale);
+        }
+        
+        //Draw each copy with its source frame from the current frame's texture
+        m_Frames.at(m_FrameIndex)->DrawBatch(m_BatchModelMatrices, aSourceFrames);
+    }
+    
     void Sprite::Reset()
     {
         //Reset the elapsed time and frame index
@@ -250,6 +330,15 @@ namespace GameDev2D
         }
     }
     
+    SourceFrame Sprite::GetSourceFrame()
+    {
+        if(m_Frames.size() > 0)
+        {
+            return m_Frames.at(m_FrameIndex)->GetSourceFrame();
+        }
+        return SourceFrame();
+    }
+    
     vec2 Sprite::GetSize()
     {
         return vec2(GetWidth(), GetHeight());
@@ -440,16 +529,19 @@ namespace GameDev2D
     void Sprite::ResetModelMatrix()
     {
         //Translate the anchor, then translate the position
-        mat4 anchor = translate(mat4(1.0f), vec3(-GetWidth() * GetWorldScale().x * m_AnchorPoint.x, -GetHeight() * GetWorldScale().y * m_AnchorPoint.y, 0.0f));
-        mat4 viewTranslate = translate(anchor, vec3(GetWorldPosition().x, GetWorldPosition().y, 0.0f));
+        mat4 anchor = translate(mat4(1.0f), vec3(-GetWidth() * GetRenderScale().x * m_AnchorPoint.x, -GetHeight() * GetRenderScale().y * m_AnchorPoint.y, 0.0f));
+        mat4 viewTranslate = translate(anchor, vec3(GetRenderPosition().x, GetRenderPosition().y, 0.0f));
 
         //Calculate the rotation based on the anchor point
-        mat4 halfTranslate1 = translate(viewTranslate, vec3(GetWidth() * GetWorldScale().x * m_AnchorPoint.x, GetHeight() * GetWorldScale().y * m_AnchorPoint.y, 0.0f));
-        mat4 viewRotation = rotate(halfTranslate1, GetWorldAngle(), vec3(0.0f, 0.0f, 1.0f));
-        mat4 halfTranslate2 = translate(viewRotation, vec3(-GetWidth() * GetWorldScale().x * m_AnchorPoint.x, -GetHeight() * GetWorldScale().y * m_AnchorPoint.y, 0.0f));
+        mat4 halfTranslate1 = translate(viewTranslate, vec3(GetWidth() * GetRenderScale().x * m_AnchorPoint.x, GetHeight() * GetRenderScale().y * m_AnchorPoint.y, 0.0f));
+        mat4 viewRotation = rotate(halfTranslate1, GetRenderAngle(), vec3(0.0f, 0.0f, 1.0f));
+        mat4 halfTranslate2 = translate(viewRotation, vec3(-GetWidth() * GetRenderScale().x * m_AnchorPoint.x, -GetHeight() * GetRenderScale().y * m_AnchorPoint.y, 0.0f));
         
         //Lastly the scale
-        m_ModelMatrix = scale(halfTranslate2, vec3(GetWorldScale().x, GetWorldScale().y, 0.0f));
+        m_ModelMatrix = scale(halfTranslate2, vec3(GetRenderScale().x, GetRenderScale().y, 0.0f));
+        
+        //Cache the world bounds, used to cull the Sprite when it is outside the camera's view
+        ResetBounds(vec2(0.0f, 0.0f), vec2(GetWidth(), GetHeight()));
         
         //Call the GameObject's ResetModelMatrix() method
         GameObject::ResetModelMatrix();
@@ -477,31 +569,14 @@ namespace GameDev2D
         //Does the file exist, load the json data
         if(doesExist == true)
         {
-            //Open the input stream
-            std::ifstream inputStream;
-            inputStream.open(jsonPath, std::ifstream::in);
+            //Load the json, or its binary cache if it is up to date
+            AtlasFile atlasFile(jsonPath);
             
-            //Parse the json file
-            Json::Value root;
-            Json::Reader reader;
-            if(reader.parse(inputStream, root, false) == true)
+            //Cycle through and setup each frame in the animation, in the order they are in the json
+            for(unsigned int index = 0; index < atlasFile.GetNumberOfFrames(); index++)
             {
-                //Get the frames data
-                const Json::Value frames = root["frames"];
-                
-                //Cycle through and setup each frame in the animation
-                for(unsigned int index = 0; index < frames.size(); index++)
-                {
-                    //Get the atlas key
-                    Json::Value atlasKey = frames[index]["filename"];
-
-                    //Add the frame
-                    AddFrame(new TextureFrame(aImageFile, atlasKey.asString(), "Images"));
-                }
+                AddFrame(new TextureFrame(aImageFile, atlasFile.GetKey(index), "Images"));
             }
-            
-            //Close the input stream
-            inputStream.close();
         }
     }
 }
\ No newline at end of file
@@ -21,6 +21,7 @@ namespace GameDev2D
     //Forward declarations
     class TextureFrame;
     class Shader;
+    struct SourceFrame;
     
     //The Sprite class inherits from the GameObject class and the EventDispatcher class. It can display a
     //single framed Sprite OR an animated Sprite. It is designed to load animated sprites or sprites from
@@ -57,12 +58,23 @@ namespace GameDev2D
         //Draws the Sprite
         void Draw();
         
+        //Draws the current frame once for every position and angle in a single draw call, the Sprite's
+        //own position and angle are ignored, the anchor point, scale and color are shared by every copy
+        void DrawBatch(const vector<vec2>& positions, const vector<float>& angles);
+        
+        //Draws a copy of the current frame's texture for every position and angle in a single draw call, each copy
+        //shows its own source frame. The source frames must all be in the current frame's texture (ie. the same atlas)
+        void DrawBatch(const vector<vec2>& positions, const vector<float>& angles, const vector<SourceFrame>& sourceFrames);
+        
         //Resets the Sprite, if animated back to the first frame
         void Reset();
         
         //Sets the Shader to render the Sprite with
         void SetShader(Shader* shader);
         
+        //Returns the source frame of the current frame of the Sprite
+        SourceFrame GetSourceFrame();
+        
         //Returns the size of the current frame of the Sprite.
         vec2 GetSize();
         float GetWidth();
@@ -134,6 +146,7 @@ namespace GameDev2D
         Tween m_TweenAnchorY;
         Tween m_TweenAlpha;
         bool m_DidDispatchFinishedEvent;
+        vector<mat4> m_BatchModelMatrices;
     };
 }
 